@@ -4,6 +4,7 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'MTLTexture' as ImTextureID. Read the FAQ about ImTextureID!
 //  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Compact 12 bytes vertex layout (IMGUI_USE_COMPACT_DRAWVERT).
 
 // You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
@@ -11,6 +12,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2020-10-30: Metal: Support compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT): SNORM16 positions scaled by the projection matrix, UNORM16 UV.
 //  2019-05-29: Metal: Added support for large mesh (64K+ vertices), enable ImGuiBackendFlags_RendererHasVtxOffset flag.
 //  2019-04-30: Metal: Added support for special ImDrawCallback_ResetRenderState callback to reset render state.
 //  2019-02-11: Metal: Projecting clipping rectangles correctly using draw_data->FramebufferScale to allow multi-viewports for retina display.
@@ -365,10 +367,18 @@ void ImGui_ImplMetal_DestroyDeviceObjects()
 
     MTLVertexDescriptor *vertexDescriptor = [MTLVertexDescriptor vertexDescriptor];
     vertexDescriptor.attributes[0].offset = IM_OFFSETOF(ImDrawVert, pos);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    vertexDescriptor.attributes[0].format = MTLVertexFormatShort2Normalized; // position
+#else
     vertexDescriptor.attributes[0].format = MTLVertexFormatFloat2; // position
+#endif
     vertexDescriptor.attributes[0].bufferIndex = 0;
     vertexDescriptor.attributes[1].offset = IM_OFFSETOF(ImDrawVert, uv);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    vertexDescriptor.attributes[1].format = MTLVertexFormatUShort2Normalized; // texCoords
+#else
     vertexDescriptor.attributes[1].format = MTLVertexFormatFloat2; // texCoords
+#endif
     vertexDescriptor.attributes[1].bufferIndex = 0;
     vertexDescriptor.attributes[2].offset = IM_OFFSETOF(ImDrawVert, col);
     vertexDescriptor.attributes[2].format = MTLVertexFormatUChar4; // color
@@ -437,10 +447,15 @@ void ImGui_ImplMetal_DestroyDeviceObjects()
     float B = drawData->DisplayPos.y + drawData->DisplaySize.y;
     float N = viewport.znear;
     float F = viewport.zfar;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const float S = 32767.0f / IM_DRAWVERT_POS16_ONE; // Positions are fetched as SNORM16 fixed point
+#else
+    const float S = 1.0f;
+#endif
     const float ortho_projection[4][4] =
     {
-        { 2.0f/(R-L),   0.0f,           0.0f,   0.0f },
-        { 0.0f,         2.0f/(T-B),     0.0f,   0.0f },
+        { 2.0f*S/(R-L), 0.0f,           0.0f,   0.0f },
+        { 0.0f,         2.0f*S/(T-B),   0.0f,   0.0f },
         { 0.0f,         0.0f,        1/(F-N),   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T), N/(F-N),   1.0f },
     };
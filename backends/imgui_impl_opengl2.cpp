@@ -32,6 +32,9 @@
 
 #include "imgui.h"
 #include "imgui_impl_opengl2.h"
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error "IMGUI_USE_COMPACT_DRAWVERT is not supported by the OpenGL2 backend (fixed pipeline can't fetch normalized unsigned short texture coordinates)."
+#endif
 #if defined(_MSC_VER) && _MSC_VER <= 1500 // MSVC 2008 or earlier
 #include <stddef.h>     // intptr_t
 #else
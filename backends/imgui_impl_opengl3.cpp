@@ -6,6 +6,10 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [x] Renderer: Desktop GL only: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Single vertex/index buffer upload per frame (ImGuiBackendFlags_RendererMergeDrawLists). Opt-in: #define IMGUI_IMPL_OPENGL_MERGE_DRAW_LISTS.
+//  [X] Renderer: Compact 12 bytes vertex layout (IMGUI_USE_COMPACT_DRAWVERT).
+//  [X] Renderer: Partial font texture updates for glyphs rasterized on demand (ImFontConfig::DynamicGlyphs).
+//  [X] Renderer: Signed distance field fonts (ImFontConfig::SDF). GL ES 2.0 needs the GL_OES_standard_derivatives extension.
 
 // You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
@@ -13,6 +17,11 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2020-11-20: OpenGL: Set ImGuiBackendFlags_RendererHasTexUpdates.
+//  2020-11-16: OpenGL: Draw text of ImFontConfig::SDF fonts with a distance field shader, selected by ImFontAtlas::TexIDSDF.
+//  2020-11-09: OpenGL: Upload ImFontAtlas::TexDirtyRects to the font texture before rendering, for ImFontConfig::DynamicGlyphs.
+//  2020-10-30: OpenGL: Support compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT): 16-bit positions scaled by the projection matrix, normalized 16-bit UV.
+//  2020-10-28: OpenGL: Set ImGuiBackendFlags_RendererMergeDrawLists when IMGUI_IMPL_OPENGL_MERGE_DRAW_LISTS is defined, to upload a single vertex/index buffer per frame.
 //  2020-10-23: OpenGL: Save and restore current GL_PRIMITIVE_RESTART state.
 //  2020-10-15: OpenGL: Use glGetString(GL_VERSION) instead of glGetIntegerv(GL_MAJOR_VERSION, ...) when the later returns zero (e.g. Desktop GL 2.x)
 //  2020-09-17: OpenGL: Fix to avoid compiling/calling glBindSampler() on ES or pre 3.3 context which have the defines set by a loader.
@@ -146,6 +155,8 @@ static char         g_GlslVersionString[32] = "";   // Specified by user or dete
 static GLuint       g_FontTexture = 0;
 static GLuint       g_ShaderHandle = 0, g_VertHandle = 0, g_FragHandle = 0;
 static GLint        g_AttribLocationTex = 0, g_AttribLocationProjMtx = 0;                                // Uniforms location
+static GLuint       g_ShaderHandleSDF = 0, g_FragHandleSDF = 0;                                         // Distance field program (ImFontConfig::SDF), sharing g_VertHandle
+static GLint        g_AttribLocationTexSDF = 0, g_AttribLocationProjMtxSDF = 0;
 static GLuint       g_AttribLocationVtxPos = 0, g_AttribLocationVtxUV = 0, g_AttribLocationVtxColor = 0; // Vertex attributes location
 static unsigned int g_VboHandle = 0, g_ElementsHandle = 0;
 
@@ -176,6 +187,10 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     if (g_GlVersion >= 320)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 #endif
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates;     // We upload ImFontAtlas::TexDirtyRects, allowing for ImFontConfig::DynamicGlyphs.
+#ifdef IMGUI_IMPL_OPENGL_MERGE_DRAW_LISTS
+    io.BackendFlags |= ImGuiBackendFlags_RendererMergeDrawLists;    // Upload all vertices/indices with a single glBufferData() call each.
+#endif
 
     // Store GLSL version string so we can refer to it later in case we recreate shaders.
     // Note: GLSL version is NOT the same as GL version. Leave this to NULL if unsure.
@@ -274,13 +289,24 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     float T = draw_data->DisplayPos.y;
     float B = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
     if (!clip_origin_lower_left) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const float S = 1.0f / IM_DRAWVERT_POS16_ONE; // Positions are fetched as (unnormalized) 16-bit fixed point
+#else
+    const float S = 1.0f;
+#endif
     const float ortho_projection[4][4] =
     {
-        { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
-        { 0.0f,         2.0f/(T-B),   0.0f,   0.0f },
+        { 2.0f*S/(R-L), 0.0f,         0.0f,   0.0f },
+        { 0.0f,         2.0f*S/(T-B), 0.0f,   0.0f },
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
+    if (g_ShaderHandleSDF)
+    {
+        glUseProgram(g_ShaderHandleSDF);
+        glUniform1i(g_AttribLocationTexSDF, 0);
+        glUniformMatrix4fv(g_AttribLocationProjMtxSDF, 1, GL_FALSE, &ortho_projection[0][0]);
+    }
     glUseProgram(g_ShaderHandle);
     glUniform1i(g_AttribLocationTex, 0);
     glUniformMatrix4fv(g_AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
@@ -301,11 +327,46 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     glEnableVertexAttribArray(g_AttribLocationVtxPos);
     glEnableVertexAttribArray(g_AttribLocationVtxUV);
     glEnableVertexAttribArray(g_AttribLocationVtxColor);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    glVertexAttribPointer(g_AttribLocationVtxPos,   2, GL_SHORT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
+    glVertexAttribPointer(g_AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+#else
     glVertexAttribPointer(g_AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
     glVertexAttribPointer(g_AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+#endif
     glVertexAttribPointer(g_AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col));
 }
 
+// Upload the areas of the font texture modified by glyphs rasterized on demand (ImFontConfig::DynamicGlyphs)
+static void ImGui_ImplOpenGL3_UpdateFontsTexture()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (atlas->TexDirtyRects.Size == 0 || g_FontTexture == 0)
+        return;
+
+    unsigned char* pixels;
+    int width, height;
+    atlas->GetTexDataAsRGBA32(&pixels, &width, &height);
+    glBindTexture(GL_TEXTURE_2D, g_FontTexture);
+    for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+    {
+        const ImVec4& r = atlas->TexDirtyRects[n];
+        const int y = (int)r.y, h = (int)(r.w - r.y);
+#ifdef GL_UNPACK_ROW_LENGTH
+        const int x = (int)r.x, w = (int)(r.z - r.x);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, width);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, w, h, GL_RGBA, GL_UNSIGNED_BYTE, pixels + ((size_t)y * width + x) * 4);
+#else
+        // No GL_UNPACK_ROW_LENGTH on ES 2.0: upload whole rows
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y, width, h, GL_RGBA, GL_UNSIGNED_BYTE, pixels + (size_t)y * width * 4);
+#endif
+    }
+#ifdef GL_UNPACK_ROW_LENGTH
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+#endif
+    atlas->TexDirtyRects.resize(0);
+}
+
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
@@ -348,6 +409,8 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     GLboolean last_enable_primitive_restart = (g_GlVersion >= 310) ? glIsEnabled(GL_PRIMITIVE_RESTART) : GL_FALSE;
 #endif
 
+    ImGui_ImplOpenGL3_UpdateFontsTexture();
+
     // Setup desired GL state
     // Recreate the VAO every time (this is to easily allow multiple GL contexts to be rendered to. VAO are not shared among GL contexts)
     // The renderer would actually work without any VAO bound, but then our VertexAttrib calls would overwrite the default one currently bound.
@@ -356,6 +419,8 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     glGenVertexArrays(1, &vertex_array_object);
 #endif
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+    GLuint current_program = g_ShaderHandle;
+    const ImTextureID tex_id_sdf = ImGui::GetIO().Fonts->TexIDSDF;
 
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
@@ -378,7 +443,10 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+                    current_program = g_ShaderHandle;
+                }
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
             }
@@ -396,8 +464,15 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                     // Apply scissor/clipping rectangle
                     glScissor((int)clip_rect.x, (int)(fb_height - clip_rect.w), (int)(clip_rect.z - clip_rect.x), (int)(clip_rect.w - clip_rect.y));
 
-                    // Bind texture, Draw
-                    glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->TextureId);
+                    // Bind texture and program (the font texture with the distance field program for ImFontAtlas::TexIDSDF), Draw
+                    const bool use_sdf = (tex_id_sdf != NULL && pcmd->TextureId == tex_id_sdf);
+                    const GLuint program = use_sdf ? g_ShaderHandleSDF : g_ShaderHandle;
+                    if (program != current_program)
+                    {
+                        glUseProgram(program);
+                        current_program = program;
+                    }
+                    glBindTexture(GL_TEXTURE_2D, use_sdf ? g_FontTexture : (GLuint)(intptr_t)pcmd->TextureId);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                     if (g_GlVersion >= 320)
                         glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset);
@@ -464,7 +539,9 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
 
     // Store our identifier
+    // Distance field fonts use another identifier for the same texture: the address of g_FontTexture, which can't collide with a GL texture name in practice.
     io.Fonts->TexID = (ImTextureID)(intptr_t)g_FontTexture;
+    io.Fonts->TexIDSDF = g_ShaderHandleSDF ? (ImTextureID)&g_FontTexture : NULL;
 
     // Restore state
     glBindTexture(GL_TEXTURE_2D, last_texture);
@@ -479,6 +556,7 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
         ImGuiIO& io = ImGui::GetIO();
         glDeleteTextures(1, &g_FontTexture);
         io.Fonts->TexID = 0;
+        io.Fonts->TexIDSDF = 0;
         g_FontTexture = 0;
     }
 }
@@ -634,28 +712,87 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
         "}\n";
 
+    // Distance field fonts (ImFontConfig::SDF): the alpha channel is the distance to the glyph outline (0.5 on the outline),
+    // antialiased over one screen pixel with fwidth(). Coverage texels (white pixel, baked lines) still render about the same.
+    const GLchar* fragment_shader_sdf_glsl_120 =
+        "#ifdef GL_ES\n"
+        "    #extension GL_OES_standard_derivatives : enable\n"
+        "    precision mediump float;\n"
+        "#endif\n"
+        "uniform sampler2D Texture;\n"
+        "varying vec2 Frag_UV;\n"
+        "varying vec4 Frag_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float dist = texture2D(Texture, Frag_UV.st).a;\n"
+        "    float alpha = clamp((dist - 0.5) / max(fwidth(dist), 0.0001) + 0.5, 0.0, 1.0);\n"
+        "    gl_FragColor = vec4(Frag_Color.rgb, Frag_Color.a * alpha);\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_130 =
+        "uniform sampler2D Texture;\n"
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float dist = texture(Texture, Frag_UV.st).a;\n"
+        "    float alpha = clamp((dist - 0.5) / max(fwidth(dist), 0.0001) + 0.5, 0.0, 1.0);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * alpha);\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_300_es =
+        "precision mediump float;\n"
+        "uniform sampler2D Texture;\n"
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "layout (location = 0) out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float dist = texture(Texture, Frag_UV.st).a;\n"
+        "    float alpha = clamp((dist - 0.5) / max(fwidth(dist), 0.0001) + 0.5, 0.0, 1.0);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * alpha);\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_410_core =
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "uniform sampler2D Texture;\n"
+        "layout (location = 0) out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    float dist = texture(Texture, Frag_UV.st).a;\n"
+        "    float alpha = clamp((dist - 0.5) / max(fwidth(dist), 0.0001) + 0.5, 0.0, 1.0);\n"
+        "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * alpha);\n"
+        "}\n";
+
     // Select shaders matching our GLSL versions
     const GLchar* vertex_shader = NULL;
     const GLchar* fragment_shader = NULL;
+    const GLchar* fragment_shader_sdf = NULL;
     if (glsl_version < 130)
     {
         vertex_shader = vertex_shader_glsl_120;
         fragment_shader = fragment_shader_glsl_120;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_120;
     }
     else if (glsl_version >= 410)
     {
         vertex_shader = vertex_shader_glsl_410_core;
         fragment_shader = fragment_shader_glsl_410_core;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_410_core;
     }
     else if (glsl_version == 300)
     {
         vertex_shader = vertex_shader_glsl_300_es;
         fragment_shader = fragment_shader_glsl_300_es;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_300_es;
     }
     else
     {
         vertex_shader = vertex_shader_glsl_130;
         fragment_shader = fragment_shader_glsl_130;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_130;
     }
 
     // Create shaders
@@ -683,6 +820,38 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     g_AttribLocationVtxUV = (GLuint)glGetAttribLocation(g_ShaderHandle, "UV");
     g_AttribLocationVtxColor = (GLuint)glGetAttribLocation(g_ShaderHandle, "Color");
 
+    // Create the distance field program only when a font needs it (so GL ES 2.0 contexts without GL_OES_standard_derivatives don't report errors)
+    bool use_sdf = false;
+    for (int n = 0; n < ImGui::GetIO().Fonts->ConfigData.Size; n++)
+        use_sdf |= ImGui::GetIO().Fonts->ConfigData[n].SDF;
+    if (use_sdf)
+    {
+        const GLchar* fragment_shader_sdf_with_version[2] = { g_GlslVersionString, fragment_shader_sdf };
+        g_FragHandleSDF = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(g_FragHandleSDF, 2, fragment_shader_sdf_with_version, NULL);
+        glCompileShader(g_FragHandleSDF);
+        g_ShaderHandleSDF = glCreateProgram();
+        glAttachShader(g_ShaderHandleSDF, g_VertHandle);
+        glAttachShader(g_ShaderHandleSDF, g_FragHandleSDF);
+        glBindAttribLocation(g_ShaderHandleSDF, g_AttribLocationVtxPos, "Position"); // Same vertex attributes locations as g_ShaderHandle, setup once by ImGui_ImplOpenGL3_SetupRenderState()
+        glBindAttribLocation(g_ShaderHandleSDF, g_AttribLocationVtxUV, "UV");
+        glBindAttribLocation(g_ShaderHandleSDF, g_AttribLocationVtxColor, "Color");
+        glLinkProgram(g_ShaderHandleSDF);
+        if (CheckShader(g_FragHandleSDF, "distance field fragment shader") && CheckProgram(g_ShaderHandleSDF, "distance field shader program"))
+        {
+            g_AttribLocationTexSDF = glGetUniformLocation(g_ShaderHandleSDF, "Texture");
+            g_AttribLocationProjMtxSDF = glGetUniformLocation(g_ShaderHandleSDF, "ProjMtx");
+        }
+        else
+        {
+            // Fallback to drawing the distance fields as regular textures
+            glDetachShader(g_ShaderHandleSDF, g_VertHandle);
+            glDetachShader(g_ShaderHandleSDF, g_FragHandleSDF);
+            glDeleteShader(g_FragHandleSDF); g_FragHandleSDF = 0;
+            glDeleteProgram(g_ShaderHandleSDF); g_ShaderHandleSDF = 0;
+        }
+    }
+
     // Create buffers
     glGenBuffers(1, &g_VboHandle);
     glGenBuffers(1, &g_ElementsHandle);
@@ -705,9 +874,13 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     if (g_ElementsHandle)   { glDeleteBuffers(1, &g_ElementsHandle); g_ElementsHandle = 0; }
     if (g_ShaderHandle && g_VertHandle) { glDetachShader(g_ShaderHandle, g_VertHandle); }
     if (g_ShaderHandle && g_FragHandle) { glDetachShader(g_ShaderHandle, g_FragHandle); }
+    if (g_ShaderHandleSDF && g_VertHandle) { glDetachShader(g_ShaderHandleSDF, g_VertHandle); }
+    if (g_ShaderHandleSDF && g_FragHandleSDF) { glDetachShader(g_ShaderHandleSDF, g_FragHandleSDF); }
     if (g_VertHandle)       { glDeleteShader(g_VertHandle); g_VertHandle = 0; }
     if (g_FragHandle)       { glDeleteShader(g_FragHandle); g_FragHandle = 0; }
+    if (g_FragHandleSDF)    { glDeleteShader(g_FragHandleSDF); g_FragHandleSDF = 0; }
     if (g_ShaderHandle)     { glDeleteProgram(g_ShaderHandle); g_ShaderHandle = 0; }
+    if (g_ShaderHandleSDF)  { glDeleteProgram(g_ShaderHandleSDF); g_ShaderHandleSDF = 0; }
 
     ImGui_ImplOpenGL3_DestroyFontsTexture();
 }
@@ -21,6 +21,11 @@
 //  On computer platform the GLSL version default to "#version 130". On OpenGL ES 3 platform it defaults to "#version 300 es"
 //  Only override if your GL version doesn't handle this GLSL version. See GLSL version table at the top of imgui_impl_opengl3.cpp.
 
+// About merging draw lists:
+//  Define IMGUI_IMPL_OPENGL_MERGE_DRAW_LISTS (in your imconfig.h or build settings) to set ImGuiBackendFlags_RendererMergeDrawLists,
+//  so Render() copies all draw lists into one and we upload a single vertex/index buffer per frame. This trades a CPU copy of every
+//  vertex/index for fewer buffer uploads, which is only a win on drivers where glBufferData() calls are expensive: measure first.
+
 #pragma once
 #include "imgui.h"      // IMGUI_IMPL_API
 
@@ -17,6 +17,7 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2020-11-06: Misc: Added ImGui_ImplSDL2_WaitForEvent() to call before polling events in applications which don't need to render every frame, honoring io.MaxWaitBeforeNextFrame.
 //  2020-05-25: Misc: Report a zero display-size when window is minimized, to be consistent with other backends.
 //  2020-02-20: Inputs: Fixed mapping for ImGuiKey_KeyPadEnter (using SDL_SCANCODE_KP_ENTER instead of SDL_SCANCODE_RETURN2).
 //  2019-12-17: Inputs: On Wayland, use SDL_GetMouseState (because there is no global mouse state).
@@ -368,3 +369,17 @@ void ImGui_ImplSDL2_NewFrame(SDL_Window* window)
     // Update game controllers (if enabled and available)
     ImGui_ImplSDL2_UpdateGamepads();
 }
+
+// Wait until an event is available or until Dear ImGui needs a new frame (io.MaxWaitBeforeNextFrame). Call before your SDL_PollEvent() loop.
+// Gamepads are polled, so they are still polled at ~60 Hz when gamepad navigation is enabled.
+void ImGui_ImplSDL2_WaitForEvent()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    float timeout = io.MaxWaitBeforeNextFrame;
+    if ((io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad) && timeout > 1.0f / 60.0f)
+        timeout = 1.0f / 60.0f;
+    if (timeout >= FLT_MAX)
+        SDL_WaitEvent(NULL);
+    else if (timeout > 0.0f)
+        SDL_WaitEventTimeout(NULL, (int)(timeout * 1000.0f) + 1); // Round up so we don't wake up too early
+}
@@ -27,3 +27,4 @@ IMGUI_IMPL_API bool     ImGui_ImplSDL2_InitForMetal(SDL_Window* window);
 IMGUI_IMPL_API void     ImGui_ImplSDL2_Shutdown();
 IMGUI_IMPL_API void     ImGui_ImplSDL2_NewFrame(SDL_Window* window);
 IMGUI_IMPL_API bool     ImGui_ImplSDL2_ProcessEvent(const SDL_Event* event);
+IMGUI_IMPL_API void     ImGui_ImplSDL2_WaitForEvent();      // Call before polling events to sleep until inputs or until Dear ImGui needs a new frame (io.MaxWaitBeforeNextFrame)
@@ -0,0 +1,858 @@
+// dear imgui: Renderer Backend for software rendering into a 32-bit pixel buffer (no GPU required)
+// This needs to be used along with a Platform Backend (e.g. GLFW, SDL, Win32, custom..), or with none at all to render headless.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Multi-threaded rasterization (requires C++11 <thread>, disable with '#define IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS').
+//  [X] Renderer: Glyphs rasterized on demand (ImFontConfig::DynamicGlyphs), the font texture being ImFontAtlas::TexPixelsRGBA32 itself.
+
+// You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+// CHANGELOG
+// (minor and older changes stripped away, please see git history for details)
+//  2020-11-20: Set ImGuiBackendFlags_RendererHasTexUpdates.
+//  2020-11-05: Added optional 'redraw_rect' parameter to ImGui_ImplSoftRaster_RenderDrawData(), to only redraw ImDrawData::DirtyRects.
+//  2020-11-02: Initial version.
+
+// How it works:
+// - Every triangle is set up on the calling thread: vertices are snapped to 1/16th of a pixel to compute integer edge functions,
+//   and the gradients of UV and color are computed with SSE2/NEON when available. Triangles are binned in 64x64 pixels tiles.
+// - Tiles are rasterized in parallel by a pool of threads. Each tile draws its triangles in submission order, so the output doesn't
+//   depend on the number of threads.
+// - Coverage is tested at pixel centers, 4 pixels at a time, with a top-left fill rule: pixels on an edge shared by two triangles are
+//   drawn once. Textures are sampled with bilinear filtering (clamped to edges) and modulated by the vertex color. Blending matches
+//   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA) on all channels, as done by the other backends.
+// - Axis aligned rectangles (glyphs, frames, window backgrounds..) are detected from their two triangles and rasterized as one primitive
+//   without edge tests. Triangles with the same UV and color on every vertex (most solid shapes use the white pixel of the font atlas)
+//   skip interpolation and sampling: opaque ones are plain fills.
+// - User callbacks are called on the calling thread, after everything submitted before them has been rasterized.
+
+#include "imgui.h"
+#include "imgui_impl_softraster.h"
+#include <math.h>       // floorf
+#include <string.h>     // memset
+
+// Enable SIMD intrinsics if available (same detection as imgui_internal.h, disable with IMGUI_DISABLE_SIMD)
+#ifndef IMGUI_DISABLE_SIMD
+#if defined(__SSE2__) || defined(__x86_64__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IMGUI_IMPL_SOFTRASTER_SSE
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define IMGUI_IMPL_SOFTRASTER_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#define SOFTRASTER_SUBPIXEL_BITS    4           // Vertices are snapped to 1/16th of a pixel
+#define SOFTRASTER_TILE_BITS        6           // 64x64 pixels tiles
+#define SOFTRASTER_MAX_SIZE         16384       // Max width and height of the framebuffer
+#define SOFTRASTER_GUARD_BAND       8192.0f     // Triangles going further than this outside of the framebuffer are clipped, so edge functions fit in 32-bit integers within a tile
+
+//-----------------------------------------------------------------------------
+// Math and SIMD helpers
+//-----------------------------------------------------------------------------
+
+template<typename T> static inline T SoftRasterMin(T a, T b)            { return a < b ? a : b; }
+template<typename T> static inline T SoftRasterMax(T a, T b)            { return a >= b ? a : b; }
+template<typename T> static inline T SoftRasterClamp(T v, T mn, T mx)   { return (v < mn) ? mn : (v > mx) ? mx : v; }
+
+// 4 floats (a RGBA color, or UV and color gradients). Every implementation performs the same IEEE operations, so does the scalar code.
+struct SoftRasterVec4
+{
+#if defined(IMGUI_IMPL_SOFTRASTER_SSE)
+    __m128          v;
+#elif defined(IMGUI_IMPL_SOFTRASTER_NEON)
+    float32x4_t     v;
+#else
+    float           v[4];
+#endif
+};
+
+// 4 signed integers (edge functions of 4 consecutive pixels)
+struct SoftRasterInt4
+{
+#if defined(IMGUI_IMPL_SOFTRASTER_SSE)
+    __m128i         v;
+#elif defined(IMGUI_IMPL_SOFTRASTER_NEON)
+    int32x4_t       v;
+#else
+    int             v[4];
+#endif
+};
+
+#if defined(IMGUI_IMPL_SOFTRASTER_SSE)
+static inline SoftRasterVec4 SoftRasterVec4_Make(__m128 v)                              { SoftRasterVec4 r; r.v = v; return r; }
+static inline SoftRasterVec4 SoftRasterVec4_Set(float x, float y, float z, float w)     { return SoftRasterVec4_Make(_mm_setr_ps(x, y, z, w)); }
+static inline SoftRasterVec4 SoftRasterVec4_Set1(float f)                               { return SoftRasterVec4_Make(_mm_set1_ps(f)); }
+static inline SoftRasterVec4 SoftRasterVec4_Load(const float* p)                        { return SoftRasterVec4_Make(_mm_loadu_ps(p)); }
+static inline void           SoftRasterVec4_Store(float* p, SoftRasterVec4 a)           { _mm_storeu_ps(p, a.v); }
+static inline float          SoftRasterVec4_GetW(SoftRasterVec4 a)                      { return _mm_cvtss_f32(_mm_shuffle_ps(a.v, a.v, _MM_SHUFFLE(3, 3, 3, 3))); }
+static inline SoftRasterVec4 operator+(SoftRasterVec4 a, SoftRasterVec4 b)              { return SoftRasterVec4_Make(_mm_add_ps(a.v, b.v)); }
+static inline SoftRasterVec4 operator-(SoftRasterVec4 a, SoftRasterVec4 b)              { return SoftRasterVec4_Make(_mm_sub_ps(a.v, b.v)); }
+static inline SoftRasterVec4 operator*(SoftRasterVec4 a, SoftRasterVec4 b)              { return SoftRasterVec4_Make(_mm_mul_ps(a.v, b.v)); }
+static inline SoftRasterVec4 SoftRasterVec4_FromColor(ImU32 c)                          { const __m128i z = _mm_setzero_si128(); return SoftRasterVec4_Make(_mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128((int)c), z), z))); }
+static inline ImU32          SoftRasterVec4_ToColor(SoftRasterVec4 a)                   { __m128i i = _mm_cvttps_epi32(_mm_add_ps(a.v, _mm_set1_ps(0.5f))); i = _mm_packs_epi32(i, i); return (ImU32)_mm_cvtsi128_si32(_mm_packus_epi16(i, i)); }
+static inline SoftRasterInt4 SoftRasterInt4_Ramp(int base, int step)                    { SoftRasterInt4 r; r.v = _mm_setr_epi32(base, base + step, base + step * 2, base + step * 3); return r; }
+static inline SoftRasterInt4 SoftRasterInt4_Add(SoftRasterInt4 a, int b)                { a.v = _mm_add_epi32(a.v, _mm_set1_epi32(b)); return a; }
+static inline int            SoftRasterInt4_InsideMask(SoftRasterInt4 a, SoftRasterInt4 b, SoftRasterInt4 c) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(_mm_or_si128(a.v, b.v), c.v))) ^ 0x0F; }
+#elif defined(IMGUI_IMPL_SOFTRASTER_NEON)
+static inline SoftRasterVec4 SoftRasterVec4_Make(float32x4_t v)                         { SoftRasterVec4 r; r.v = v; return r; }
+static inline SoftRasterVec4 SoftRasterVec4_Set(float x, float y, float z, float w)     { const float f[4] = { x, y, z, w }; return SoftRasterVec4_Make(vld1q_f32(f)); }
+static inline SoftRasterVec4 SoftRasterVec4_Set1(float f)                               { return SoftRasterVec4_Make(vdupq_n_f32(f)); }
+static inline SoftRasterVec4 SoftRasterVec4_Load(const float* p)                        { return SoftRasterVec4_Make(vld1q_f32(p)); }
+static inline void           SoftRasterVec4_Store(float* p, SoftRasterVec4 a)           { vst1q_f32(p, a.v); }
+static inline float          SoftRasterVec4_GetW(SoftRasterVec4 a)                      { return vgetq_lane_f32(a.v, 3); }
+static inline SoftRasterVec4 operator+(SoftRasterVec4 a, SoftRasterVec4 b)              { return SoftRasterVec4_Make(vaddq_f32(a.v, b.v)); }
+static inline SoftRasterVec4 operator-(SoftRasterVec4 a, SoftRasterVec4 b)              { return SoftRasterVec4_Make(vsubq_f32(a.v, b.v)); }
+static inline SoftRasterVec4 operator*(SoftRasterVec4 a, SoftRasterVec4 b)              { return SoftRasterVec4_Make(vmulq_f32(a.v, b.v)); }
+static inline SoftRasterVec4 SoftRasterVec4_FromColor(ImU32 c)                          { return SoftRasterVec4_Make(vcvtq_f32_u32(vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(c))))))); }
+static inline ImU32          SoftRasterVec4_ToColor(SoftRasterVec4 a)                   { const uint16x4_t h = vqmovn_u32(vcvtq_u32_f32(vaddq_f32(a.v, vdupq_n_f32(0.5f)))); return vget_lane_u32(vreinterpret_u32_u8(vqmovn_u16(vcombine_u16(h, h))), 0); }
+static inline SoftRasterInt4 SoftRasterInt4_Ramp(int base, int step)                    { const int i[4] = { base, base + step, base + step * 2, base + step * 3 }; SoftRasterInt4 r; r.v = vld1q_s32(i); return r; }
+static inline SoftRasterInt4 SoftRasterInt4_Add(SoftRasterInt4 a, int b)                { a.v = vaddq_s32(a.v, vdupq_n_s32(b)); return a; }
+static inline int            SoftRasterInt4_InsideMask(SoftRasterInt4 a, SoftRasterInt4 b, SoftRasterInt4 c)
+{
+    static const uint32_t lane_bits[4] = { 1, 2, 4, 8 };
+    const uint32x4_t sign = vshrq_n_u32(vreinterpretq_u32_s32(vorrq_s32(vorrq_s32(a.v, b.v), c.v)), 31);
+    return (int)vaddvq_u32(vmulq_u32(sign, vld1q_u32(lane_bits))) ^ 0x0F;
+}
+#else
+static inline SoftRasterVec4 SoftRasterVec4_Set(float x, float y, float z, float w)     { SoftRasterVec4 r; r.v[0] = x; r.v[1] = y; r.v[2] = z; r.v[3] = w; return r; }
+static inline SoftRasterVec4 SoftRasterVec4_Set1(float f)                               { return SoftRasterVec4_Set(f, f, f, f); }
+static inline SoftRasterVec4 SoftRasterVec4_Load(const float* p)                        { return SoftRasterVec4_Set(p[0], p[1], p[2], p[3]); }
+static inline void           SoftRasterVec4_Store(float* p, SoftRasterVec4 a)           { p[0] = a.v[0]; p[1] = a.v[1]; p[2] = a.v[2]; p[3] = a.v[3]; }
+static inline float          SoftRasterVec4_GetW(SoftRasterVec4 a)                      { return a.v[3]; }
+static inline SoftRasterVec4 operator+(SoftRasterVec4 a, SoftRasterVec4 b)              { return SoftRasterVec4_Set(a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]); }
+static inline SoftRasterVec4 operator-(SoftRasterVec4 a, SoftRasterVec4 b)              { return SoftRasterVec4_Set(a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]); }
+static inline SoftRasterVec4 operator*(SoftRasterVec4 a, SoftRasterVec4 b)              { return SoftRasterVec4_Set(a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]); }
+static inline SoftRasterVec4 SoftRasterVec4_FromColor(ImU32 c)                          { return SoftRasterVec4_Set((float)(c & 0xFF), (float)((c >> 8) & 0xFF), (float)((c >> 16) & 0xFF), (float)(c >> 24)); }
+static inline ImU32          SoftRasterVec4_ToColor(SoftRasterVec4 a)
+{
+    ImU32 c = 0;
+    for (int n = 0; n < 4; n++)
+    {
+        const int i = (int)(a.v[n] + 0.5f);
+        c |= (ImU32)(i < 0 ? 0 : i > 255 ? 255 : i) << (n * 8);
+    }
+    return c;
+}
+static inline SoftRasterInt4 SoftRasterInt4_Ramp(int base, int step)                    { SoftRasterInt4 r; for (int n = 0; n < 4; n++) r.v[n] = base + step * n; return r; }
+static inline SoftRasterInt4 SoftRasterInt4_Add(SoftRasterInt4 a, int b)                { for (int n = 0; n < 4; n++) a.v[n] += b; return a; }
+static inline int            SoftRasterInt4_InsideMask(SoftRasterInt4 a, SoftRasterInt4 b, SoftRasterInt4 c)
+{
+    int mask = 0;
+    for (int n = 0; n < 4; n++)
+        if ((a.v[n] | b.v[n] | c.v[n]) >= 0)
+            mask |= 1 << n;
+    return mask;
+}
+#endif
+
+//-----------------------------------------------------------------------------
+// Data
+//-----------------------------------------------------------------------------
+
+enum SoftRasterMode_
+{
+    SoftRasterMode_Shade,   // Interpolate UV and/or color
+    SoftRasterMode_Blend,   // Constant source color
+    SoftRasterMode_Fill     // Constant opaque source color
+};
+
+// Triangle set up for rasterization
+struct SoftRasterTriangle
+{
+    int                     MinX, MinY, MaxX, MaxY;     // Pixels to test: bounding box intersected with the clipping rectangle (Max is exclusive)
+    int                     EdgeA[3], EdgeB[3];         // Edge functions E = A * X + B * Y + C, in 1/16th of pixels. Pixel centers where the 3 edge functions are >= 0 are covered
+    ImS64                   EdgeC[3];
+    float                   UV[4], UVdX[4], UVdY[4];    // Plane equations at pixel centers: V(x, y) = V + VdX * x + VdY * y. Only the first two components of UV are used
+    float                   Col[4], ColdX[4], ColdY[4]; // Vertex color, 0..255 range
+    float                   Texel[4];                   // Sampled texel when ConstUV
+    float                   Src[4];                     // Texel * color when ConstUV && ConstCol
+    ImU32                   SrcColor;                   // Src for SoftRasterMode_Fill
+    const ImGui_ImplSoftRaster_Texture* Texture;
+    bool                    ConstUV, ConstCol;          // UV/color are the same on every vertex: skip interpolation
+    int                     Mode;                       // SoftRasterMode_
+};
+
+// Font texture
+static ImGui_ImplSoftRaster_Texture g_FontTexture = { NULL, 0, 0 };
+
+// Current target and triangles waiting to be rasterized
+static unsigned int*                g_TargetPixels = NULL;
+static int                          g_TargetPitch = 0;          // In pixels
+static int                          g_TargetWidth = 0;
+static int                          g_TargetHeight = 0;
+static int                          g_TilesCountX = 0;
+static int                          g_TilesCountY = 0;
+static ImVector<SoftRasterTriangle> g_Triangles;
+static ImVector<int>                g_TileTriangles;            // Indices of the triangles overlapping each tile, tile after tile, in submission order
+static ImVector<int>                g_TileOffsets;              // Start of each tile in g_TileTriangles (tiles count + 1 entries)
+
+// Threads
+static int                          g_ThreadsCount = 1;
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+static std::thread*                 g_Threads = NULL;           // g_ThreadsCount - 1 worker threads, the calling thread rasterizes too
+static std::mutex                   g_JobMutex;
+static std::condition_variable      g_JobStartCond;
+static std::condition_variable      g_JobDoneCond;
+static int                          g_JobGeneration = 0;        // Incremented to wake up workers
+static int                          g_JobPendingWorkers = 0;
+static bool                         g_JobQuit = false;
+static std::atomic<int>             g_JobNextTile(0);
+#else
+static int                          g_JobNextTile = 0;
+#endif
+
+//-----------------------------------------------------------------------------
+// Rasterization
+//-----------------------------------------------------------------------------
+
+static inline SoftRasterVec4 ImGui_ImplSoftRaster_SampleBilinear(const ImGui_ImplSoftRaster_Texture* tex, float u, float v)
+{
+    // Texel centers are at half-integer coordinates. Clamp before converting to integer: UV may be far outside of 0..1 (or NaN)
+    const int w = tex->Width, h = tex->Height;
+    float tx = u * (float)w - 0.5f;
+    float ty = v * (float)h - 0.5f;
+    tx = (tx > -1.0f) ? (tx < (float)w ? tx : (float)w) : -1.0f;
+    ty = (ty > -1.0f) ? (ty < (float)h ? ty : (float)h) : -1.0f;
+    int x0 = (int)tx, y0 = (int)ty;
+    if ((float)x0 > tx) x0--;
+    if ((float)y0 > ty) y0--;
+    const SoftRasterVec4 fx = SoftRasterVec4_Set1(tx - (float)x0);
+    const SoftRasterVec4 fy = SoftRasterVec4_Set1(ty - (float)y0);
+    int x1 = x0 + 1, y1 = y0 + 1;
+    x0 = (x0 < 0) ? 0 : x0; x1 = (x1 >= w) ? w - 1 : x1;
+    y0 = (y0 < 0) ? 0 : y0; y1 = (y1 >= h) ? h - 1 : y1;
+    x0 = (x0 >= w) ? w - 1 : x0;
+    y0 = (y0 >= h) ? h - 1 : y0;
+
+    const unsigned int* row0 = tex->Pixels + y0 * w;
+    const unsigned int* row1 = tex->Pixels + y1 * w;
+    const SoftRasterVec4 t00 = SoftRasterVec4_FromColor(row0[x0]), t10 = SoftRasterVec4_FromColor(row0[x1]);
+    const SoftRasterVec4 t01 = SoftRasterVec4_FromColor(row1[x0]), t11 = SoftRasterVec4_FromColor(row1[x1]);
+    const SoftRasterVec4 top = t00 + (t10 - t00) * fx;
+    const SoftRasterVec4 bottom = t01 + (t11 - t01) * fx;
+    return top + (bottom - top) * fy;
+}
+
+// src: texel * color, in 0..255 range
+static inline void ImGui_ImplSoftRaster_BlendPixel(unsigned int* dst, SoftRasterVec4 src)
+{
+    const float a = SoftRasterVec4_GetW(src) * (1.0f / 255.0f);
+    if (a <= 0.0f)
+        return;
+    *dst = SoftRasterVec4_ToColor(src * SoftRasterVec4_Set1(a) + SoftRasterVec4_FromColor(*dst) * SoftRasterVec4_Set1(1.0f - a));
+}
+
+// Interpolated attributes at the start of a row
+struct SoftRasterRow
+{
+    float           U, V;
+    SoftRasterVec4  Col;
+};
+
+static inline void ImGui_ImplSoftRaster_SetupRow(const SoftRasterTriangle* tri, int y, SoftRasterRow* row)
+{
+    const float py = (float)y + 0.5f;
+    row->U = tri->UV[0] + tri->UVdY[0] * py;
+    row->V = tri->UV[1] + tri->UVdY[1] * py;
+    row->Col = SoftRasterVec4_Load(tri->Col) + SoftRasterVec4_Load(tri->ColdY) * SoftRasterVec4_Set1(py);
+}
+
+static inline void ImGui_ImplSoftRaster_ShadePixel(const SoftRasterTriangle* tri, const SoftRasterRow* row, int x, unsigned int* dst)
+{
+    if (tri->Mode == SoftRasterMode_Fill)
+    {
+        *dst = tri->SrcColor;
+        return;
+    }
+    if (tri->Mode == SoftRasterMode_Blend)
+    {
+        ImGui_ImplSoftRaster_BlendPixel(dst, SoftRasterVec4_Load(tri->Src));
+        return;
+    }
+    const float px = (float)x + 0.5f;
+    const SoftRasterVec4 texel = tri->ConstUV ? SoftRasterVec4_Load(tri->Texel) : ImGui_ImplSoftRaster_SampleBilinear(tri->Texture, row->U + tri->UVdX[0] * px, row->V + tri->UVdX[1] * px);
+    const SoftRasterVec4 col = tri->ConstCol ? SoftRasterVec4_Load(tri->Col) : row->Col + SoftRasterVec4_Load(tri->ColdX) * SoftRasterVec4_Set1(px);
+    ImGui_ImplSoftRaster_BlendPixel(dst, texel * col * SoftRasterVec4_Set1(1.0f / 255.0f));
+}
+
+// Rasterize the part of a triangle within a rectangle of pixels (x1/y1 exclusive)
+static void ImGui_ImplSoftRaster_RasterizeTriangle(const SoftRasterTriangle* tri, int x0, int y0, int x1, int y1)
+{
+    // Evaluate edge functions at the corners of the rectangle (in 64-bit). Edges leaving the whole rectangle inside are ignored,
+    // the others cross the rectangle so their values within it fit in 32-bit integers.
+    const int half_pixel = 1 << (SOFTRASTER_SUBPIXEL_BITS - 1);
+    const ImS64 span_x = (ImS64)(x1 - 1 - x0) << SOFTRASTER_SUBPIXEL_BITS;
+    const ImS64 span_y = (ImS64)(y1 - 1 - y0) << SOFTRASTER_SUBPIXEL_BITS;
+    int edge_row[3], edge_dx[3], edge_dy[3];
+    bool partial = false;
+    for (int e = 0; e < 3; e++)
+    {
+        const ImS64 a = tri->EdgeA[e];
+        const ImS64 b = tri->EdgeB[e];
+        const ImS64 e00 = a * (((ImS64)x0 << SOFTRASTER_SUBPIXEL_BITS) + half_pixel) + b * (((ImS64)y0 << SOFTRASTER_SUBPIXEL_BITS) + half_pixel) + tri->EdgeC[e];
+        const ImS64 e_max = e00 + (a > 0 ? a * span_x : 0) + (b > 0 ? b * span_y : 0);
+        const ImS64 e_min = e00 + (a < 0 ? a * span_x : 0) + (b < 0 ? b * span_y : 0);
+        if (e_max < 0)
+            return;
+        if (e_min >= 0)
+        {
+            edge_row[e] = edge_dx[e] = edge_dy[e] = 0;
+            continue;
+        }
+        edge_row[e] = (int)e00;
+        edge_dx[e] = (int)(a << SOFTRASTER_SUBPIXEL_BITS);
+        edge_dy[e] = (int)(b << SOFTRASTER_SUBPIXEL_BITS);
+        partial = true;
+    }
+
+    SoftRasterRow row;
+    unsigned int* dst_row = g_TargetPixels + y0 * g_TargetPitch;
+    for (int y = y0; y < y1; y++, dst_row += g_TargetPitch)
+    {
+        ImGui_ImplSoftRaster_SetupRow(tri, y, &row);
+        if (!partial)
+        {
+            if (tri->Mode == SoftRasterMode_Fill)
+            {
+                for (int x = x0; x < x1; x++)
+                    dst_row[x] = tri->SrcColor;
+            }
+            else
+            {
+                for (int x = x0; x < x1; x++)
+                    ImGui_ImplSoftRaster_ShadePixel(tri, &row, x, &dst_row[x]);
+            }
+            continue;
+        }
+
+        // Test 4 pixels at a time
+        SoftRasterInt4 e0 = SoftRasterInt4_Ramp(edge_row[0], edge_dx[0]);
+        SoftRasterInt4 e1 = SoftRasterInt4_Ramp(edge_row[1], edge_dx[1]);
+        SoftRasterInt4 e2 = SoftRasterInt4_Ramp(edge_row[2], edge_dx[2]);
+        for (int x = x0; x < x1; x += 4)
+        {
+            int mask = SoftRasterInt4_InsideMask(e0, e1, e2);
+            if (x + 4 > x1)
+                mask &= (1 << (x1 - x)) - 1;
+            for (int n = 0; mask != 0; n++, mask >>= 1)
+                if (mask & 1)
+                    ImGui_ImplSoftRaster_ShadePixel(tri, &row, x + n, &dst_row[x + n]);
+            e0 = SoftRasterInt4_Add(e0, edge_dx[0] * 4);
+            e1 = SoftRasterInt4_Add(e1, edge_dx[1] * 4);
+            e2 = SoftRasterInt4_Add(e2, edge_dx[2] * 4);
+        }
+        edge_row[0] += edge_dy[0];
+        edge_row[1] += edge_dy[1];
+        edge_row[2] += edge_dy[2];
+    }
+}
+
+static void ImGui_ImplSoftRaster_RasterizeTile(int tile_n)
+{
+    const int tile_size = 1 << SOFTRASTER_TILE_BITS;
+    const int tile_x0 = (tile_n % g_TilesCountX) * tile_size;
+    const int tile_y0 = (tile_n / g_TilesCountX) * tile_size;
+    const int tile_x1 = (tile_x0 + tile_size < g_TargetWidth) ? tile_x0 + tile_size : g_TargetWidth;
+    const int tile_y1 = (tile_y0 + tile_size < g_TargetHeight) ? tile_y0 + tile_size : g_TargetHeight;
+    for (int n = g_TileOffsets[tile_n]; n < g_TileOffsets[tile_n + 1]; n++)
+    {
+        const SoftRasterTriangle* tri = &g_Triangles[g_TileTriangles[n]];
+        ImGui_ImplSoftRaster_RasterizeTriangle(tri,
+            (tri->MinX > tile_x0) ? tri->MinX : tile_x0, (tri->MinY > tile_y0) ? tri->MinY : tile_y0,
+            (tri->MaxX < tile_x1) ? tri->MaxX : tile_x1, (tri->MaxY < tile_y1) ? tri->MaxY : tile_y1);
+    }
+}
+
+// Called by every thread: grab tiles until none are left
+static void ImGui_ImplSoftRaster_RasterizeTiles()
+{
+    const int tiles_count = g_TilesCountX * g_TilesCountY;
+    for (;;)
+    {
+        const int tile_n = g_JobNextTile++;
+        if (tile_n >= tiles_count)
+            break;
+        ImGui_ImplSoftRaster_RasterizeTile(tile_n);
+    }
+}
+
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+static void ImGui_ImplSoftRaster_WorkerThread(int generation)
+{
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(g_JobMutex);
+            while (!g_JobQuit && g_JobGeneration == generation)
+                g_JobStartCond.wait(lock);
+            if (g_JobQuit)
+                return;
+            generation = g_JobGeneration;
+        }
+        ImGui_ImplSoftRaster_RasterizeTiles();
+        {
+            std::lock_guard<std::mutex> lock(g_JobMutex);
+            if (--g_JobPendingWorkers == 0)
+                g_JobDoneCond.notify_one();
+        }
+    }
+}
+
+static void ImGui_ImplSoftRaster_StopThreads()
+{
+    if (g_Threads == NULL)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(g_JobMutex);
+        g_JobQuit = true;
+    }
+    g_JobStartCond.notify_all();
+    for (int n = 0; n < g_ThreadsCount - 1; n++)
+        g_Threads[n].join();
+    delete[] g_Threads;
+    g_Threads = NULL;
+    g_JobQuit = false;
+}
+#endif
+
+// Bin pending triangles into tiles and rasterize them
+static void ImGui_ImplSoftRaster_Flush()
+{
+    if (g_Triangles.Size == 0)
+        return;
+
+    // Count triangles per tile, then fill the tile lists in submission order
+    const int tiles_count = g_TilesCountX * g_TilesCountY;
+    g_TileOffsets.resize(tiles_count + 1);
+    memset(g_TileOffsets.Data, 0, (size_t)g_TileOffsets.size_in_bytes());
+    for (int tri_n = 0; tri_n < g_Triangles.Size; tri_n++)
+    {
+        const SoftRasterTriangle& tri = g_Triangles[tri_n];
+        for (int ty = tri.MinY >> SOFTRASTER_TILE_BITS; ty <= (tri.MaxY - 1) >> SOFTRASTER_TILE_BITS; ty++)
+            for (int tx = tri.MinX >> SOFTRASTER_TILE_BITS; tx <= (tri.MaxX - 1) >> SOFTRASTER_TILE_BITS; tx++)
+                g_TileOffsets[ty * g_TilesCountX + tx + 1]++;
+    }
+    for (int tile_n = 0; tile_n < tiles_count; tile_n++)
+        g_TileOffsets[tile_n + 1] += g_TileOffsets[tile_n];
+    g_TileTriangles.resize(g_TileOffsets[tiles_count]);
+    for (int tri_n = 0; tri_n < g_Triangles.Size; tri_n++)
+    {
+        const SoftRasterTriangle& tri = g_Triangles[tri_n];
+        for (int ty = tri.MinY >> SOFTRASTER_TILE_BITS; ty <= (tri.MaxY - 1) >> SOFTRASTER_TILE_BITS; ty++)
+            for (int tx = tri.MinX >> SOFTRASTER_TILE_BITS; tx <= (tri.MaxX - 1) >> SOFTRASTER_TILE_BITS; tx++)
+                g_TileTriangles[g_TileOffsets[ty * g_TilesCountX + tx]++] = tri_n;
+    }
+    for (int tile_n = tiles_count; tile_n > 0; tile_n--) // Filling moved every offset to the start of the next tile
+        g_TileOffsets[tile_n] = g_TileOffsets[tile_n - 1];
+    g_TileOffsets[0] = 0;
+
+    g_JobNextTile = 0;
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+    if (g_Threads != NULL)
+    {
+        {
+            std::lock_guard<std::mutex> lock(g_JobMutex);
+            g_JobPendingWorkers = g_ThreadsCount - 1;
+            g_JobGeneration++;
+        }
+        g_JobStartCond.notify_all();
+        ImGui_ImplSoftRaster_RasterizeTiles();
+        std::unique_lock<std::mutex> lock(g_JobMutex);
+        while (g_JobPendingWorkers > 0)
+            g_JobDoneCond.wait(lock);
+    }
+    else
+#endif
+    {
+        ImGui_ImplSoftRaster_RasterizeTiles();
+    }
+    g_Triangles.resize(0);
+}
+
+//-----------------------------------------------------------------------------
+// Triangle setup
+//-----------------------------------------------------------------------------
+
+// Clip a convex polygon against an axis aligned line (Sutherland-Hodgman), keeping points where sign * (p[axis] - limit) <= 0
+static int ImGui_ImplSoftRaster_ClipPolygon(const ImVec2* in, int in_count, ImVec2* out, int axis, float sign, float limit)
+{
+    int out_count = 0;
+    for (int i = 0; i < in_count; i++)
+    {
+        const ImVec2& a = in[i];
+        const ImVec2& b = in[(i + 1 == in_count) ? 0 : i + 1];
+        const float da = sign * ((axis == 0 ? a.x : a.y) - limit);
+        const float db = sign * ((axis == 0 ? b.x : b.y) - limit);
+        if (da <= 0.0f)
+            out[out_count++] = a;
+        if ((da <= 0.0f) != (db <= 0.0f))
+        {
+            const float t = da / (da - db);
+            out[out_count++] = ImVec2(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t);
+        }
+    }
+    return out_count;
+}
+
+// Snap vertices, compute edge functions and queue a copy of 'tmpl' (which holds the attribute planes)
+static void ImGui_ImplSoftRaster_AddTriangle(const SoftRasterTriangle& tmpl, const ImVec2& p0, const ImVec2& p1, const ImVec2& p2, const int scissor[4])
+{
+    const float subpixels = (float)(1 << SOFTRASTER_SUBPIXEL_BITS);
+    int x[3] = { (int)floorf(p0.x * subpixels + 0.5f), (int)floorf(p1.x * subpixels + 0.5f), (int)floorf(p2.x * subpixels + 0.5f) };
+    int y[3] = { (int)floorf(p0.y * subpixels + 0.5f), (int)floorf(p1.y * subpixels + 0.5f), (int)floorf(p2.y * subpixels + 0.5f) };
+    const ImS64 area = (ImS64)(x[1] - x[0]) * (y[2] - y[0]) - (ImS64)(x[2] - x[0]) * (y[1] - y[0]);
+    if (area == 0)
+        return;
+    if (area < 0)
+    {
+        int tmp;
+        tmp = x[1]; x[1] = x[2]; x[2] = tmp;
+        tmp = y[1]; y[1] = y[2]; y[2] = tmp;
+    }
+
+    // Pixels whose center may be covered
+    const int half_pixel = 1 << (SOFTRASTER_SUBPIXEL_BITS - 1);
+    const int min_x = SoftRasterMin(x[0], SoftRasterMin(x[1], x[2])), max_x = SoftRasterMax(x[0], SoftRasterMax(x[1], x[2]));
+    const int min_y = SoftRasterMin(y[0], SoftRasterMin(y[1], y[2])), max_y = SoftRasterMax(y[0], SoftRasterMax(y[1], y[2]));
+    const int px0 = SoftRasterMax(scissor[0], (min_x - half_pixel) >> SOFTRASTER_SUBPIXEL_BITS);
+    const int py0 = SoftRasterMax(scissor[1], (min_y - half_pixel) >> SOFTRASTER_SUBPIXEL_BITS);
+    const int px1 = SoftRasterMin(scissor[2], ((max_x - half_pixel) >> SOFTRASTER_SUBPIXEL_BITS) + 1);
+    const int py1 = SoftRasterMin(scissor[3], ((max_y - half_pixel) >> SOFTRASTER_SUBPIXEL_BITS) + 1);
+    if (px0 >= px1 || py0 >= py1)
+        return;
+
+    g_Triangles.resize(g_Triangles.Size + 1);
+    SoftRasterTriangle& tri = g_Triangles.back();
+    tri = tmpl;
+    tri.MinX = px0;
+    tri.MinY = py0;
+    tri.MaxX = px1;
+    tri.MaxY = py1;
+    for (int e = 0; e < 3; e++)
+    {
+        // Top-left rule: pixel centers exactly on an edge are only covered for top or left edges, so they are drawn once when the edge is
+        // shared by two triangles (the functions of a shared edge are exactly opposite).
+        const int i = e, j = (e == 2) ? 0 : e + 1;
+        const int a = y[i] - y[j];
+        const int b = x[j] - x[i];
+        tri.EdgeA[e] = a;
+        tri.EdgeB[e] = b;
+        tri.EdgeC[e] = -(ImS64)a * x[i] - (ImS64)b * y[i];
+        if (!(a > 0 || (a == 0 && b > 0)))
+            tri.EdgeC[e] -= 1;
+    }
+}
+
+// Queue an axis aligned rectangle covering the pixel centers within [p_min, p_max). Edge functions are all zero (always inside).
+static void ImGui_ImplSoftRaster_AddRectangle(const SoftRasterTriangle& tmpl, const ImVec2& p_min, const ImVec2& p_max, const int scissor[4])
+{
+    const float subpixels = (float)(1 << SOFTRASTER_SUBPIXEL_BITS);
+    const float guard_x0 = -SOFTRASTER_GUARD_BAND, guard_x1 = (float)g_TargetWidth + SOFTRASTER_GUARD_BAND;
+    const float guard_y0 = -SOFTRASTER_GUARD_BAND, guard_y1 = (float)g_TargetHeight + SOFTRASTER_GUARD_BAND;
+    const int half_pixel = 1 << (SOFTRASTER_SUBPIXEL_BITS - 1);
+    const int min_x = (int)floorf(SoftRasterClamp(p_min.x, guard_x0, guard_x1) * subpixels + 0.5f), max_x = (int)floorf(SoftRasterClamp(p_max.x, guard_x0, guard_x1) * subpixels + 0.5f);
+    const int min_y = (int)floorf(SoftRasterClamp(p_min.y, guard_y0, guard_y1) * subpixels + 0.5f), max_y = (int)floorf(SoftRasterClamp(p_max.y, guard_y0, guard_y1) * subpixels + 0.5f);
+    const int px0 = SoftRasterMax(scissor[0], (min_x - half_pixel + (1 << SOFTRASTER_SUBPIXEL_BITS) - 1) >> SOFTRASTER_SUBPIXEL_BITS);
+    const int py0 = SoftRasterMax(scissor[1], (min_y - half_pixel + (1 << SOFTRASTER_SUBPIXEL_BITS) - 1) >> SOFTRASTER_SUBPIXEL_BITS);
+    const int px1 = SoftRasterMin(scissor[2], (max_x - half_pixel + (1 << SOFTRASTER_SUBPIXEL_BITS) - 1) >> SOFTRASTER_SUBPIXEL_BITS);
+    const int py1 = SoftRasterMin(scissor[3], (max_y - half_pixel + (1 << SOFTRASTER_SUBPIXEL_BITS) - 1) >> SOFTRASTER_SUBPIXEL_BITS);
+    if (px0 >= px1 || py0 >= py1)
+        return;
+
+    g_Triangles.resize(g_Triangles.Size + 1);
+    SoftRasterTriangle& tri = g_Triangles.back();
+    tri = tmpl;
+    tri.MinX = px0;
+    tri.MinY = py0;
+    tri.MaxX = px1;
+    tri.MaxY = py1;
+    for (int e = 0; e < 3; e++)
+    {
+        tri.EdgeA[e] = tri.EdgeB[e] = 0;
+        tri.EdgeC[e] = 0;
+    }
+}
+
+// Return true when the quad (v0, v1, v2) (v0, v2, v3) is an axis aligned rectangle with attributes varying linearly along its sides,
+// as output by ImDrawList::PrimRect(), PrimRectUV() and AddRectFilledMultiColor() for horizontal/vertical gradients.
+// The attribute planes of the first triangle are then exact over the whole rectangle.
+static bool ImGui_ImplSoftRaster_IsRectangle(const ImDrawVert& v0, const ImDrawVert& v1, const ImDrawVert& v2, const ImDrawVert& v3)
+{
+    const bool pos_ok = (v0.pos.y == v1.pos.y && v1.pos.x == v2.pos.x && v2.pos.y == v3.pos.y && v3.pos.x == v0.pos.x) || (v0.pos.x == v1.pos.x && v1.pos.y == v2.pos.y && v2.pos.x == v3.pos.x && v3.pos.y == v0.pos.y);
+    const bool u_ok = (v1.uv.x == v0.uv.x && v3.uv.x == v2.uv.x) || (v1.uv.x == v2.uv.x && v3.uv.x == v0.uv.x);
+    const bool v_ok = (v1.uv.y == v0.uv.y && v3.uv.y == v2.uv.y) || (v1.uv.y == v2.uv.y && v3.uv.y == v0.uv.y);
+    const bool col_ok = (v1.col == v0.col && v3.col == v2.col) || (v1.col == v2.col && v3.col == v0.col);
+    return pos_ok && u_ok && v_ok && col_ok;
+}
+
+// Set up the triangle (v0, v1, v2), or the rectangle (v0, v1, v2) (v0, v2, v3) when v3 is not NULL (see ImGui_ImplSoftRaster_IsRectangle)
+static void ImGui_ImplSoftRaster_SetupTriangle(const ImDrawVert& v0, const ImDrawVert& v1, const ImDrawVert& v2, const ImDrawVert* v3, const ImVec2& pos_offset, const ImVec2& pos_scale, const int scissor[4], const ImGui_ImplSoftRaster_Texture* tex)
+{
+    const ImVec2 pos[3] =
+    {
+        ImVec2(((float)v0.pos.x - pos_offset.x) * pos_scale.x, ((float)v0.pos.y - pos_offset.y) * pos_scale.y),
+        ImVec2(((float)v1.pos.x - pos_offset.x) * pos_scale.x, ((float)v1.pos.y - pos_offset.y) * pos_scale.y),
+        ImVec2(((float)v2.pos.x - pos_offset.x) * pos_scale.x, ((float)v2.pos.y - pos_offset.y) * pos_scale.y)
+    };
+    const float min_x = SoftRasterMin(pos[0].x, SoftRasterMin(pos[1].x, pos[2].x)), max_x = SoftRasterMax(pos[0].x, SoftRasterMax(pos[1].x, pos[2].x));
+    const float min_y = SoftRasterMin(pos[0].y, SoftRasterMin(pos[1].y, pos[2].y)), max_y = SoftRasterMax(pos[0].y, SoftRasterMax(pos[1].y, pos[2].y));
+    if (!(max_x >= (float)scissor[0] - 1.0f && min_x <= (float)scissor[2] + 1.0f && max_y >= (float)scissor[1] - 1.0f && min_y <= (float)scissor[3] + 1.0f)) // Also rejects NaN
+        return;
+    if (!(max_x - min_x < 1e30f && max_y - min_y < 1e30f)) // Infinite
+        return;
+
+    // Attribute planes. Computed from the unclipped triangle, with positions relative to the first vertex
+    SoftRasterTriangle tmpl;
+    const float d1x = pos[1].x - pos[0].x, d1y = pos[1].y - pos[0].y;
+    const float d2x = pos[2].x - pos[0].x, d2y = pos[2].y - pos[0].y;
+    const float det = d1x * d2y - d2x * d1y;
+    const SoftRasterVec4 inv_det = SoftRasterVec4_Set1(det != 0.0f ? 1.0f / det : 0.0f);
+    const SoftRasterVec4 k_d1x = SoftRasterVec4_Set1(d1x), k_d1y = SoftRasterVec4_Set1(d1y), k_d2x = SoftRasterVec4_Set1(d2x), k_d2y = SoftRasterVec4_Set1(d2y);
+    const SoftRasterVec4 k_p0x = SoftRasterVec4_Set1(pos[0].x), k_p0y = SoftRasterVec4_Set1(pos[0].y);
+    {
+        const SoftRasterVec4 uv0 = SoftRasterVec4_Set((float)v0.uv.x, (float)v0.uv.y, 0.0f, 0.0f);
+        const SoftRasterVec4 uv10 = SoftRasterVec4_Set((float)v1.uv.x, (float)v1.uv.y, 0.0f, 0.0f) - uv0;
+        const SoftRasterVec4 uv20 = SoftRasterVec4_Set((float)v2.uv.x, (float)v2.uv.y, 0.0f, 0.0f) - uv0;
+        const SoftRasterVec4 uv_dx = (uv10 * k_d2y - uv20 * k_d1y) * inv_det;
+        const SoftRasterVec4 uv_dy = (uv20 * k_d1x - uv10 * k_d2x) * inv_det;
+        SoftRasterVec4_Store(tmpl.UV, uv0 - uv_dx * k_p0x - uv_dy * k_p0y);
+        SoftRasterVec4_Store(tmpl.UVdX, uv_dx);
+        SoftRasterVec4_Store(tmpl.UVdY, uv_dy);
+    }
+    {
+        const SoftRasterVec4 col0 = SoftRasterVec4_FromColor(v0.col);
+        const SoftRasterVec4 col10 = SoftRasterVec4_FromColor(v1.col) - col0;
+        const SoftRasterVec4 col20 = SoftRasterVec4_FromColor(v2.col) - col0;
+        const SoftRasterVec4 col_dx = (col10 * k_d2y - col20 * k_d1y) * inv_det;
+        const SoftRasterVec4 col_dy = (col20 * k_d1x - col10 * k_d2x) * inv_det;
+        SoftRasterVec4_Store(tmpl.Col, col0 - col_dx * k_p0x - col_dy * k_p0y);
+        SoftRasterVec4_Store(tmpl.ColdX, col_dx);
+        SoftRasterVec4_Store(tmpl.ColdY, col_dy);
+    }
+
+    // With constant attributes, gradients are zero and the planes evaluate to the vertex values everywhere
+    tmpl.Texture = tex;
+    tmpl.ConstUV = (v0.uv.x == v1.uv.x && v0.uv.x == v2.uv.x && v0.uv.y == v1.uv.y && v0.uv.y == v2.uv.y) && (!v3 || (v3->uv.x == v0.uv.x && v3->uv.y == v0.uv.y));
+    tmpl.ConstCol = (v0.col == v1.col && v0.col == v2.col) && (!v3 || v3->col == v0.col);
+    tmpl.Mode = SoftRasterMode_Shade;
+    if (tmpl.ConstUV)
+        SoftRasterVec4_Store(tmpl.Texel, ImGui_ImplSoftRaster_SampleBilinear(tex, tmpl.UV[0], tmpl.UV[1]));
+    if (tmpl.ConstUV && tmpl.ConstCol)
+    {
+        const SoftRasterVec4 src = SoftRasterVec4_Load(tmpl.Texel) * SoftRasterVec4_Load(tmpl.Col) * SoftRasterVec4_Set1(1.0f / 255.0f);
+        const float a = SoftRasterVec4_GetW(src) * (1.0f / 255.0f);
+        if (a <= 0.0f)
+            return;
+        SoftRasterVec4_Store(tmpl.Src, src);
+        tmpl.SrcColor = SoftRasterVec4_ToColor(src);
+        tmpl.Mode = (a == 1.0f) ? SoftRasterMode_Fill : SoftRasterMode_Blend;
+    }
+
+    if (v3)
+    {
+        ImGui_ImplSoftRaster_AddRectangle(tmpl, ImVec2(min_x, min_y), ImVec2(max_x, max_y), scissor);
+        return;
+    }
+
+    // Clip triangles going too far outside of the framebuffer
+    const float guard_x0 = -SOFTRASTER_GUARD_BAND, guard_x1 = (float)g_TargetWidth + SOFTRASTER_GUARD_BAND;
+    const float guard_y0 = -SOFTRASTER_GUARD_BAND, guard_y1 = (float)g_TargetHeight + SOFTRASTER_GUARD_BAND;
+    if (min_x >= guard_x0 && max_x <= guard_x1 && min_y >= guard_y0 && max_y <= guard_y1)
+    {
+        ImGui_ImplSoftRaster_AddTriangle(tmpl, pos[0], pos[1], pos[2], scissor);
+        return;
+    }
+    ImVec2 poly_a[8], poly_b[8];
+    int count = ImGui_ImplSoftRaster_ClipPolygon(pos, 3, poly_a, 0, -1.0f, guard_x0);
+    count = ImGui_ImplSoftRaster_ClipPolygon(poly_a, count, poly_b, 0, +1.0f, guard_x1);
+    count = ImGui_ImplSoftRaster_ClipPolygon(poly_b, count, poly_a, 1, -1.0f, guard_y0);
+    count = ImGui_ImplSoftRaster_ClipPolygon(poly_a, count, poly_b, 1, +1.0f, guard_y1);
+    for (int n = 2; n < count; n++)
+        ImGui_ImplSoftRaster_AddTriangle(tmpl, poly_b[0], poly_b[n - 1], poly_b[n], scissor);
+}
+
+//-----------------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------------
+
+bool    ImGui_ImplSoftRaster_Init(int threads_count)
+{
+    // Setup backend capabilities flags
+    ImGuiIO& io = ImGui::GetIO();
+    io.BackendRendererName = "imgui_impl_softraster";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates; // We sample ImFontAtlas::TexPixelsRGBA32 directly, so glyphs rasterized on demand are always up to date.
+    ImGui_ImplSoftRaster_SetThreadsCount(threads_count);
+    return true;
+}
+
+void    ImGui_ImplSoftRaster_Shutdown()
+{
+    ImGui_ImplSoftRaster_DestroyFontsTexture();
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+    ImGui_ImplSoftRaster_StopThreads();
+#endif
+    g_ThreadsCount = 1;
+    g_Triangles.clear();
+    g_TileTriangles.clear();
+    g_TileOffsets.clear();
+}
+
+void    ImGui_ImplSoftRaster_NewFrame()
+{
+    if (!g_FontTexture.Pixels)
+        ImGui_ImplSoftRaster_CreateFontsTexture();
+}
+
+void    ImGui_ImplSoftRaster_SetThreadsCount(int threads_count)
+{
+#ifndef IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS
+    if (threads_count <= 0)
+        threads_count = (int)std::thread::hardware_concurrency();
+    if (threads_count <= 0)
+        threads_count = 1;
+    ImGui_ImplSoftRaster_StopThreads();
+    g_ThreadsCount = threads_count;
+    if (threads_count > 1)
+    {
+        g_Threads = new std::thread[threads_count - 1];
+        for (int n = 0; n < threads_count - 1; n++)
+            g_Threads[n] = std::thread(ImGui_ImplSoftRaster_WorkerThread, g_JobGeneration);
+    }
+#else
+    IM_UNUSED(threads_count);
+    g_ThreadsCount = 1;
+#endif
+}
+
+// Software Render function.
+// Blends over the existing contents of 'pixels' (width * height pixels, rows 'pitch_in_bytes' apart), only within 'redraw_rect' if not NULL.
+void    ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, unsigned int* pixels, int width, int height, int pitch_in_bytes, const ImVec4* redraw_rect)
+{
+    // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
+    int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    fb_width = SoftRasterMin(fb_width, width);
+    fb_height = SoftRasterMin(fb_height, height);
+    if (fb_width <= 0 || fb_height <= 0)
+        return;
+    IM_ASSERT(fb_width <= SOFTRASTER_MAX_SIZE && fb_height <= SOFTRASTER_MAX_SIZE && "Framebuffer is too large!");
+    IM_ASSERT((pitch_in_bytes % 4) == 0 && pitch_in_bytes >= width * 4);
+
+    g_TargetPixels = pixels;
+    g_TargetPitch = pitch_in_bytes / 4;
+    g_TargetWidth = fb_width;
+    g_TargetHeight = fb_height;
+    g_TilesCountX = (fb_width + (1 << SOFTRASTER_TILE_BITS) - 1) >> SOFTRASTER_TILE_BITS;
+    g_TilesCountY = (fb_height + (1 << SOFTRASTER_TILE_BITS) - 1) >> SOFTRASTER_TILE_BITS;
+
+    // Will project scissor/clipping rectangles into framebuffer space
+    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    // Area to redraw, e.g. one of draw_data->DirtyRects[]
+    int limits[4] = { 0, 0, fb_width, fb_height };
+    if (redraw_rect != NULL)
+    {
+        limits[0] = (int)floorf(SoftRasterClamp((redraw_rect->x - clip_off.x) * clip_scale.x, 0.0f, (float)fb_width));
+        limits[1] = (int)floorf(SoftRasterClamp((redraw_rect->y - clip_off.y) * clip_scale.y, 0.0f, (float)fb_height));
+        limits[2] = (int)ceilf(SoftRasterClamp((redraw_rect->z - clip_off.x) * clip_scale.x, 0.0f, (float)fb_width));
+        limits[3] = (int)ceilf(SoftRasterClamp((redraw_rect->w - clip_off.y) * clip_scale.y, 0.0f, (float)fb_height));
+        if (limits[0] >= limits[2] || limits[1] >= limits[3])
+            return;
+    }
+
+    // Render command lists
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != NULL)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state. We have none.)
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                {
+                    ImGui_ImplSoftRaster_Flush();
+                    pcmd->UserCallback(cmd_list, pcmd);
+                }
+                continue;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space
+            ImVec4 clip_rect;
+            clip_rect.x = SoftRasterClamp((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, 0.0f, (float)fb_width);
+            clip_rect.y = SoftRasterClamp((pcmd->ClipRect.y - clip_off.y) * clip_scale.y, 0.0f, (float)fb_height);
+            clip_rect.z = SoftRasterClamp((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, 0.0f, (float)fb_width);
+            clip_rect.w = SoftRasterClamp((pcmd->ClipRect.w - clip_off.y) * clip_scale.y, 0.0f, (float)fb_height);
+            const int scissor[4] = { SoftRasterMax((int)clip_rect.x, limits[0]), SoftRasterMax((int)clip_rect.y, limits[1]), SoftRasterMin((int)clip_rect.z, limits[2]), SoftRasterMin((int)clip_rect.w, limits[3]) };
+            if (scissor[0] >= scissor[2] || scissor[1] >= scissor[3])
+                continue;
+
+            const ImGui_ImplSoftRaster_Texture* tex = (const ImGui_ImplSoftRaster_Texture*)pcmd->TextureId;
+            IM_ASSERT(tex != NULL && tex->Pixels != NULL && tex->Width > 0 && tex->Height > 0);
+            const ImDrawVert* vtx_buffer = cmd_list->VtxBuffer.Data + pcmd->VtxOffset;
+            const ImDrawIdx* idx_buffer = cmd_list->IdxBuffer.Data + pcmd->IdxOffset;
+            for (unsigned int i = 0; i + 3 <= pcmd->ElemCount; i += 3)
+            {
+                const ImDrawVert& v0 = vtx_buffer[idx_buffer[i]];
+                const ImDrawVert& v1 = vtx_buffer[idx_buffer[i + 1]];
+                const ImDrawVert& v2 = vtx_buffer[idx_buffer[i + 2]];
+
+                // Rectangles are drawn as two triangles (v0, v1, v2) (v0, v2, v3): rasterize them at once, without testing edges
+                if (i + 6 <= pcmd->ElemCount && idx_buffer[i + 3] == idx_buffer[i] && idx_buffer[i + 4] == idx_buffer[i + 2])
+                {
+                    const ImDrawVert& v3 = vtx_buffer[idx_buffer[i + 5]];
+                    if (ImGui_ImplSoftRaster_IsRectangle(v0, v1, v2, v3))
+                    {
+                        ImGui_ImplSoftRaster_SetupTriangle(v0, v1, v2, &v3, clip_off, clip_scale, scissor, tex);
+                        i += 3;
+                        continue;
+                    }
+                }
+                ImGui_ImplSoftRaster_SetupTriangle(v0, v1, v2, NULL, clip_off, clip_scale, scissor, tex);
+            }
+        }
+    }
+    ImGui_ImplSoftRaster_Flush();
+}
+
+bool    ImGui_ImplSoftRaster_CreateFontsTexture()
+{
+    // Build texture atlas
+    ImGuiIO& io = ImGui::GetIO();
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+
+    // Store our identifier. The atlas keeps ownership of the pixels.
+    g_FontTexture.Pixels = (const unsigned int*)(const void*)pixels;
+    g_FontTexture.Width = width;
+    g_FontTexture.Height = height;
+    io.Fonts->TexID = (ImTextureID)&g_FontTexture;
+    return true;
+}
+
+void    ImGui_ImplSoftRaster_DestroyFontsTexture()
+{
+    if (g_FontTexture.Pixels)
+    {
+        ImGuiIO& io = ImGui::GetIO();
+        io.Fonts->TexID = 0;
+        g_FontTexture.Pixels = NULL;
+    }
+}
@@ -0,0 +1,40 @@
+// dear imgui: Renderer Backend for software rendering into a 32-bit pixel buffer (no GPU required)
+// This needs to be used along with a Platform Backend (e.g. GLFW, SDL, Win32, custom..), or with none at all to render headless.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Multi-threaded rasterization (requires C++11 <thread>, disable with '#define IMGUI_IMPL_SOFTRASTER_DISABLE_THREADS').
+//  [X] Renderer: Glyphs rasterized on demand (ImFontConfig::DynamicGlyphs), the font texture being ImFontAtlas::TexPixelsRGBA32 itself.
+
+// You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+// Pixels of the target buffer and of textures are 32-bit values in the same layout as ImU32 colors (IM_COL32), which is RGBA
+// in memory order by default, or BGRA when IMGUI_USE_BGRA_PACKED_COLOR is defined.
+// ImGui_ImplSoftRaster_RenderDrawData() blends over the existing contents of the target buffer: clear it first.
+// With io.ConfigTrackDirtyRects, the buffer may instead be kept from one frame to the next, only clearing and redrawing each of
+// draw_data->DirtyRects[] (passed as 'redraw_rect'). Nothing needs to be drawn nor presented when there are none.
+// The output is identical for any number of threads.
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+
+// Texture sampled by the renderer. Pass a pointer to it as ImTextureID. Pixels are not copied and need to stay valid while rendering.
+struct ImGui_ImplSoftRaster_Texture
+{
+    const unsigned int* Pixels;     // Width * Height pixels, in IM_COL32 layout (non-premultiplied alpha)
+    int                 Width;
+    int                 Height;
+};
+
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_Init(int threads_count = 0);   // Number of threads rasterizing, including the calling thread. 0: one per hardware thread.
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, unsigned int* pixels, int width, int height, int pitch_in_bytes, const ImVec4* redraw_rect = NULL);
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_SetThreadsCount(int threads_count);
+
+// Called by Init/NewFrame/Shutdown
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_CreateFontsTexture();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_DestroyFontsTexture();
@@ -0,0 +1,16 @@
+#version 450 core
+layout(location = 0) out vec4 fColor;
+
+layout(set=0, binding=0) uniform sampler2D sTexture;
+
+layout(location = 0) in struct {
+    vec4 Color;
+    vec2 UV;
+} In;
+
+void main()
+{
+    float dist = texture(sTexture, In.UV.st).a;
+    float alpha = clamp((dist - 0.5) / max(fwidth(dist), 0.0001) + 0.5, 0.0, 1.0);
+    fColor = vec4(In.Color.rgb, In.Color.a * alpha);
+}
@@ -147,6 +147,7 @@ int main(int, char**)
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application.
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
+        // To save power when nothing changes, you may call ImGui_ImplGlfw_WaitForEvents() instead: it sleeps until inputs or until dear imgui needs a new frame (io.MaxWaitBeforeNextFrame).
         glfwPollEvents();
 
         // Start the Dear ImGui frame
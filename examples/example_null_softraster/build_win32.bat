@@ -0,0 +1,3 @@
+@REM Build for Visual Studio compiler. Run your copy of vcvars32.bat or vcvarsall.bat to setup command-line compiler.
+mkdir Debug
+cl /nologo /Zi /MD /EHsc /I ..\.. /I ..\..\backends %* *.cpp ..\..\backends\imgui_impl_softraster.cpp ..\..\*.cpp /FeDebug/example_null_softraster.exe /FoDebug/ /link gdi32.lib shell32.lib
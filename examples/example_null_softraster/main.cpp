@@ -0,0 +1,380 @@
+// dear imgui: headless example application using the software renderer
+// (compile and link imgui, create context, run headless with scripted inputs, render into a pixel buffer with imgui_impl_softraster.cpp)
+// This is useful to take screenshots and to run pixel tests on machines without a GPU (continuous integration, servers..).
+
+// Usage:
+//   example_null_softraster [--frames N] [--threads N] [--save DIR] [--compare DIR] [--save-signatures FILE] [--compare-signatures FILE] [--tolerance N]
+// - Every frame is rendered with N threads (default: one per hardware thread), and again with a single thread: both must be identical.
+// - Every frame is also rendered into a buffer kept from the previous frame, only redrawing ImDrawData::DirtyRects (io.ConfigTrackDirtyRects):
+//   it must be identical too. Inputs and animations stop every third second, so some frames have nothing to redraw.
+// - --save DIR: write every 60th frame and the last one to DIR/frame_NNNN.ppm.
+// - --compare DIR: compare the same frames against images previously written with --save. Color channels may differ by up to
+//   --tolerance (default: 0), e.g. to compare images rendered on another architecture.
+// - --save-signatures FILE: write the signature of every frame to FILE: a hash of its pixels and the average color of 160x144 tiles.
+// - --compare-signatures FILE: compare every frame against signatures previously written with --save-signatures. Hashes must be equal,
+//   or with --tolerance N, the average color of every tile may differ by up to N+1 (rounding).
+//   reference_signatures.txt holds the signatures of 60 frames of the default build on x86-64 (see .github/workflows/build.yml).
+//   Regenerate it with '--frames 60 --save-signatures reference_signatures.txt' when changing rendering on purpose.
+// Returns 0 when every check passed.
+
+#include "imgui.h"
+#include "imgui_impl_softraster.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static bool SaveImage(const char* filename, const unsigned int* pixels, int width, int height)
+{
+    FILE* f = fopen(filename, "wb");
+    if (!f)
+        return false;
+    fprintf(f, "P6\n%d %d\n255\n", width, height);
+    for (int n = 0; n < width * height; n++)
+    {
+        const unsigned char rgb[3] = { (unsigned char)(pixels[n] >> IM_COL32_R_SHIFT), (unsigned char)(pixels[n] >> IM_COL32_G_SHIFT), (unsigned char)(pixels[n] >> IM_COL32_B_SHIFT) };
+        fwrite(rgb, 1, 3, f);
+    }
+    fclose(f);
+    return true;
+}
+
+static bool LoadImage(const char* filename, ImVector<unsigned int>* pixels, int width, int height)
+{
+    FILE* f = fopen(filename, "rb");
+    if (!f)
+        return false;
+    int w = 0, h = 0, max_value = 0;
+    bool ok = (fscanf(f, "P6 %d %d %d", &w, &h, &max_value) == 3 && fgetc(f) != EOF && w == width && h == height && max_value == 255);
+    pixels->resize(width * height);
+    for (int n = 0; ok && n < width * height; n++)
+    {
+        unsigned char rgb[3];
+        ok = (fread(rgb, 1, 3, f) == 3);
+        (*pixels)[n] = IM_COL32(rgb[0], rgb[1], rgb[2], 255);
+    }
+    fclose(f);
+    return ok;
+}
+
+// Signature of a frame: FNV-1a hash of the RGB values (alpha is ignored, as in saved images) and average color of each tile
+static const int SIGNATURE_TILE_W = 160;
+static const int SIGNATURE_TILE_H = 144;
+
+struct FrameSignature
+{
+    int                     Frame;
+    ImU64                   Hash;
+    ImVector<unsigned int>  TileColors;     // 0xRRGGBB
+};
+
+static void ComputeFrameSignature(FrameSignature* sig, int frame, const unsigned int* pixels, int width, int height)
+{
+    sig->Frame = frame;
+    sig->Hash = 14695981039346656037ULL;
+    for (int n = 0; n < width * height; n++)
+        for (int shift = 0; shift < 24; shift += 8)
+            sig->Hash = (sig->Hash ^ ((pixels[n] >> shift) & 0xFF)) * 1099511628211ULL;
+    const int tiles_x = (width + SIGNATURE_TILE_W - 1) / SIGNATURE_TILE_W, tiles_y = (height + SIGNATURE_TILE_H - 1) / SIGNATURE_TILE_H;
+    sig->TileColors.resize(tiles_x * tiles_y);
+    for (int tile_y = 0; tile_y < tiles_y; tile_y++)
+        for (int tile_x = 0; tile_x < tiles_x; tile_x++)
+        {
+            unsigned int sum[3] = { 0, 0, 0 }, count = 0;
+            for (int y = tile_y * SIGNATURE_TILE_H; y < height && y < (tile_y + 1) * SIGNATURE_TILE_H; y++)
+                for (int x = tile_x * SIGNATURE_TILE_W; x < width && x < (tile_x + 1) * SIGNATURE_TILE_W; x++, count++)
+                {
+                    const unsigned int col = pixels[y * width + x];
+                    sum[0] += (col >> IM_COL32_R_SHIFT) & 0xFF;
+                    sum[1] += (col >> IM_COL32_G_SHIFT) & 0xFF;
+                    sum[2] += (col >> IM_COL32_B_SHIFT) & 0xFF;
+                }
+            unsigned int avg = 0;
+            for (int c = 0; c < 3; c++)
+                avg = (avg << 8) | ((sum[c] + count / 2) / count);
+            sig->TileColors[tile_y * tiles_x + tile_x] = avg;
+        }
+}
+
+// One line per frame: "<frame> <hash> <tile colors...>". Lines starting with '#' are comments.
+static void WriteFrameSignature(FILE* f, const FrameSignature& sig)
+{
+    fprintf(f, "%d %016llx", sig.Frame, (unsigned long long)sig.Hash);
+    for (int n = 0; n < sig.TileColors.Size; n++)
+        fprintf(f, " %06x", sig.TileColors[n]);
+    fprintf(f, "\n");
+}
+
+static bool LoadFrameSignatures(const char* filename, ImVector<FrameSignature>* sigs, int tiles_count)
+{
+    FILE* f = fopen(filename, "rb");
+    if (!f)
+        return false;
+    bool ok = true;
+    char line[4096];
+    while (ok && fgets(line, sizeof(line), f))
+    {
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r')
+            continue;
+        sigs->push_back(FrameSignature());
+        FrameSignature& sig = sigs->back();
+        unsigned long long hash = 0;
+        int offset = 0;
+        ok = (sscanf(line, "%d %llx%n", &sig.Frame, &hash, &offset) == 2);
+        sig.Hash = (ImU64)hash;
+        sig.TileColors.resize(tiles_count);
+        for (int n = 0; ok && n < tiles_count; n++)
+        {
+            int len = 0;
+            ok = (sscanf(line + offset, " %x%n", &sig.TileColors[n], &len) == 1);
+            offset += len;
+        }
+    }
+    fclose(f);
+    return ok;
+}
+
+// Return the largest difference between the average color of two tiles, or -1 if the signatures can't be compared
+static int CompareFrameSignatures(const FrameSignature& a, const FrameSignature& b)
+{
+    if (a.TileColors.Size != b.TileColors.Size)
+        return -1;
+    int diff_max = 0;
+    for (int n = 0; n < a.TileColors.Size; n++)
+        for (int shift = 0; shift < 24; shift += 8)
+        {
+            const int d = abs((int)((a.TileColors[n] >> shift) & 0xFF) - (int)((b.TileColors[n] >> shift) & 0xFF));
+            diff_max = (d > diff_max) ? d : diff_max;
+        }
+    return diff_max;
+}
+
+// Shapes not covered by the demo window: thick lines, gradients, user textures with bilinear filtering
+static void ShowRenderTestWindow(int frame)
+{
+    ImGui::SetNextWindowPos(ImVec2(20, 420), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(600, 280), ImGuiCond_FirstUseEver);
+    ImGui::Begin("Render test");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 p = ImGui::GetCursorScreenPos();
+    const float t = frame * 0.02f;
+    draw_list->AddRectFilledMultiColor(ImVec2(p.x, p.y), ImVec2(p.x + 120, p.y + 120), IM_COL32(255, 0, 0, 255), IM_COL32(0, 255, 0, 255), IM_COL32(0, 0, 255, 255), IM_COL32(255, 255, 255, 128));
+    draw_list->AddCircleFilled(ImVec2(p.x + 190, p.y + 60), 50.0f, IM_COL32(255, 200, 0, 160));
+    draw_list->AddCircle(ImVec2(p.x + 190, p.y + 60), 55.0f + 5.0f * sinf(t), IM_COL32(0, 200, 255, 255), 0, 3.5f);
+    draw_list->AddRect(ImVec2(p.x + 260, p.y + 10), ImVec2(p.x + 360, p.y + 110), IM_COL32(255, 255, 255, 255), 12.0f, ImDrawCornerFlags_All, 1.5f);
+    draw_list->AddTriangleFilled(ImVec2(p.x + 380, p.y + 110), ImVec2(p.x + 430 + 20.0f * cosf(t), p.y + 5), ImVec2(p.x + 480, p.y + 110), IM_COL32(120, 255, 120, 200));
+    draw_list->AddBezierCurve(ImVec2(p.x, p.y + 140), ImVec2(p.x + 100, p.y + 240), ImVec2(p.x + 200, p.y + 100), ImVec2(p.x + 300, p.y + 200), IM_COL32(255, 128, 255, 255), 4.0f);
+    draw_list->AddImage(ImGui::GetIO().Fonts->TexID, ImVec2(p.x + 320, p.y + 130), ImVec2(p.x + 320 + 256 * (0.9f + 0.2f * sinf(t)), p.y + 250));
+    ImGui::End();
+}
+
+int main(int argc, char** argv)
+{
+    int frames_count = 300;
+    int threads_count = 0;
+    int tolerance = 0;
+    const char* save_dir = NULL;
+    const char* compare_dir = NULL;
+    const char* save_signatures_filename = NULL;
+    const char* compare_signatures_filename = NULL;
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--frames") == 0 && n + 1 < argc)                     { frames_count = atoi(argv[++n]); }
+        else if (strcmp(argv[n], "--threads") == 0 && n + 1 < argc)               { threads_count = atoi(argv[++n]); }
+        else if (strcmp(argv[n], "--tolerance") == 0 && n + 1 < argc)             { tolerance = atoi(argv[++n]); }
+        else if (strcmp(argv[n], "--save") == 0 && n + 1 < argc)                  { save_dir = argv[++n]; }
+        else if (strcmp(argv[n], "--compare") == 0 && n + 1 < argc)               { compare_dir = argv[++n]; }
+        else if (strcmp(argv[n], "--save-signatures") == 0 && n + 1 < argc)       { save_signatures_filename = argv[++n]; }
+        else if (strcmp(argv[n], "--compare-signatures") == 0 && n + 1 < argc)    { compare_signatures_filename = argv[++n]; }
+        else { printf("Unknown argument '%s'\n", argv[n]); return 1; }
+    }
+
+    // Setup Dear ImGui context
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.ConfigTrackDirtyRects = true;
+
+    // Setup Platform/Renderer backends
+    ImGui_ImplSoftRaster_Init(threads_count);
+
+    const int width = 1280, height = 720;
+    const unsigned int clear_color = IM_COL32(115, 140, 153, 255);
+    ImVector<unsigned int> pixels, pixels_single_thread, pixels_dirty_rects, pixels_reference;
+    pixels.resize(width * height);
+    pixels_single_thread.resize(width * height);
+    pixels_dirty_rects.resize(width * height);
+
+    double render_time = 0.0, render_time_single_thread = 0.0, render_time_dirty_rects = 0.0, dirty_area = 0.0;
+    int thread_mismatches = 0, dirty_rects_mismatches = 0, unchanged_frames = 0, compared_images = 0, compare_failures = 0;
+    int compared_signatures = 0, signature_failures = 0;
+
+    // Signatures
+    const int tiles_count = ((width + SIGNATURE_TILE_W - 1) / SIGNATURE_TILE_W) * ((height + SIGNATURE_TILE_H - 1) / SIGNATURE_TILE_H);
+    FrameSignature signature;
+    ImVector<FrameSignature> reference_signatures;
+    if (compare_signatures_filename && !LoadFrameSignatures(compare_signatures_filename, &reference_signatures, tiles_count))
+    {
+        printf("Failed to read '%s'\n", compare_signatures_filename);
+        return 1;
+    }
+    FILE* save_signatures_file = NULL;
+    if (save_signatures_filename)
+    {
+        if (!(save_signatures_file = fopen(save_signatures_filename, "wb")))
+        {
+            printf("Failed to write '%s'\n", save_signatures_filename);
+            return 1;
+        }
+        fprintf(save_signatures_file, "# example_null_softraster frame signatures, %dx%d, %d frames: <frame> <hash> <average color of %dx%d tiles>\n", width, height, frames_count, SIGNATURE_TILE_W, SIGNATURE_TILE_H);
+    }
+    int anim_frame = 0;
+    for (int frame = 0; frame < frames_count; frame++)
+    {
+        // Scripted inputs: move the mouse around and click every now and then, stop every third second
+        if ((frame / 60) % 3 != 2)
+            anim_frame++;
+        io.DisplaySize = ImVec2((float)width, (float)height);
+        io.DeltaTime = 1.0f / 60.0f;
+        io.MousePos = ImVec2(700.0f + 300.0f * sinf(anim_frame * 0.013f), 250.0f + 200.0f * sinf(anim_frame * 0.021f));
+        io.MouseDown[0] = (anim_frame % 90) >= 85;
+
+        ImGui_ImplSoftRaster_NewFrame();
+        ImGui::NewFrame();
+        ImGui::ShowDemoWindow(NULL);
+        ImGui::SetNextWindowPos(ImVec2(20, 20), ImGuiCond_FirstUseEver);
+        ImGui::SetNextWindowSize(ImVec2(600, 380), ImGuiCond_FirstUseEver);
+        ImGui::Begin("Style Editor");
+        ImGui::ShowStyleEditor();
+        ImGui::End();
+        ShowRenderTestWindow(anim_frame);
+        ImGui::Render();
+        ImDrawData* draw_data = ImGui::GetDrawData();
+
+        // Render with all threads, then with a single thread
+        if (frame == 0)
+            for (int n = 0; n < width * height; n++)
+                pixels_dirty_rects[n] = clear_color;
+        for (int n = 0; n < width * height; n++)
+            pixels[n] = pixels_single_thread[n] = clear_color;
+        std::chrono::high_resolution_clock::time_point t0 = std::chrono::high_resolution_clock::now();
+        ImGui_ImplSoftRaster_RenderDrawData(draw_data, pixels.Data, width, height, width * 4);
+        std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+        ImGui_ImplSoftRaster_SetThreadsCount(1);
+        std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+        ImGui_ImplSoftRaster_RenderDrawData(draw_data, pixels_single_thread.Data, width, height, width * 4);
+        std::chrono::high_resolution_clock::time_point t3 = std::chrono::high_resolution_clock::now();
+        ImGui_ImplSoftRaster_SetThreadsCount(threads_count);
+        render_time += std::chrono::duration<double>(t1 - t0).count();
+        render_time_single_thread += std::chrono::duration<double>(t3 - t2).count();
+        if (memcmp(pixels.Data, pixels_single_thread.Data, (size_t)pixels.size_in_bytes()) != 0)
+        {
+            printf("Frame %d: output differs between multi-threaded and single-threaded rendering!\n", frame);
+            thread_mismatches++;
+        }
+
+        // Redraw the areas which changed since the previous frame only
+        std::chrono::high_resolution_clock::time_point t4 = std::chrono::high_resolution_clock::now();
+        for (int rect_n = 0; rect_n < draw_data->DirtyRectsCount; rect_n++)
+        {
+            const ImVec4& r = draw_data->DirtyRects[rect_n];
+            for (int y = (int)r.y; y < (int)r.w; y++)
+                for (int x = (int)r.x; x < (int)r.z; x++)
+                    pixels_dirty_rects[y * width + x] = clear_color;
+            ImGui_ImplSoftRaster_RenderDrawData(draw_data, pixels_dirty_rects.Data, width, height, width * 4, &r);
+            dirty_area += (double)(r.z - r.x) * (r.w - r.y);
+        }
+        std::chrono::high_resolution_clock::time_point t5 = std::chrono::high_resolution_clock::now();
+        render_time_dirty_rects += std::chrono::duration<double>(t5 - t4).count();
+        if (draw_data->DirtyRectsCount == 0)
+            unchanged_frames++;
+        if (memcmp(pixels.Data, pixels_dirty_rects.Data, (size_t)pixels.size_in_bytes()) != 0)
+        {
+            printf("Frame %d: output differs when only redrawing dirty rectangles!\n", frame);
+            dirty_rects_mismatches++;
+        }
+
+        // Save/compare signatures
+        if (save_signatures_file || compare_signatures_filename)
+            ComputeFrameSignature(&signature, frame, pixels.Data, width, height);
+        if (save_signatures_file)
+            WriteFrameSignature(save_signatures_file, signature);
+        if (compare_signatures_filename)
+        {
+            const FrameSignature* reference = NULL;
+            for (int n = 0; n < reference_signatures.Size && reference == NULL; n++)
+                if (reference_signatures[n].Frame == frame)
+                    reference = &reference_signatures[n];
+            const int diff_max = reference ? CompareFrameSignatures(signature, *reference) : -1;
+            compared_signatures++;
+            if (reference == NULL)
+            {
+                printf("Frame %d: no reference signature in '%s'\n", frame, compare_signatures_filename);
+                signature_failures++;
+            }
+            else if (signature.Hash != reference->Hash && (tolerance == 0 || diff_max < 0 || diff_max > tolerance + 1))
+            {
+                printf("Frame %d: pixels differ from the reference signature (max tile difference %d)\n", frame, diff_max);
+                signature_failures++;
+            }
+        }
+
+        // Save/compare images
+        if (frame % 60 != 0 && frame != frames_count - 1)
+            continue;
+        char filename[512];
+        if (save_dir)
+        {
+            snprintf(filename, sizeof(filename), "%s/frame_%04d.ppm", save_dir, frame);
+            if (!SaveImage(filename, pixels.Data, width, height))
+                printf("Failed to write '%s'\n", filename);
+        }
+        if (compare_dir)
+        {
+            snprintf(filename, sizeof(filename), "%s/frame_%04d.ppm", compare_dir, frame);
+            if (!LoadImage(filename, &pixels_reference, width, height))
+            {
+                printf("Failed to read '%s'\n", filename);
+                compare_failures++;
+                continue;
+            }
+            int diff_pixels = 0, diff_max = 0;
+            for (int n = 0; n < width * height; n++)
+            {
+                int diff = 0;
+                for (int shift = 0; shift < 24; shift += 8)
+                {
+                    const int d = abs((int)((pixels[n] >> shift) & 0xFF) - (int)((pixels_reference[n] >> shift) & 0xFF));
+                    diff = (d > diff) ? d : diff;
+                }
+                diff_max = (diff > diff_max) ? diff : diff_max;
+                diff_pixels += (diff > tolerance) ? 1 : 0;
+            }
+            compared_images++;
+            if (diff_pixels > 0)
+            {
+                printf("Frame %d: %d pixels differ from '%s' (max difference %d)\n", frame, diff_pixels, filename, diff_max);
+                compare_failures++;
+            }
+        }
+    }
+
+    printf("Frames: %d, %dx%d\n", frames_count, width, height);
+    printf("Render: %.3f ms/frame multi-threaded, %.3f ms/frame single-threaded\n", render_time * 1000.0 / frames_count, render_time_single_thread * 1000.0 / frames_count);
+    printf("Render dirty rectangles only: %.3f ms/frame, %.1f%% of display redrawn, %d unchanged frames\n", render_time_dirty_rects * 1000.0 / frames_count, dirty_area * 100.0 / ((double)width * height * frames_count), unchanged_frames);
+    printf("Multi-threaded vs single-threaded: %d mismatching frames\n", thread_mismatches);
+    printf("Dirty rectangles vs full redraw: %d mismatching frames\n", dirty_rects_mismatches);
+    if (compare_dir)
+        printf("Compared %d images: %d failures\n", compared_images, compare_failures);
+    if (compare_signatures_filename)
+        printf("Compared %d frame signatures: %d failures\n", compared_signatures, signature_failures);
+    if (save_signatures_file)
+        fclose(save_signatures_file);
+
+    // Cleanup
+    ImGui_ImplSoftRaster_Shutdown();
+    ImGui::DestroyContext();
+    return (thread_mismatches == 0 && dirty_rects_mismatches == 0 && compare_failures == 0 && signature_failures == 0) ? 0 : 1;
+}
@@ -143,6 +143,7 @@ int main(int, char**)
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application.
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
+        // To save power when nothing changes, you may call ImGui_ImplSDL2_WaitForEvent() first: it sleeps until inputs or until dear imgui needs a new frame (io.MaxWaitBeforeNextFrame).
         SDL_Event event;
         while (SDL_PollEvent(&event))
         {
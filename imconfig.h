@@ -43,6 +43,9 @@
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 
+//---- Don't use SSE2/NEON intrinsics in the few hot paths that have a vectorized implementation (e.g. AddPolyline). Scalar fallbacks will be used.
+//#define IMGUI_DISABLE_SIMD
+
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 //#define IMGUI_INCLUDE_IMGUI_USER_H
 
@@ -89,6 +92,12 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 12 bytes ImDrawVert (16-bit fixed point positions, 16-bit normalized UV) instead of the default 20 bytes.
+// Positions are quantized to 1/(1<<IM_DRAWVERT_POS16_FRAC_BITS) pixel and limited to +/-32767/(1<<IM_DRAWVERT_POS16_FRAC_BITS).
+// Your renderer backend will need to support it (DirectX10/11/12, Metal, OpenGL3, Vulkan backends do, OpenGL2 backend doesn't).
+//#define IMGUI_USE_COMPACT_DRAWVERT
+//#define IM_DRAWVERT_POS16_FRAC_BITS 2
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
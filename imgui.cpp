@@ -823,6 +823,12 @@ static const float WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS = 4.0f;     // Exten
 static const float WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER = 0.04f;    // Reduce visual noise by only highlighting the border after a certain time.
 static const float WINDOWS_MOUSE_WHEEL_SCROLL_LOCK_TIMER    = 2.00f;    // Lock scrolled window (so it doesn't pick child windows that are scrolling through) for a certain time, unless mouse moved.
 
+// Dirty rectangles (when io.ConfigTrackDirtyRects = true)
+static const int   DIRTY_RECTS_MAX_COUNT                    = 8;        // Past this count, changed areas are merged with the dirty rectangle growing the least
+
+// Idle detection (io.MaxWaitBeforeNextFrame)
+static const int   ACTIVITY_FRAMES_AFTER_INPUTS             = 3;        // Frames to start without waiting after inputs or other activity, so the UI can settle before idling
+
 //-------------------------------------------------------------------------
 // [SECTION] FORWARD DECLARATIONS
 //-------------------------------------------------------------------------
@@ -831,8 +837,12 @@ static void             SetCurrentWindow(ImGuiWindow* window);
 static void             FindHoveredWindow();
 static ImGuiWindow*     CreateNewWindow(const char* name, ImGuiWindowFlags flags);
 static ImVec2           CalcNextScrollFromScrollTargetAndClamp(ImGuiWindow* window);
+static bool             IsWindowIdle(ImGuiWindow* window);
+static bool             IsWindowFreezable(ImGuiWindow* window);
+static void             KeepAliveFrozenChildWindows(ImGuiWindow* window);
 
 static void             AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* draw_list);
+static void             FlushDeferredDrawLists(ImVector<ImDrawList*>* draw_lists);
 static void             AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window);
 
 static ImRect           GetViewportRect();
@@ -878,6 +888,7 @@ static void             UpdateMouseInputs();
 static void             UpdateMouseWheel();
 static void             UpdateTabFocus();
 static void             UpdateDebugToolItemPicker();
+static void             UpdateMaxWaitBeforeNextFrame();
 static bool             UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& size_auto_fit, int* border_held, int resize_grip_count, ImU32 resize_grip_col[4], const ImRect& visibility_rect);
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
@@ -1038,6 +1049,10 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigWindowsMemoryCompactTimer = 60.0f;
+    ConfigDeferredTessellation = false;
+    ConfigOcclusionCulling = false;
+    ConfigReorderDrawCmds = false;
+    ConfigTrackDirtyRects = false;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1047,6 +1062,8 @@ ImGuiIO::ImGuiIO()
     ClipboardUserData = NULL;
     ImeSetInputScreenPosFn = ImeSetInputScreenPosFn_DefaultImpl;
     ImeWindowHandle = NULL;
+    RenderJobsFn = NULL;
+    RenderJobsUserData = NULL;
 
     // Input (NB: we already have memset zero the entire structure!)
     MousePos = ImVec2(-FLT_MAX, -FLT_MAX);
@@ -1137,50 +1154,15 @@ ImVec2 ImBezierClosestPoint(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3
     return p_closest;
 }
 
-// Closely mimics PathBezierToCasteljau() in imgui_draw.cpp
-static void BezierClosestPointCasteljauStep(const ImVec2& p, ImVec2& p_closest, ImVec2& p_last, float& p_closest_dist2, float x1, float y1, float x2, float y2, float x3, float y3, float x4, float y4, float tess_tol, int level)
-{
-    float dx = x4 - x1;
-    float dy = y4 - y1;
-    float d2 = ((x2 - x4) * dy - (y2 - y4) * dx);
-    float d3 = ((x3 - x4) * dy - (y3 - y4) * dx);
-    d2 = (d2 >= 0) ? d2 : -d2;
-    d3 = (d3 >= 0) ? d3 : -d3;
-    if ((d2 + d3) * (d2 + d3) < tess_tol * (dx * dx + dy * dy))
-    {
-        ImVec2 p_current(x4, y4);
-        ImVec2 p_line = ImLineClosestPoint(p_last, p_current, p);
-        float dist2 = ImLengthSqr(p - p_line);
-        if (dist2 < p_closest_dist2)
-        {
-            p_closest = p_line;
-            p_closest_dist2 = dist2;
-        }
-        p_last = p_current;
-    }
-    else if (level < 10)
-    {
-        float x12 = (x1 + x2)*0.5f,       y12 = (y1 + y2)*0.5f;
-        float x23 = (x2 + x3)*0.5f,       y23 = (y2 + y3)*0.5f;
-        float x34 = (x3 + x4)*0.5f,       y34 = (y3 + y4)*0.5f;
-        float x123 = (x12 + x23)*0.5f,    y123 = (y12 + y23)*0.5f;
-        float x234 = (x23 + x34)*0.5f,    y234 = (y23 + y34)*0.5f;
-        float x1234 = (x123 + x234)*0.5f, y1234 = (y123 + y234)*0.5f;
-        BezierClosestPointCasteljauStep(p, p_closest, p_last, p_closest_dist2, x1, y1, x12, y12, x123, y123, x1234, y1234, tess_tol, level + 1);
-        BezierClosestPointCasteljauStep(p, p_closest, p_last, p_closest_dist2, x1234, y1234, x234, y234, x34, y34, x4, y4, tess_tol, level + 1);
-    }
-}
-
 // tess_tol is generally the same value you would find in ImGui::GetStyle().CurveTessellationTol
 // Because those ImXXX functions are lower-level than ImGui:: we cannot access this value automatically.
+// Uses the same segments as auto-tessellated PathBezierCurveTo()/AddBezierCurve() (see ImDrawListSharedData::SetCurveTessellationTol()).
 ImVec2 ImBezierClosestPointCasteljau(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, const ImVec2& p, float tess_tol)
 {
     IM_ASSERT(tess_tol > 0.0f);
-    ImVec2 p_last = p1;
-    ImVec2 p_closest;
-    float p_closest_dist2 = FLT_MAX;
-    BezierClosestPointCasteljauStep(p, p_closest, p_last, p_closest_dist2, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, p4.x, p4.y, tess_tol, 0);
-    return p_closest;
+    const ImVec2 d12 = p1 - p2 * 2.0f + p3, d23 = p2 - p3 * 2.0f + p4;
+    const float second_diff_len = ImSqrt(ImMax(ImDot(d12, d12), ImDot(d23, d23)));
+    return ImBezierClosestPoint(p1, p2, p3, p4, p, IM_DRAWLIST_CURVE_AUTO_SEGMENT_CALC(second_diff_len, tess_tol / 3.0f));
 }
 
 ImVec2 ImLineClosestPoint(const ImVec2& a, const ImVec2& b, const ImVec2& p)
@@ -2810,6 +2792,7 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
     Hidden = false;
     IsFallbackWindow = false;
     HasCloseButton = false;
+    Frozen = FreezeAllowed = false;
     ResizeBorderHeld = -1;
     BeginCount = 0;
     BeginOrderWithinParent = -1;
@@ -2833,6 +2816,8 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
 
     DrawList = &DrawListInst;
     DrawList->_OwnerName = Name;
+    FreezeRect = ImRect(0.0f, 0.0f, 0.0f, 0.0f);
+    FreezeDisplaySize = ImVec2(0.0f, 0.0f);
     ParentWindow = NULL;
     RootWindow = NULL;
     RootWindowForTitleBarHighlight = NULL;
@@ -3256,6 +3241,17 @@ void ImGui::MemFree(void* ptr)
     return GImAllocatorFreeFunc(ptr, GImAllocatorUserData);
 }
 
+// Don't touch the context, so this may be called from any thread (provided the allocator functions are thread-safe, as the default ones are)
+void* ImGui::MemAllocNoMetrics(size_t size)
+{
+    return GImAllocatorAllocFunc(size, GImAllocatorUserData);
+}
+
+void ImGui::MemFreeNoMetrics(void* ptr)
+{
+    return GImAllocatorFreeFunc(ptr, GImAllocatorUserData);
+}
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -3357,6 +3353,19 @@ int ImGui::GetFrameCount()
     return GImGui->FrameCount;
 }
 
+void ImGui::SetMaxWaitBeforeNextFrame(float seconds)
+{
+    ImGuiContext& g = *GImGui;
+    g.MaxWaitBeforeNextFrame = ImMin(g.MaxWaitBeforeNextFrame, ImMax(seconds, 0.0f));
+}
+
+void ImGui::MarkDirtyRect(const ImVec2& rect_min, const ImVec2& rect_max)
+{
+    ImGuiContext& g = *GImGui;
+    if (g.IO.ConfigTrackDirtyRects)
+        g.DrawDataDirtyRectsUser.push_back(ImRect(rect_min, rect_max));
+}
+
 ImDrawList* ImGui::GetBackgroundDrawList()
 {
     return &GImGui->BackgroundDrawList;
@@ -3770,6 +3779,7 @@ void ImGui::NewFrame()
     g.Time += g.IO.DeltaTime;
     g.WithinFrameScope = true;
     g.FrameCount += 1;
+    g.MaxWaitBeforeNextFrame = FLT_MAX;
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
@@ -3782,20 +3792,29 @@ void ImGui::NewFrame()
 
     // Setup current font and draw list shared data
     g.IO.Fonts->Locked = true;
+    ImFontAtlasUpdateNewFrame(g.IO.Fonts);
+    if (g.IO.Fonts->DynamicGlyphs.Size > 0)
+        for (int n = 0; n < g.Windows.Size; n++)
+            if (g.Windows[n]->DrawList->Flags & ImDrawListFlags_RetainContents)
+                ImFontAtlasKeepDynamicGlyphs(g.IO.Fonts, g.Windows[n]->DrawList); // Glyphs of windows which may stay frozen (ImGuiWindowFlags_FreezeWhenIdle)
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
     g.DrawListSharedData.ClipRectFullscreen = ImVec4(0.0f, 0.0f, g.IO.DisplaySize.x, g.IO.DisplaySize.y);
-    g.DrawListSharedData.CurveTessellationTol = g.Style.CurveTessellationTol;
+    g.DrawListSharedData.SetCurveTessellationTol(g.Style.CurveTessellationTol);
     g.DrawListSharedData.SetCircleSegmentMaxError(g.Style.CircleSegmentMaxError);
     g.DrawListSharedData.InitialFlags = ImDrawListFlags_None;
     if (g.Style.AntiAliasedLines)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLines;
     if (g.Style.AntiAliasedLinesUseTex && !(g.Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines))
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseTex;
+    if (g.Style.AntiAliasedLinesUseTex && !(g.Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners))
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_RoundCornersUseTex;
     if (g.Style.AntiAliasedFill)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if (g.IO.ConfigDeferredTessellation)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_DeferredTessellation;
 
     g.BackgroundDrawList._ResetForNewFrame();
     g.BackgroundDrawList.PushTextureID(g.IO.Fonts->TexID);
@@ -3805,6 +3824,10 @@ void ImGui::NewFrame()
     g.ForegroundDrawList.PushTextureID(g.IO.Fonts->TexID);
     g.ForegroundDrawList.PushClipRectFullScreen();
 
+    g.FrozenWindowsDrawList._ResetForNewFrame();
+    g.FrozenWindowsDrawList.PushTextureID(g.IO.Fonts->TexID);
+    g.FrozenWindowsDrawList.PushClipRectFullScreen();
+
     // Mark rendering data as invalid to prevent user who may have a handle on it to use it.
     g.DrawData.Clear();
 
@@ -4042,6 +4065,8 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.DrawDataBuilder.ClearFreeMemory();
     g.BackgroundDrawList._ClearFreeMemory();
     g.ForegroundDrawList._ClearFreeMemory();
+    g.MergedDrawList._ClearFreeMemory();
+    g.FrozenWindowsDrawList._ClearFreeMemory();
 
     g.TabBars.Clear();
     g.CurrentTabBarStack.clear();
@@ -4096,6 +4121,386 @@ static void AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, Im
     }
 }
 
+static void FlushDeferredDrawListJob(void* job_data, int job_index)
+{
+    ImDrawList* draw_list = ((ImDrawList**)job_data)[job_index];
+    draw_list->_FlushDeferredPrims();
+    draw_list->_TryMergeDrawCmds(); // Was skipped by AddDrawListToDrawData()
+}
+
+// Each draw list is an independent job, they can be processed in parallel by the user's job system.
+static void FlushDeferredDrawLists(ImVector<ImDrawList*>* draw_lists)
+{
+    ImGuiContext& g = *GImGui;
+    if (g.IO.RenderJobsFn != NULL && draw_lists->Size > 1)
+    {
+        g.IO.RenderJobsFn(g.IO.RenderJobsUserData, draw_lists->Size, FlushDeferredDrawListJob, draw_lists->Data);
+        return;
+    }
+    for (int n = 0; n < draw_lists->Size; n++)
+        FlushDeferredDrawListJob(draw_lists->Data, n);
+}
+
+// Trim 'clip_rect' when 'occluder' covers one of its sides entirely. Return false if nothing is left visible.
+static bool TrimClipRectBehindOccluder(ImRect& clip_rect, const ImRect& occluder)
+{
+    if (occluder.Min.x <= clip_rect.Min.x && occluder.Max.x >= clip_rect.Max.x)
+    {
+        if (occluder.Min.y <= clip_rect.Min.y && occluder.Max.y > clip_rect.Min.y)
+            clip_rect.Min.y = occluder.Max.y;
+        else if (occluder.Max.y >= clip_rect.Max.y && occluder.Min.y < clip_rect.Max.y)
+            clip_rect.Max.y = occluder.Min.y;
+    }
+    else if (occluder.Min.y <= clip_rect.Min.y && occluder.Max.y >= clip_rect.Max.y)
+    {
+        if (occluder.Min.x <= clip_rect.Min.x && occluder.Max.x > clip_rect.Min.x)
+            clip_rect.Min.x = occluder.Max.x;
+        else if (occluder.Max.x >= clip_rect.Max.x && occluder.Min.x < clip_rect.Max.x)
+            clip_rect.Max.x = occluder.Min.x;
+    }
+    return clip_rect.Min.x < clip_rect.Max.x && clip_rect.Min.y < clip_rect.Max.y;
+}
+
+// Remove draw commands whose ClipRect is entirely hidden behind the opaque area of draw lists rendered after them, and trim the ClipRect
+// of those partially hidden on one side (io.ConfigOcclusionCulling). Vertices and indices are left untouched: renderer backends need to
+// honor ImDrawCmd::IdxOffset. Lists with ImDrawListFlags_RetainContents are skipped, as their commands may be rendered again in a later frame.
+static void CullOccludedDrawCmds(ImVector<ImDrawList*>* draw_lists)
+{
+    ImGuiContext& g = *GImGui;
+    ImVector<ImRect>& occluders = g.DrawDataOccluders;
+    occluders.resize(0);
+    for (int list_n = draw_lists->Size - 1; list_n >= 0; list_n--)
+    {
+        ImDrawList* draw_list = draw_lists->Data[list_n];
+        if (occluders.Size > 0 && !(draw_list->Flags & ImDrawListFlags_RetainContents))
+        {
+            ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data;
+            for (ImDrawCmd* cmd = draw_list->CmdBuffer.Data, *cmd_end = cmd + draw_list->CmdBuffer.Size; cmd < cmd_end; cmd++)
+            {
+                bool visible = true;
+                if (cmd->UserCallback == NULL)
+                {
+                    ImRect clip_rect(cmd->ClipRect);
+                    for (int n = 0; n < occluders.Size && visible; n++)
+                        visible = TrimClipRectBehindOccluder(clip_rect, occluders[n]);
+                    cmd->ClipRect = clip_rect.ToVec4();
+                }
+                if (visible)
+                    *cmd_write++ = *cmd;
+            }
+            draw_list->CmdBuffer.resize((int)(cmd_write - draw_list->CmdBuffer.Data));
+        }
+        ImRect occlusion_rect(draw_list->_OcclusionRect);
+        if (occlusion_rect.Min.x < occlusion_rect.Max.x && occlusion_rect.Min.y < occlusion_rect.Max.y)
+        {
+            // Merge with occluders sharing a whole edge (e.g. tiled windows), so commands spanning both can be culled
+            for (int n = 0; n < occluders.Size; n++)
+            {
+                const ImRect& other = occluders[n];
+                const bool merge_x = (other.Min.y == occlusion_rect.Min.y && other.Max.y == occlusion_rect.Max.y && other.Min.x <= occlusion_rect.Max.x && other.Max.x >= occlusion_rect.Min.x);
+                const bool merge_y = (other.Min.x == occlusion_rect.Min.x && other.Max.x == occlusion_rect.Max.x && other.Min.y <= occlusion_rect.Max.y && other.Max.y >= occlusion_rect.Min.y);
+                if (merge_x || merge_y)
+                {
+                    occlusion_rect.Add(other);
+                    occluders.erase(occluders.Data + n);
+                    n = -1; // Restart: the larger rectangle may now be merged with other occluders
+                }
+            }
+            occluders.push_back(occlusion_rect);
+        }
+    }
+}
+
+// Gather draw commands using the same texture, so that e.g. text interleaved with images is rendered with fewer draw calls (io.ConfigReorderDrawCmds).
+// A command is moved back and merged into an earlier command with the same TextureId/VtxOffset when it doesn't overlap any command drawn in between,
+// so the result is visually identical. Clip rectangles need to match, unless both commands are entirely inside their clip rectangle.
+// Indices are rewritten in the new command order: IdxOffset of the output commands are contiguous.
+static void ReorderDrawCmds(ImDrawList* draw_list)
+{
+    ImGuiContext& g = *GImGui;
+    const int cmd_count = draw_list->CmdBuffer.Size;
+    if (cmd_count < 3)
+        return;
+
+    // Assign each command to a batch
+    const int lookback_max = 64; // Bound the cost of frames with many distinct textures
+    ImVector<ImDrawCmdReorderBatch>& batches = g.DrawDataReorderBatches;
+    ImVector<int>& cmd_batches = g.DrawDataReorderCmdBatches;
+    batches.resize(0);
+    cmd_batches.resize(cmd_count);
+    int merged_count = 0;
+    for (int cmd_n = 0; cmd_n < cmd_count; cmd_n++)
+    {
+        const ImDrawCmd* cmd = &draw_list->CmdBuffer.Data[cmd_n];
+        ImRect bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+        bool unclipped = false;
+        if (cmd->UserCallback == NULL)
+        {
+            if (cmd->ElemCount == 0)
+            {
+                cmd_batches[cmd_n] = -1;
+                continue;
+            }
+            const ImDrawVert* vtx = draw_list->VtxBuffer.Data + cmd->VtxOffset;
+            for (const ImDrawIdx* idx = draw_list->IdxBuffer.Data + cmd->IdxOffset, *idx_end = idx + cmd->ElemCount; idx < idx_end; idx++)
+                bounds.Add(vtx[*idx].pos);
+            const ImRect clip_rect(cmd->ClipRect);
+            unclipped = clip_rect.Contains(bounds);
+            bounds.ClipWithFull(clip_rect);
+
+            // Search for a compatible batch, stopping at callbacks and at batches drawing over this command
+            int merge_n = -1;
+            for (int batch_n = batches.Size - 1; batch_n >= 0 && batch_n >= batches.Size - lookback_max; batch_n--)
+            {
+                const ImDrawCmdReorderBatch& batch = batches[batch_n];
+                if (batch.Cmd.UserCallback != NULL)
+                    break;
+                if (batch.Cmd.TextureId == cmd->TextureId && batch.Cmd.VtxOffset == cmd->VtxOffset && ((batch.Unclipped && unclipped) || memcmp(&batch.Cmd.ClipRect, &cmd->ClipRect, sizeof(ImVec4)) == 0))
+                {
+                    merge_n = batch_n;
+                    break;
+                }
+                if (batch.Bounds.Overlaps(bounds))
+                    break;
+            }
+            if (merge_n != -1)
+            {
+                ImDrawCmdReorderBatch& batch = batches[merge_n];
+                batch.Cmd.ClipRect = ImVec4(ImMin(batch.Cmd.ClipRect.x, cmd->ClipRect.x), ImMin(batch.Cmd.ClipRect.y, cmd->ClipRect.y), ImMax(batch.Cmd.ClipRect.z, cmd->ClipRect.z), ImMax(batch.Cmd.ClipRect.w, cmd->ClipRect.w));
+                batch.Cmd.ElemCount += cmd->ElemCount;
+                batch.Bounds.Add(bounds);
+                batch.Unclipped &= unclipped;
+                cmd_batches[cmd_n] = merge_n;
+                merged_count++;
+                continue;
+            }
+        }
+        cmd_batches[cmd_n] = batches.Size;
+        ImDrawCmdReorderBatch batch;
+        batch.Cmd = *cmd;
+        batch.Bounds = bounds;
+        batch.Unclipped = unclipped;
+        batches.push_back(batch);
+    }
+    if (merged_count == 0 && batches.Size == cmd_count)
+        return;
+
+    // Rewrite indices in batch order, then commands
+    unsigned int idx_count = 0;
+    for (ImDrawCmdReorderBatch* batch = batches.Data, *batch_end = batch + batches.Size; batch < batch_end; batch++)
+    {
+        batch->Cmd.IdxOffset = batch->IdxWrite = idx_count;
+        if (batch->Cmd.UserCallback == NULL)
+            idx_count += batch->Cmd.ElemCount;
+    }
+    ImVector<ImDrawIdx>& idx_buffer = g.DrawDataReorderIdxBuffer;
+    idx_buffer.resize(draw_list->IdxBuffer.Size);
+    memcpy(idx_buffer.Data, draw_list->IdxBuffer.Data, (size_t)idx_buffer.Size * sizeof(ImDrawIdx));
+    for (int cmd_n = 0; cmd_n < cmd_count; cmd_n++)
+    {
+        const ImDrawCmd* cmd = &draw_list->CmdBuffer.Data[cmd_n];
+        if (cmd_batches[cmd_n] == -1 || cmd->UserCallback != NULL)
+            continue;
+        ImDrawCmdReorderBatch& batch = batches[cmd_batches[cmd_n]];
+        memcpy(draw_list->IdxBuffer.Data + batch.IdxWrite, idx_buffer.Data + cmd->IdxOffset, (size_t)cmd->ElemCount * sizeof(ImDrawIdx));
+        batch.IdxWrite += cmd->ElemCount;
+    }
+    draw_list->IdxBuffer.resize((int)idx_count);
+    draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + idx_count;
+    draw_list->CmdBuffer.resize(batches.Size);
+    for (int batch_n = 0; batch_n < batches.Size; batch_n++)
+        draw_list->CmdBuffer.Data[batch_n] = batches.Data[batch_n].Cmd;
+    draw_list->_CmdMergedCount += merged_count;
+}
+
+// Hash of a buffer, used to detect changes in draw lists (io.ConfigTrackDirtyRects). 64-bit, as a collision would leave a changed area on screen.
+// Faster than ImHashData() on large buffers: 4 independent lanes of 8 bytes per iteration, in the style of xxHash64.
+static inline ImU64 HashRotl64(ImU64 v, int r) { return (v << r) | (v >> (64 - r)); }
+static ImU64 HashDrawListBuffer(const void* data, size_t data_size, ImU64 seed)
+{
+    const ImU64 prime1 = 0x9E3779B185EBCA87ull, prime2 = 0xC2B2AE3D27D4EB4Full, prime3 = 0x165667B19E3779F9ull;
+    const unsigned char* p = (const unsigned char*)data;
+    const unsigned char* p_end = p + (data_size & ~(size_t)31);
+    ImU64 h0 = seed + prime1 + prime2, h1 = seed + prime2, h2 = seed, h3 = seed - prime1;
+    for (; p < p_end; p += 32)
+    {
+        ImU64 w[4];
+        memcpy(w, p, sizeof(w));
+        h0 = HashRotl64(h0 + w[0] * prime2, 31) * prime1;
+        h1 = HashRotl64(h1 + w[1] * prime2, 31) * prime1;
+        h2 = HashRotl64(h2 + w[2] * prime2, 31) * prime1;
+        h3 = HashRotl64(h3 + w[3] * prime2, 31) * prime1;
+    }
+    ImU64 h = HashRotl64(h0, 1) + HashRotl64(h1, 7) + HashRotl64(h2, 12) + HashRotl64(h3, 18) + (ImU64)data_size;
+    for (p_end = (const unsigned char*)data + data_size; p < p_end; p++)
+        h = HashRotl64(h + *p * prime3, 11) * prime1;
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+// Add an area to the dirty rectangles, merging it with those it overlaps. Past DIRTY_RECTS_MAX_COUNT, merge with the rectangle growing the least.
+static void AddDirtyRect(ImVector<ImVec4>* dirty_rects, ImRect rect, const ImRect& display_rect)
+{
+    rect.ClipWithFull(display_rect);
+    rect.Floor();
+    rect.Max = ImVec2(ImCeil(rect.Max.x), ImCeil(rect.Max.y));
+    if (rect.Min.x >= rect.Max.x || rect.Min.y >= rect.Max.y)
+        return;
+    for (;;)
+    {
+        for (int n = 0; n < dirty_rects->Size; n++)
+        {
+            const ImRect other((*dirty_rects)[n]);
+            if (other.Contains(rect))
+                return;
+            if (other.Overlaps(rect))
+            {
+                rect.Add(other);
+                dirty_rects->erase(dirty_rects->Data + n);
+                n = -1; // Restart: the larger rectangle may now overlap others
+            }
+        }
+        if (dirty_rects->Size < DIRTY_RECTS_MAX_COUNT)
+            break;
+        int best_n = 0;
+        float best_growth = FLT_MAX;
+        for (int n = 0; n < dirty_rects->Size; n++)
+        {
+            ImRect merged((*dirty_rects)[n]);
+            merged.Add(rect);
+            const float growth = merged.GetWidth() * merged.GetHeight() - ImRect((*dirty_rects)[n]).GetWidth() * ImRect((*dirty_rects)[n]).GetHeight();
+            if (growth < best_growth)
+            {
+                best_growth = growth;
+                best_n = n;
+            }
+        }
+        rect.Add((*dirty_rects)[best_n]);
+        dirty_rects->erase(dirty_rects->Data + best_n);
+    }
+    dirty_rects->push_back(rect.ToVec4());
+}
+
+// Area which may be touched by a draw list: union of its command clip rectangles, intersected with the bounding box of its vertices
+// (unless user callbacks draw something else).
+static ImRect CalcDrawListDirtyRect(const ImDrawList* draw_list, bool has_user_callbacks)
+{
+    ImRect rect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (const ImDrawCmd* cmd = draw_list->CmdBuffer.Data, *cmd_end = cmd + draw_list->CmdBuffer.Size; cmd < cmd_end; cmd++)
+        rect.Add(ImRect(cmd->ClipRect));
+    if (has_user_callbacks)
+        return rect;
+    ImRect vtx_bounds(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (const ImDrawVert* vtx = draw_list->VtxBuffer.Data, *vtx_end = vtx + draw_list->VtxBuffer.Size; vtx < vtx_end; vtx++)
+        vtx_bounds.Add((ImVec2)vtx->pos);
+    rect.ClipWithFull(vtx_bounds);
+    return rect;
+}
+
+static inline bool ImDrawListDirtyStateSameContents(const ImDrawListDirtyState& a, const ImDrawListDirtyState& b)
+{
+    return a.Hash == b.Hash && a.VtxCount == b.VtxCount && a.IdxCount == b.IdxCount && a.CmdCount == b.CmdCount;
+}
+
+// Compare the draw lists of this frame with those of the previous frame, to output the areas of the display which changed (io.ConfigTrackDirtyRects).
+// A draw list is unchanged when it has the same number of commands, indices and vertices which hash to the same value, and it is rendered in the
+// same order relative to other unchanged draw lists. Otherwise the areas it touches in both frames are dirty, as well as areas passed to MarkDirtyRect().
+// Must be called before modifying commands (e.g. occlusion culling) and before merging draw lists.
+static void UpdateDirtyRects(const ImVector<ImDrawList*>* draw_lists)
+{
+    ImGuiContext& g = *GImGui;
+    ImVector<ImVec4>& dirty_rects = g.DrawDataDirtyRects;
+    const ImRect display_rect(ImVec2(0.0f, 0.0f), g.IO.DisplaySize);
+    dirty_rects.resize(0);
+    if (!g.IO.ConfigTrackDirtyRects)
+    {
+        g.DrawDataDirtyRectsUser.resize(0);
+        g.DrawDataDirtyStates.resize(0);
+        g.DrawDataDirtyDisplayRect = ImRect();
+        dirty_rects.push_back(display_rect.ToVec4());
+        return;
+    }
+
+    // Changes of display size invalidate everything
+    const bool invalidate_all = (memcmp(&g.DrawDataDirtyDisplayRect, &display_rect, sizeof(ImRect)) != 0 || g.DrawDataDirtyFramebufferScale.x != g.IO.DisplayFramebufferScale.x || g.DrawDataDirtyFramebufferScale.y != g.IO.DisplayFramebufferScale.y);
+    g.DrawDataDirtyDisplayRect = display_rect;
+    g.DrawDataDirtyFramebufferScale = g.IO.DisplayFramebufferScale;
+
+    g.DrawDataDirtyStates.swap(g.DrawDataDirtyStatesPrev);
+    ImVector<ImDrawListDirtyState>& states = g.DrawDataDirtyStates;
+    ImVector<ImDrawListDirtyState>& states_prev = g.DrawDataDirtyStatesPrev;
+    for (int n = 0; n < states_prev.Size; n++)
+        states_prev[n].Matched = false;
+    states.resize(draw_lists->Size);
+    int prev_matched_n = -1;
+    for (int list_n = 0; list_n < draw_lists->Size; list_n++)
+    {
+        const ImDrawList* draw_list = draw_lists->Data[list_n];
+        ImDrawListDirtyState& state = states[list_n];
+        state.DrawList = draw_list;
+        state.Matched = false;
+        state.HasUserCallbacks = false;
+
+        // Hash commands (field by field, to skip padding), indices and vertices
+        ImU64 hash = HashDrawListBuffer(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes(), 0);
+        hash = HashDrawListBuffer(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes(), hash);
+        for (const ImDrawCmd* cmd = draw_list->CmdBuffer.Data, *cmd_end = cmd + draw_list->CmdBuffer.Size; cmd < cmd_end; cmd++)
+        {
+            struct { ImVec4 ClipRect; ImTextureID TextureId; ImDrawCallback UserCallback; void* UserCallbackData; unsigned int VtxOffset, IdxOffset, ElemCount; } cmd_key;
+            memset(&cmd_key, 0, sizeof(cmd_key));
+            cmd_key.ClipRect = cmd->ClipRect;
+            cmd_key.TextureId = cmd->TextureId;
+            cmd_key.UserCallback = cmd->UserCallback;
+            cmd_key.UserCallbackData = cmd->UserCallbackData;
+            cmd_key.VtxOffset = cmd->VtxOffset;
+            cmd_key.IdxOffset = cmd->IdxOffset;
+            cmd_key.ElemCount = cmd->ElemCount;
+            hash = HashDrawListBuffer(&cmd_key, sizeof(cmd_key), hash);
+            if (cmd->UserCallback != NULL && cmd->UserCallback != ImDrawCallback_ResetRenderState)
+                state.HasUserCallbacks = true; // We don't know what they draw: always dirty
+        }
+        state.Hash = hash;
+        state.VtxCount = draw_list->VtxBuffer.Size;
+        state.IdxCount = draw_list->IdxBuffer.Size;
+        state.CmdCount = draw_list->CmdBuffer.Size;
+
+        // Find the same draw list in the previous frame, after the last one matched so the order of unchanged draw lists is preserved
+        int prev_n = -1;
+        for (int n = prev_matched_n + 1; n < states_prev.Size && prev_n == -1; n++)
+            if (states_prev[n].DrawList == draw_list)
+                prev_n = n;
+        if (prev_n != -1 && ImDrawListDirtyStateSameContents(states_prev[prev_n], state) && !states_prev[prev_n].HasUserCallbacks && !state.HasUserCallbacks)
+        {
+            state.Rect = states_prev[prev_n].Rect;
+            state.Matched = states_prev[prev_n].Matched = true;
+            prev_matched_n = prev_n;
+            continue;
+        }
+        state.Rect = CalcDrawListDirtyRect(draw_list, state.HasUserCallbacks);
+        if (!invalidate_all)
+            AddDirtyRect(&dirty_rects, state.Rect, display_rect);
+    }
+
+    // Areas touched by draw lists which changed or disappeared, and areas marked by the user (e.g. changing texture contents)
+    if (!invalidate_all)
+    {
+        for (int n = 0; n < states_prev.Size; n++)
+            if (!states_prev[n].Matched)
+                AddDirtyRect(&dirty_rects, states_prev[n].Rect, display_rect);
+        for (int n = 0; n < g.DrawDataDirtyRectsUser.Size; n++)
+            AddDirtyRect(&dirty_rects, g.DrawDataDirtyRectsUser[n], display_rect);
+    }
+    else
+    {
+        AddDirtyRect(&dirty_rects, display_rect, display_rect);
+    }
+    g.DrawDataDirtyRectsUser.resize(0);
+}
+
 static void AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* draw_list)
 {
     // Remove trailing command if unused.
@@ -4103,6 +4508,7 @@ static void AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* d
     draw_list->_PopUnusedDrawCmd();
     if (draw_list->CmdBuffer.Size == 0)
         return;
+    draw_list->_TryMergeDrawCmds();
 
     // Draw list sanity check. Detect mismatch between PrimReserve() calls and incrementing _VtxCurrentIdx, _VtxWritePtr etc.
     // May trigger for you if you are using PrimXXX functions incorrectly.
@@ -4136,6 +4542,12 @@ static void AddWindowToDrawData(ImVector<ImDrawList*>* out_render_list, ImGuiWin
 {
     ImGuiContext& g = *GImGui;
     g.IO.MetricsRenderWindows++;
+
+    // Draw lists of windows which may be frozen on the next frame must keep their contents (ImGuiWindowFlags_FreezeWhenIdle)
+    if (window->RootWindow->FreezeAllowed)
+        window->DrawList->Flags |= ImDrawListFlags_RetainContents;
+    else
+        window->DrawList->Flags &= ~ImDrawListFlags_RetainContents;
     AddDrawListToDrawData(out_render_list, window->DrawList);
     for (int i = 0; i < window->DC.ChildWindows.Size; i++)
     {
@@ -4171,6 +4583,79 @@ void ImDrawDataBuilder::FlattenIntoSingleLayer()
     }
 }
 
+// Copy all draw lists of the first layer into 'merged_list' and make it the only draw list to render, so renderer backends can upload a single vertex/index buffer.
+// - Indices are rebased when the total vertex count fits in ImDrawIdx, which also allows merging matching commands at the boundary between two draw lists.
+// - Otherwise the command VtxOffset/IdxOffset fields are rebased, which requires support for ImDrawCmd::VtxOffset.
+// Return false and leave the layer untouched if vertices can't be addressed.
+bool ImDrawDataBuilder::MergeIntoSingleDrawList(ImDrawList* merged_list, bool allow_vtx_offset)
+{
+    ImVector<ImDrawList*>& layer = Layers[0];
+    int vtx_count = 0, idx_count = 0, cmd_count = 0, cmd_merged_count = 0;
+    for (int n = 0; n < layer.Size; n++)
+    {
+        vtx_count += layer[n]->VtxBuffer.Size;
+        idx_count += layer[n]->IdxBuffer.Size;
+        cmd_count += layer[n]->CmdBuffer.Size;
+        cmd_merged_count += layer[n]->_CmdMergedCount;
+    }
+    const bool rebase_indices = (sizeof(ImDrawIdx) == 4 || vtx_count <= (1 << 16));
+    if (!rebase_indices && !allow_vtx_offset)
+        return false;
+
+    merged_list->CmdBuffer.resize(cmd_count);
+    merged_list->IdxBuffer.resize(idx_count);
+    merged_list->VtxBuffer.resize(vtx_count);
+    merged_list->Flags = layer[0]->Flags;
+    ImDrawCmd* cmd_write = merged_list->CmdBuffer.Data;
+    ImDrawIdx* idx_write = merged_list->IdxBuffer.Data;
+    ImDrawVert* vtx_write = merged_list->VtxBuffer.Data;
+    ImDrawCmd* last_cmd = NULL;
+    for (int n = 0; n < layer.Size; n++)
+    {
+        const ImDrawList* draw_list = layer[n];
+        const unsigned int vtx_base = (unsigned int)(vtx_write - merged_list->VtxBuffer.Data);
+        const unsigned int idx_base = (unsigned int)(idx_write - merged_list->IdxBuffer.Data);
+        memcpy(vtx_write, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        vtx_write += draw_list->VtxBuffer.Size;
+        if (rebase_indices)
+        {
+            // Lists using 16-bit indices and more than 64K vertices would have been rejected above, so VtxOffset is always 0 here.
+            for (const ImDrawIdx* idx_read = draw_list->IdxBuffer.Data, *idx_end = idx_read + draw_list->IdxBuffer.Size; idx_read < idx_end; idx_read++)
+                *idx_write++ = (ImDrawIdx)(*idx_read + vtx_base);
+        }
+        else
+        {
+            memcpy(idx_write, draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+            idx_write += draw_list->IdxBuffer.Size;
+        }
+        for (const ImDrawCmd* cmd = draw_list->CmdBuffer.Data, *cmd_end = cmd + draw_list->CmdBuffer.Size; cmd < cmd_end; cmd++)
+        {
+            ImDrawCmd merged_cmd = *cmd;
+            merged_cmd.IdxOffset += idx_base;
+            if (!rebase_indices)
+                merged_cmd.VtxOffset += vtx_base;
+            if (last_cmd && last_cmd->UserCallback == NULL && merged_cmd.UserCallback == NULL && last_cmd->IdxOffset + last_cmd->ElemCount == merged_cmd.IdxOffset
+                && memcmp(&last_cmd->ClipRect, &merged_cmd.ClipRect, sizeof(ImVec4)) == 0 && last_cmd->TextureId == merged_cmd.TextureId && last_cmd->VtxOffset == merged_cmd.VtxOffset)
+            {
+                last_cmd->ElemCount += merged_cmd.ElemCount;
+                cmd_merged_count++;
+                continue;
+            }
+            *cmd_write = merged_cmd;
+            last_cmd = cmd_write++;
+        }
+    }
+    merged_list->CmdBuffer.resize((int)(cmd_write - merged_list->CmdBuffer.Data));
+    merged_list->_CmdMergedCount = cmd_merged_count;
+    merged_list->_VtxCurrentIdx = (unsigned int)vtx_count;
+    merged_list->_VtxWritePtr = vtx_write;
+    merged_list->_IdxWritePtr = idx_write;
+
+    layer.resize(1);
+    layer[0] = merged_list;
+    return true;
+}
+
 static void SetupDrawData(ImVector<ImDrawList*>* draw_lists, ImDrawData* draw_data)
 {
     ImGuiIO& io = ImGui::GetIO();
@@ -4181,6 +4666,8 @@ static void SetupDrawData(ImVector<ImDrawList*>* draw_lists, ImDrawData* draw_da
     draw_data->DisplayPos = ImVec2(0.0f, 0.0f);
     draw_data->DisplaySize = io.DisplaySize;
     draw_data->FramebufferScale = io.DisplayFramebufferScale;
+    draw_data->DirtyRects = GImGui->DrawDataDirtyRects.Data;
+    draw_data->DirtyRectsCount = GImGui->DrawDataDirtyRects.Size;
     for (int n = 0; n < draw_lists->Size; n++)
     {
         draw_data->TotalVtxCount += draw_lists->Data[n]->VtxBuffer.Size;
@@ -4208,6 +4695,48 @@ void ImGui::PopClipRect()
     window->ClipRect = window->DrawList->_ClipRectStack.back();
 }
 
+// Inputs, and state changes which will keep changing the UI over the next frames without further inputs, start the next frames
+// right away. Otherwise the application may wait for inputs until the earliest time requested with SetMaxWaitBeforeNextFrame().
+void ImGui::UpdateMaxWaitBeforeNextFrame()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+
+    bool is_active = (io.MouseDelta.x != 0.0f || io.MouseDelta.y != 0.0f || io.MouseWheel != 0.0f || io.MouseWheelH != 0.0f);
+    is_active |= (io.KeyCtrl || io.KeyShift || io.KeyAlt || io.KeySuper || io.InputQueueCharacters.Size > 0 || io.WantSetMousePos);
+    for (int n = 0; n < IM_ARRAYSIZE(io.MouseDown) && !is_active; n++)
+        is_active = io.MouseDown[n] || io.MouseReleased[n];
+    for (int n = 0; n < IM_ARRAYSIZE(io.KeysDown) && !is_active; n++)
+        is_active = io.KeysDown[n];
+    for (int n = 0; n < IM_ARRAYSIZE(io.NavInputs) && !is_active; n++)
+        is_active = io.NavInputs[n] > 0.0f;
+
+    // Hovering/activation changes, window moving, drag and drop, CTRL+Tab, navigation requests, background dimming
+    is_active |= (g.HoveredId != g.HoveredIdPreviousFrame || g.ActiveId != g.ActiveIdPreviousFrame || g.MovingWindow != NULL || g.DragDropActive);
+    is_active |= (g.NavWindowingTarget != NULL || g.NavInitRequest || g.NavMoveRequest || g.NavMoveRequestForward != ImGuiNavForward_None);
+    is_active |= (g.DimBgRatio > 0.0f && g.DimBgRatio < 1.0f);
+
+    // Windows appearing, auto-fitting, measuring their contents while hidden, or scrolling to a target
+    for (int n = 0; n < g.Windows.Size && !is_active; n++)
+    {
+        ImGuiWindow* window = g.Windows[n];
+        if (!window->Active)
+            continue;
+        is_active = window->Appearing || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->HiddenFramesCanSkipItems > 0 || window->HiddenFramesCannotSkipItems > 0;
+        is_active |= (window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX);
+    }
+
+    // Save .ini settings when their timer elapses
+    if (g.SettingsDirtyTimer > 0.0f)
+        SetMaxWaitBeforeNextFrame(g.SettingsDirtyTimer);
+
+    if (is_active)
+        g.ActivityFramesLeft = ACTIVITY_FRAMES_AFTER_INPUTS;
+    io.MaxWaitBeforeNextFrame = (g.ActivityFramesLeft > 0) ? 0.0f : g.MaxWaitBeforeNextFrame;
+    if (g.ActivityFramesLeft > 0)
+        g.ActivityFramesLeft--;
+}
+
 // This is normally called by Render(). You may want to call it directly if you want to avoid calling Render() but the gain will be very minimal.
 void ImGui::EndFrame()
 {
@@ -4283,6 +4812,9 @@ void ImGui::EndFrame()
     // Unlock font atlas
     g.IO.Fonts->Locked = false;
 
+    // Tell the application how long it may wait for inputs before the next frame (needs this frame's inputs)
+    UpdateMaxWaitBeforeNextFrame();
+
     // Clear Input data for next frame
     g.IO.MouseWheel = g.IO.MouseWheelH = 0.0f;
     g.IO.InputQueueCharacters.resize(0);
@@ -4331,10 +4863,39 @@ void ImGui::Render()
     if (!g.ForegroundDrawList.VtxBuffer.empty())
         AddDrawListToDrawData(&g.DrawDataBuilder.Layers[0], &g.ForegroundDrawList);
 
+    // Tessellate primitives recorded by draw lists (io.ConfigDeferredTessellation)
+    if (g.IO.ConfigDeferredTessellation)
+        FlushDeferredDrawLists(&g.DrawDataBuilder.Layers[0]);
+
+    // Find the areas of the display which changed since the previous frame (io.ConfigTrackDirtyRects)
+    UpdateDirtyRects(&g.DrawDataBuilder.Layers[0]);
+
+    // Remove draw commands hidden behind opaque windows (io.ConfigOcclusionCulling)
+    if (g.IO.ConfigOcclusionCulling && (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset))
+        CullOccludedDrawCmds(&g.DrawDataBuilder.Layers[0]);
+
+    // Merge all draw lists into a single one if requested by the renderer backend
+    if ((g.IO.BackendFlags & ImGuiBackendFlags_RendererMergeDrawLists) && g.DrawDataBuilder.Layers[0].Size > 1)
+        g.DrawDataBuilder.MergeIntoSingleDrawList(&g.MergedDrawList, (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset) != 0);
+
+    // Gather draw commands using the same texture (io.ConfigReorderDrawCmds). Contents of frozen windows are rendered as is.
+    if (g.IO.ConfigReorderDrawCmds)
+        for (int n = 0; n < g.DrawDataBuilder.Layers[0].Size; n++)
+        {
+            ImDrawList* draw_list = g.DrawDataBuilder.Layers[0][n];
+            if (draw_list == &g.MergedDrawList || !(draw_list->Flags & ImDrawListFlags_RetainContents))
+                ReorderDrawCmds(draw_list);
+        }
+
     // Setup ImDrawData structure for end-user
     SetupDrawData(&g.DrawDataBuilder.Layers[0], &g.DrawData);
     g.IO.MetricsRenderVertices = g.DrawData.TotalVtxCount;
     g.IO.MetricsRenderIndices = g.DrawData.TotalIdxCount;
+    g.IO.MetricsRenderDrawCalls = 0;
+    for (int n = 0; n < g.DrawData.CmdListsCount; n++)
+        for (const ImDrawCmd* cmd = g.DrawData.CmdLists[n]->CmdBuffer.Data, *cmd_end = cmd + g.DrawData.CmdLists[n]->CmdBuffer.Size; cmd < cmd_end; cmd++)
+            if (cmd->UserCallback == NULL && cmd->ElemCount > 0)
+                g.IO.MetricsRenderDrawCalls++;
 
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
 }
@@ -5204,6 +5765,8 @@ static bool ImGui::UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& s
         ImRect border_rect = GetResizeBorderRect(window, border_n, grip_hover_inner_size, WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS);
         ButtonBehavior(border_rect, window->GetID(border_n + 4), &hovered, &held, ImGuiButtonFlags_FlattenChildren);
         //GetForegroundDrawLists(window)->AddRect(border_rect.Min, border_rect.Max, IM_COL32(255, 255, 0, 255));
+        if (hovered && g.HoveredIdTimer <= WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER)
+            SetMaxWaitBeforeNextFrame(WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER - g.HoveredIdTimer);
         if ((hovered && g.HoveredIdTimer > WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER) || held)
         {
             g.MouseCursor = (border_n & 1) ? ImGuiMouseCursor_ResizeEW : ImGuiMouseCursor_ResizeNS;
@@ -5315,6 +5878,7 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
     // As we highlight the title bar when want_focus is set, multiple reappearing windows will have have their title bar highlighted on their reappearing frame.
     const float window_rounding = window->WindowRounding;
     const float window_border_size = window->WindowBorderSize;
+    ImRect occlusion_rect;
     if (window->Collapsed)
     {
         // Title bar only
@@ -5340,6 +5904,8 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
             if (override_alpha)
                 bg_col = (bg_col & ~IM_COL32_A_MASK) | (IM_F32_TO_INT8_SAT(alpha) << IM_COL32_A_SHIFT);
             window->DrawList->AddRectFilled(window->Pos + ImVec2(0, window->TitleBarHeight()), window->Pos + window->Size, bg_col, window_rounding, (flags & ImGuiWindowFlags_NoTitleBar) ? ImDrawCornerFlags_All : ImDrawCornerFlags_Bot);
+            if ((bg_col & IM_COL32_A_MASK) == IM_COL32_A_MASK)
+                occlusion_rect = ImRect(window->Pos + ImVec2(0, window->TitleBarHeight()), window->Pos + window->Size);
         }
 
         // Title bar
@@ -5347,6 +5913,20 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
         {
             ImU32 title_bar_col = GetColorU32(title_bar_is_highlight ? ImGuiCol_TitleBgActive : ImGuiCol_TitleBg);
             window->DrawList->AddRectFilled(title_bar_rect.Min, title_bar_rect.Max, title_bar_col, window_rounding, ImDrawCornerFlags_Top);
+            if ((title_bar_col & IM_COL32_A_MASK) == IM_COL32_A_MASK && occlusion_rect.Max.y > occlusion_rect.Min.y)
+                occlusion_rect.Min.y = title_bar_rect.Min.y;
+        }
+
+        // Opaque area (io.ConfigOcclusionCulling): shrink to whole pixels, excluding rounded corners and their anti-aliased edges, clip to parent.
+        // A rounded corner of radius R never covers less than the rectangle inset by R*(1-1/sqrt(2)) ~= 0.3*R.
+        if (occlusion_rect.Max.y > occlusion_rect.Min.y)
+        {
+            if (window_rounding > 0.0f)
+                occlusion_rect.Expand(-(1.0f + window_rounding * 0.3f));
+            occlusion_rect.ClipWithFull(window->OuterRectClipped);
+            occlusion_rect = ImRect(ImCeil(occlusion_rect.Min.x), ImCeil(occlusion_rect.Min.y), ImFloor(occlusion_rect.Max.x), ImFloor(occlusion_rect.Max.y));
+            if (occlusion_rect.IsInverted())
+                occlusion_rect = ImRect();
         }
 
         // Menu bar
@@ -5382,6 +5962,10 @@ void ImGui::RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar
         // Borders
         RenderWindowOuterBorders(window);
     }
+
+    // Child windows rendering their decorations in their parent's draw list don't alter its opaque area
+    if (window->DrawList == &window->DrawListInst)
+        window->DrawList->_OcclusionRect = occlusion_rect.ToVec4();
 }
 
 // Render title text, collapse button, close button
@@ -5530,6 +6114,8 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     // Update Flags, LastFrameActive, BeginOrderXXX fields
     if (first_begin_of_the_frame)
     {
+        if (window->Flags != flags)
+            window->FreezeAllowed = false;
         window->Flags = (ImGuiWindowFlags)flags;
         window->LastFrameActive = current_frame;
         window->LastTimeActive = (float)g.Time;
@@ -5620,6 +6206,28 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     if (window->Appearing)
         SetWindowConditionAllowFlags(window, ImGuiCond_Appearing, false);
 
+    // Frozen window: nothing changed since the draw list was built, so we render it again and skip submission (ImGuiWindowFlags_FreezeWhenIdle)
+    // Child windows of a frozen window are kept alive the same way. We don't touch the draw list here, so End() won't pop the clip rectangle.
+    // Until End(), the window uses a scratch draw list so that GetWindowDrawList(), PushFont() etc. don't alter the retained draw list.
+    if (first_begin_of_the_frame)
+        window->Frozen = (parent_window && parent_window->Frozen && (flags & ImGuiWindowFlags_ChildWindow)) || IsWindowFreezable(window);
+    if (window->Frozen)
+    {
+        if (first_begin_of_the_frame)
+        {
+            window->Active = window->WasActive;
+            if (window->Active)
+                KeepAliveFrozenChildWindows(window);
+        }
+        window->DrawList = &g.FrozenWindowsDrawList;
+        SetCurrentWindow(window);
+        window->BeginCount++;
+        window->SkipItems = true;
+        g.NextWindowData.ClearFlags();
+        SetLastItemData(window, window->MoveId, 0, window->TitleBarRect());
+        return false;
+    }
+
     // When reusing window again multiple times a frame, just append content (don't need to setup again)
     if (first_begin_of_the_frame)
     {
@@ -6119,11 +6727,74 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
             if (window->AutoFitFramesX <= 0 && window->AutoFitFramesY <= 0 && window->HiddenFramesCannotSkipItems <= 0)
                 skip_items = true;
         window->SkipItems = skip_items;
+
+        // Allow next frame to reuse the draw list if we built it while idle (ImGuiWindowFlags_FreezeWhenIdle)
+        const bool freeze_supported = (flags & ImGuiWindowFlags_FreezeWhenIdle) && !(flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_Popup | ImGuiWindowFlags_Tooltip));
+        window->FreezeAllowed = freeze_supported && !window->Hidden && window->AutoFitFramesX <= 0 && window->AutoFitFramesY <= 0 && IsWindowIdle(window);
+        window->FreezeRect = ImRect(window->Pos, window->Pos + window->SizeFull);
+        window->FreezeDisplaySize = g.IO.DisplaySize;
     }
 
     return !window->SkipItems;
 }
 
+// Return true when nothing which may affect the rendering of the window is going on: hovering, focus, active item, moving, popups opened from it, CTRL+Tab.
+static bool IsWindowIdle(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* root_window = window->RootWindow;
+    if (g.HoveredRootWindow == root_window || g.NavWindowingTargetAnim != NULL)
+        return false;
+    if (g.NavWindow && g.NavWindow->RootWindowForTitleBarHighlight == window->RootWindowForTitleBarHighlight)
+        return false;
+    if ((g.ActiveIdWindow && g.ActiveIdWindow->RootWindow == root_window) || (g.MovingWindow && g.MovingWindow->RootWindow == root_window))
+        return false;
+    for (int n = 0; n < g.OpenPopupStack.Size; n++)
+    {
+        const ImGuiPopupData& popup = g.OpenPopupStack[n];
+        if (popup.SourceWindow && popup.SourceWindow->RootWindow == root_window)
+            return false;
+        if (popup.Window && popup.Window->ParentWindow && popup.Window->ParentWindow->RootWindow == root_window)
+            return false;
+    }
+    return true;
+}
+
+// Return true when the draw list built on a previous frame can be rendered again as is.
+// Changes to user data, style or fonts are not tracked: call InvalidateWindow() to force a rebuild.
+static bool IsWindowFreezable(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    if (!window->FreezeAllowed || !window->WasActive || window->Appearing || window->Hidden)
+        return false;
+    if (window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX)
+        return false;
+    if (g.NextWindowData.Flags & (ImGuiNextWindowDataFlags_HasCollapsed | ImGuiNextWindowDataFlags_HasFocus | ImGuiNextWindowDataFlags_HasScroll))
+        return false;
+    const ImRect& r = window->FreezeRect;
+    if (window->Pos.x != r.Min.x || window->Pos.y != r.Min.y || window->Pos.x + window->SizeFull.x != r.Max.x || window->Pos.y + window->SizeFull.y != r.Max.y)
+        return false;
+    if (g.IO.DisplaySize.x != window->FreezeDisplaySize.x || g.IO.DisplaySize.y != window->FreezeDisplaySize.y)
+        return false;
+    return IsWindowIdle(window);
+}
+
+// Child windows of a frozen window are not submitted but their draw lists from last frame still need to be rendered.
+static void KeepAliveFrozenChildWindows(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    for (int i = 0; i < window->DC.ChildWindows.Size; i++)
+    {
+        ImGuiWindow* child = window->DC.ChildWindows[i];
+        if (!child->WasActive)
+            continue;
+        child->Active = child->Frozen = true;
+        child->LastFrameActive = g.FrameCount;
+        child->LastTimeActive = (float)g.Time;
+        KeepAliveFrozenChildWindows(child);
+    }
+}
+
 void ImGui::End()
 {
     ImGuiContext& g = *GImGui;
@@ -6144,7 +6815,10 @@ void ImGui::End()
     // Close anything that is open
     if (window->DC.CurrentColumns)
         EndColumns();
-    PopClipRect();   // Inner window clip rectangle
+    if (window->Frozen)
+        window->DrawList = &window->DrawListInst;
+    else
+        PopClipRect();   // Inner window clip rectangle
 
     // Stop logging
     if (!(window->Flags & ImGuiWindowFlags_ChildWindow))    // FIXME: add more options for scope of logging
@@ -6282,6 +6956,8 @@ void ImGui::SetCurrentFont(ImFont* font)
     ImFontAtlas* atlas = g.Font->ContainerAtlas;
     g.DrawListSharedData.TexUvWhitePixel = atlas->TexUvWhitePixel;
     g.DrawListSharedData.TexUvLines = atlas->TexUvLines;
+    g.DrawListSharedData.TexUvRoundCornerFilled = atlas->TexUvRoundCornerFilled;
+    g.DrawListSharedData.TexUvRoundCornerStroked = atlas->TexUvRoundCornerStroked;
     g.DrawListSharedData.Font = g.Font;
     g.DrawListSharedData.FontSize = g.FontSize;
 }
@@ -6584,6 +7260,22 @@ void ImGui::SetWindowFocus()
     FocusWindow(GImGui->CurrentWindow);
 }
 
+void ImGui::InvalidateWindow(ImGuiWindow* window)
+{
+    window->RootWindow->FreezeAllowed = false;
+}
+
+void ImGui::InvalidateWindow()
+{
+    InvalidateWindow(GImGui->CurrentWindow);
+}
+
+void ImGui::InvalidateWindow(const char* name)
+{
+    if (ImGuiWindow* window = FindWindowByName(name))
+        InvalidateWindow(window);
+}
+
 void ImGui::SetWindowFocus(const char* name)
 {
     if (name)
@@ -6888,6 +7580,7 @@ static void ImGui::ErrorCheckNewFrameSanityChecks()
     IM_ASSERT(g.IO.DisplaySize.x >= 0.0f && g.IO.DisplaySize.y >= 0.0f  && "Invalid DisplaySize value!");
     IM_ASSERT(g.IO.Fonts->Fonts.Size > 0                                && "Font Atlas not built. Did you call io.Fonts->GetTexDataAsRGBA32() / GetTexDataAsAlpha8() ?");
     IM_ASSERT(g.IO.Fonts->Fonts[0]->IsLoaded()                          && "Font Atlas not built. Did you call io.Fonts->GetTexDataAsRGBA32() / GetTexDataAsAlpha8() ?");
+    IM_ASSERT((g.IO.Fonts->DynamicGlyphs.Size == 0 || (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTexUpdates)) && "ImFontConfig::DynamicGlyphs requires a renderer backend uploading ImFontAtlas::TexDirtyRects (ImGuiBackendFlags_RendererHasTexUpdates), otherwise glyphs are drawn blank.");
     IM_ASSERT(g.Style.CurveTessellationTol > 0.0f                       && "Invalid style setting!");
     IM_ASSERT(g.Style.CircleSegmentMaxError > 0.0f                      && "Invalid style setting!");
     IM_ASSERT(g.Style.Alpha >= 0.0f && g.Style.Alpha <= 1.0f            && "Invalid style setting. Alpha cannot be negative (allows us to avoid a few clamps in color computations)!");
@@ -10374,6 +11067,19 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     ImGui::Text("Dear ImGui %s", ImGui::GetVersion());
     ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     ImGui::Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
+    {
+        int draw_cmd_merged_count = 0;
+        for (int n = 0; n < g.DrawData.CmdListsCount; n++)
+            draw_cmd_merged_count += g.DrawData.CmdLists[n]->_CmdMergedCount;
+        ImGui::Text("%d draw calls (%d saved by merging)", io.MetricsRenderDrawCalls, draw_cmd_merged_count);
+    }
+    if (io.ConfigTrackDirtyRects)
+    {
+        float dirty_area = 0.0f;
+        for (int n = 0; n < g.DrawData.DirtyRectsCount; n++)
+            dirty_area += ImRect(g.DrawData.DirtyRects[n]).GetWidth() * ImRect(g.DrawData.DirtyRects[n]).GetHeight();
+        ImGui::Text("%d dirty rectangles (%.1f%% of display)", g.DrawData.DirtyRectsCount, (io.DisplaySize.x > 0.0f && io.DisplaySize.y > 0.0f) ? dirty_area * 100.0f / (io.DisplaySize.x * io.DisplaySize.y) : 0.0f);
+    }
     ImGui::Text("%d active windows (%d visible)", io.MetricsActiveWindows, io.MetricsRenderWindows);
     ImGui::Text("%d active allocations", io.MetricsActiveAllocations);
     ImGui::Separator();
@@ -10565,6 +11271,43 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         Text("NavWindowingTarget: '%s'", g.NavWindowingTarget ? g.NavWindowingTarget->Name : "NULL");
         Unindent();
 
+        Text("IDLE");
+        Indent();
+        if (g.IO.MaxWaitBeforeNextFrame == FLT_MAX)
+            Text("MaxWaitBeforeNextFrame: FLT_MAX (wait for inputs)"); // Value computed by the previous frame
+        else
+            Text("MaxWaitBeforeNextFrame: %.3f sec", g.IO.MaxWaitBeforeNextFrame);
+        Text("ActivityFramesLeft: %d", g.ActivityFramesLeft);
+        Unindent();
+
+        Text("FONT INDEX");
+        Indent();
+        for (int n = 0; n < g.IO.Fonts->Fonts.Size; n++)
+        {
+            // Compare with a dense index of every codepoint up to the highest one
+            const ImFont* font = g.IO.Fonts->Fonts[n];
+            unsigned int max_codepoint = 0;
+            for (int glyph_n = 0; glyph_n < font->Glyphs.Size; glyph_n++)
+                max_codepoint = ImMax(max_codepoint, font->Glyphs[glyph_n].Codepoint);
+            const int dense_size = font->Glyphs.Size ? (int)(max_codepoint + 1) * (int)(sizeof(ImWchar) + sizeof(float)) : 0;
+            const int paged_size = font->GetIndexMemoryUsage();
+            BulletText("Font '%s': %d glyphs up to U+%04X, %d pages, index %d KB (dense: %d KB, saved %d KB)",
+                font->GetDebugName(), font->Glyphs.Size, max_codepoint, (font->IndexLookup.Size ? 1 : 0) + (font->IndexPagesLookup.Size / 4096),
+                paged_size / 1024, dense_size / 1024, (dense_size - paged_size) / 1024);
+        }
+        Unindent();
+
+        Text("DYNAMIC GLYPHS");
+        Indent();
+        for (int n = 0; n < g.IO.Fonts->DynamicGlyphs.Size; n++)
+        {
+            const ImFontDynamicGlyphs* dynamic_glyphs = g.IO.Fonts->DynamicGlyphs[n];
+            BulletText("Input '%s': %d glyphs, %d/%d slots of %dx%d px, %d rasterized, %d evicted, %d overflows",
+                g.IO.Fonts->ConfigData[dynamic_glyphs->ConfigIndex].Name, dynamic_glyphs->GlyphsCount, dynamic_glyphs->SlotsUsed, dynamic_glyphs->SlotsGlyph.Size,
+                dynamic_glyphs->SlotWidth, dynamic_glyphs->SlotHeight, dynamic_glyphs->RasterizedCount, dynamic_glyphs->EvictedCount, dynamic_glyphs->OverflowCount);
+        }
+        Unindent();
+
         TreePop();
     }
 
@@ -10633,6 +11376,8 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, const ImDrawList* draw_list,
     int cmd_count = draw_list->CmdBuffer.Size;
     if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
         cmd_count--;
+    if (draw_list != GetWindowDrawList())
+        ((ImDrawList*)draw_list)->_FlushDeferredPrims(); // Needed to display triangles of a deferred tessellation draw list before Render()
     bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
     if (draw_list == GetWindowDrawList())
     {
@@ -10830,6 +11575,8 @@ void ImGui::DebugNodeWindow(ImGuiWindow* window, const char* label)
     BulletText("Scroll: (%.2f/%.2f,%.2f/%.2f) Scrollbar:%s%s", window->Scroll.x, window->ScrollMax.x, window->Scroll.y, window->ScrollMax.y, window->ScrollbarX ? "X" : "", window->ScrollbarY ? "Y" : "");
     BulletText("Active: %d/%d, WriteAccessed: %d, BeginOrderWithinContext: %d", window->Active, window->WasActive, window->WriteAccessed, (window->Active || window->WasActive) ? window->BeginOrderWithinContext : -1);
     BulletText("Appearing: %d, Hidden: %d (CanSkip %d Cannot %d), SkipItems: %d", window->Appearing, window->Hidden, window->HiddenFramesCanSkipItems, window->HiddenFramesCannotSkipItems, window->SkipItems);
+    if (window->Flags & ImGuiWindowFlags_FreezeWhenIdle)
+        BulletText("Frozen: %d, FreezeAllowed: %d", window->Frozen, window->FreezeAllowed);
     BulletText("NavLastIds: 0x%08X,0x%08X, NavLayerActiveMask: %X", window->NavLastIds[0], window->NavLastIds[1], window->DC.NavLayerActiveMask);
     BulletText("NavLastChildNavWindow: %s", window->NavLastChildNavWindow ? window->NavLastChildNavWindow->Name : "NULL");
     if (!window->NavRectRel[0].IsInverted())
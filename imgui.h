@@ -114,13 +114,17 @@ Index of this file:
 struct ImDrawChannel;               // Temporary storage to output draw commands out of order, used by ImDrawListSplitter and ImDrawList::ChannelsSplit()
 struct ImDrawCmd;                   // A single draw command within a parent ImDrawList (generally maps to 1 GPU draw call, unless it is a callback)
 struct ImDrawData;                  // All draw command lists required to render the frame + pos/size coordinates to use for the projection matrix.
+struct ImDrawDataSnapshot;          // Storage for one ImDrawData snapshot of an ImDrawDataSnapshotRing
+struct ImDrawDataSnapshotRing;      // Ring of ImDrawData snapshots taken without copying vertices, to render on a separate thread
+struct ImDrawDeferredPrim;          // A primitive recorded by ImDrawList in deferred tessellation mode, tessellated in Render()
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
+struct ImFontDynamicGlyphs;         // Cache of glyphs rasterized on demand for a font input using ImFontConfig::DynamicGlyphs
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
@@ -322,6 +326,8 @@ namespace ImGui
     IMGUI_API void          SetWindowSize(const char* name, const ImVec2& size, ImGuiCond cond = 0);    // set named window size. set axis to 0.0f to force an auto-fit on this axis.
     IMGUI_API void          SetWindowCollapsed(const char* name, bool collapsed, ImGuiCond cond = 0);   // set named window collapsed state
     IMGUI_API void          SetWindowFocus(const char* name);                                           // set named window to be focused / top-most. use NULL to remove focus.
+    IMGUI_API void          InvalidateWindow();                                                         // prevent current window from being frozen on the next frame (ImGuiWindowFlags_FreezeWhenIdle), e.g. while animating.
+    IMGUI_API void          InvalidateWindow(const char* name);                                         // force named window to be fully submitted and redrawn on its next Begin() (ImGuiWindowFlags_FreezeWhenIdle).
 
     // Content region
     // - Those functions are bound to be redesigned soon (they are confusing, incomplete and return values in local window coordinates which increases confusion)
@@ -713,6 +719,8 @@ namespace ImGui
     IMGUI_API bool          IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max);      // test if rectangle (in screen space) is visible / not clipped. to perform coarse clipping on user's side.
     IMGUI_API double        GetTime();                                                          // get global imgui time. incremented by io.DeltaTime every frame.
     IMGUI_API int           GetFrameCount();                                                    // get global imgui frame count. incremented by 1 every frame.
+    IMGUI_API void          SetMaxWaitBeforeNextFrame(float seconds);                           // request the next frame to start within 'seconds' (0.0f: right away) when your application waits for inputs using io.MaxWaitBeforeNextFrame. call every frame while your own contents are animating.
+    IMGUI_API void          MarkDirtyRect(const ImVec2& rect_min, const ImVec2& rect_max);      // report an area (in screen space) as changed in the next ImDrawData::DirtyRects with io.ConfigTrackDirtyRects, e.g. where an Image() whose texture contents changed is displayed.
     IMGUI_API ImDrawList*   GetBackgroundDrawList();                                            // this draw list will be the first rendering one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList();                                            // this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances.
@@ -815,6 +823,7 @@ enum ImGuiWindowFlags_
     ImGuiWindowFlags_NoNavInputs            = 1 << 18,  // No gamepad/keyboard navigation within the window
     ImGuiWindowFlags_NoNavFocus             = 1 << 19,  // No focusing toward this window with gamepad/keyboard navigation (e.g. skipped by CTRL+TAB)
     ImGuiWindowFlags_UnsavedDocument        = 1 << 20,  // Append '*' to title without affecting the ID, as a convenience to avoid using the ### operator. When used in a tab/docking context, tab is selected on closure and closure is deferred by one frame to allow code to cancel the closure (with a confirmation popup, etc.) without flicker.
+    ImGuiWindowFlags_FreezeWhenIdle         = 1 << 21,  // [BETA] While the window is not hovered, focused, moved or interacted with, Begin() returns false and the draw list of the previous frame is rendered again. Call InvalidateWindow() when the contents change. Ignored on child windows, popups and tooltips.
     ImGuiWindowFlags_NoNav                  = ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
     ImGuiWindowFlags_NoDecoration           = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoCollapse,
     ImGuiWindowFlags_NoInputs               = ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
@@ -1129,11 +1138,13 @@ enum ImGuiConfigFlags_
 // Backend capabilities flags stored in io.BackendFlags. Set by imgui_impl_xxx or custom backend.
 enum ImGuiBackendFlags_
 {
-    ImGuiBackendFlags_None                  = 0,
-    ImGuiBackendFlags_HasGamepad            = 1 << 0,   // Backend Platform supports gamepad and currently has one connected.
-    ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
-    ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
-    ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3    // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_None                   = 0,
+    ImGuiBackendFlags_HasGamepad             = 1 << 0,   // Backend Platform supports gamepad and currently has one connected.
+    ImGuiBackendFlags_HasMouseCursors        = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
+    ImGuiBackendFlags_HasSetMousePos         = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
+    ImGuiBackendFlags_RendererHasVtxOffset   = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererMergeDrawLists = 1 << 4,   // Backend Renderer prefers a single vertex/index buffer: Render() copies all draw lists into one ImDrawList (ImDrawData::CmdListsCount == 1) when vertices can be addressed. User callbacks receive that merged list as parent list.
+    ImGuiBackendFlags_RendererHasTexUpdates  = 1 << 5    // Backend Renderer uploads ImFontAtlas::TexDirtyRects to the font texture before rendering. Required by ImFontConfig::DynamicGlyphs.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -1475,9 +1486,9 @@ struct ImGuiStyle
     ImVec2      DisplaySafeAreaPadding;     // If you cannot see the edges of your screen (e.g. on a TV) increase the safe area padding. Apply to popups/tooltips as well regular windows. NB: Prefer configuring your TV sets correctly!
     float       MouseCursorScale;           // Scale software rendered mouse cursor (when io.MouseDrawCursor is enabled). May be removed later.
     bool        AntiAliasedLines;           // Enable anti-aliased lines/borders. Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame (copied to ImDrawList).
-    bool        AntiAliasedLinesUseTex;     // Enable anti-aliased lines/borders using textures where possible. Require backend to render with bilinear filtering. Latched at the beginning of the frame (copied to ImDrawList).
+    bool        AntiAliasedLinesUseTex;     // Enable anti-aliased lines/borders and rounded rectangles corners using textures where possible. Require backend to render with bilinear filtering. Latched at the beginning of the frame (copied to ImDrawList).
     bool        AntiAliasedFill;            // Enable anti-aliased edges around filled shapes (rounded rectangles, circles, etc.). Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame (copied to ImDrawList).
-    float       CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
+    float       CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo()/PathBezierQuadraticCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     float       CircleSegmentMaxError;      // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
     ImVec4      Colors[ImGuiCol_COUNT];
 
@@ -1525,6 +1536,10 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // [BETA] Set to true to only allow moving windows when clicked+dragged from the title bar. Windows without a title bar are not affected.
     float       ConfigWindowsMemoryCompactTimer;// = 60.0f          // [BETA] Compact window memory usage when unused. Set to -1.0f to disable.
+    bool        ConfigDeferredTessellation;     // = false          // [BETA] Record lines, borders and filled shapes (AddPolyline/AddConvexPolyFilled) and tessellate them all in Render(), across windows using RenderJobsFn if set.
+    bool        ConfigOcclusionCulling;         // = false          // [BETA] In Render(), remove or trim draw commands hidden behind windows with an opaque background (alpha == 1.0f). Requires a renderer backend using ImDrawCmd::IdxOffset, which is assumed from ImGuiBackendFlags_RendererHasVtxOffset.
+    bool        ConfigReorderDrawCmds;          // = false          // [BETA] In Render(), move draw commands before non-overlapping ones to merge them with earlier commands using the same texture (e.g. text interleaved with images). Applies across windows when draw lists are merged (ImGuiBackendFlags_RendererMergeDrawLists).
+    bool        ConfigTrackDirtyRects;          // = false          // [BETA] In Render(), hash the contents of each draw list to output the areas of the display which changed since the previous frame in ImDrawData::DirtyRects, so renderer backends may redraw only those areas or skip presenting when nothing changed. Only geometry is compared: call MarkDirtyRect() over images whose texture contents changed.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -1549,6 +1564,11 @@ struct ImGuiIO
     void        (*ImeSetInputScreenPosFn)(int x, int y);
     void*       ImeWindowHandle;                // = NULL           // (Windows) Set this to your HWND to get automatic IME cursor positioning.
 
+    // Optional: Run the tessellation of draw lists (when io.ConfigDeferredTessellation is set) on your own job system
+    // Must call job_fn(job_data, n) for each n in [0, job_count), from any thread, and only return once all of them have completed.
+    void        (*RenderJobsFn)(void* user_data, int job_count, void (*job_fn)(void* job_data, int job_index), void* job_data);
+    void*       RenderJobsUserData;
+
     //------------------------------------------------------------------
     // Input - Fill before calling NewFrame()
     //------------------------------------------------------------------
@@ -1586,10 +1606,12 @@ struct ImGuiIO
     float       Framerate;                      // Application framerate estimate, in frame per second. Solely for convenience. Rolling average estimation based on io.DeltaTime over 120 frames.
     int         MetricsRenderVertices;          // Vertices output during last call to Render()
     int         MetricsRenderIndices;           // Indices output during last call to Render() = number of triangles * 3
+    int         MetricsRenderDrawCalls;         // Draw commands output during last call to Render(), excluding user callbacks and empty commands (ElemCount == 0)
     int         MetricsRenderWindows;           // Number of visible windows
     int         MetricsActiveWindows;           // Number of active windows
     int         MetricsActiveAllocations;       // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
     ImVec2      MouseDelta;                     // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
+    float       MaxWaitBeforeNextFrame;         // Set by EndFrame(): time (in seconds) your application may wait for inputs before starting a new frame. 0.0f while animating or settling after inputs, FLT_MAX when idle. e.g. call ImGui_ImplGlfw_WaitForEvents() instead of glfwPollEvents() to block until then. See SetMaxWaitBeforeNextFrame().
 
     //------------------------------------------------------------------
     // [Internal] Dear ImGui will maintain those fields. Forward compatibility not guaranteed!
@@ -1948,6 +1970,11 @@ struct ImColor
 #define IM_DRAWLIST_TEX_LINES_WIDTH_MAX     (63)
 #endif
 
+// The maximum rounding radius to bake anti-aliased rounded corners textures for. Build atlas with ImFontAtlasFlags_NoBakedRoundCorners to disable baking.
+#ifndef IM_DRAWLIST_TEX_ROUND_CORNERS_MAX
+#define IM_DRAWLIST_TEX_ROUND_CORNERS_MAX   (16)
+#endif
+
 // ImDrawCallback: Draw callbacks for advanced uses [configurable type: override in imconfig.h]
 // NB: You most likely do NOT need to use draw callbacks just to create your own widget or customized UI rendering,
 // you can poke into the draw list for that! Draw callback may be useful for example to:
@@ -1990,6 +2017,45 @@ struct ImDrawCmd
 typedef unsigned short ImDrawIdx;
 #endif
 
+// Compact vertex layout: 12 bytes instead of 20. Enable with '#define IMGUI_USE_COMPACT_DRAWVERT' in imconfig.h.
+// - Positions are stored as 16-bit signed fixed point with IM_DRAWVERT_POS16_FRAC_BITS fractional bits (default: 1/4 pixel precision, -8191.75..+8191.75 range).
+// - UV are stored as 16-bit unsigned normalized values (0.0f..1.0f range, other values are clamped).
+// Values are clamped before the conversion to integer, so any float (including infinities) is stored as the nearest value in range, NaN as the minimum.
+// Those types convert from/to ImVec2 and float, so code writing vertices (e.g. 'vtx->pos = p' or 'vtx->pos.x = x') is unchanged.
+// Renderer backends need to fetch positions as 16-bit signed integers scaled by 1.0f/IM_DRAWVERT_POS16_ONE (or by 32767.0f/IM_DRAWVERT_POS16_ONE
+// when fetched as normalized SNORM16), and UV as normalized UNORM16. See imgui_impl_opengl3.cpp, imgui_impl_dx11.cpp etc.
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#ifdef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#error "IMGUI_USE_COMPACT_DRAWVERT and IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT cannot be both defined!"
+#endif
+#ifndef IM_DRAWVERT_POS16_FRAC_BITS
+#define IM_DRAWVERT_POS16_FRAC_BITS 2
+#endif
+#define IM_DRAWVERT_POS16_ONE       ((float)(1 << IM_DRAWVERT_POS16_FRAC_BITS))     // Stored value for 1 pixel
+struct ImDrawVertPosComponent16
+{
+    signed short    v;
+    ImDrawVertPosComponent16& operator=(float f)    { f = f * IM_DRAWVERT_POS16_ONE + 32768.5f; f = (f > 1.0f) ? f : 1.0f; f = (f < 65535.0f) ? f : 65535.0f; v = (signed short)((int)f - 32768); return *this; }
+    operator float() const                          { return v * (1.0f / IM_DRAWVERT_POS16_ONE); }
+};
+struct ImDrawVertUVComponent16
+{
+    unsigned short  v;
+    ImDrawVertUVComponent16& operator=(float f)     { f = f * 65535.0f + 0.5f; f = (f > 0.0f) ? f : 0.0f; f = (f < 65535.0f) ? f : 65535.0f; v = (unsigned short)(int)f; return *this; }
+    operator float() const                          { return v * (1.0f / 65535.0f); }
+};
+template<typename T>
+struct ImDrawVertVec2Compact
+{
+    T               x, y;
+    ImDrawVertVec2Compact& operator=(const ImVec2& rhs) { x = rhs.x; y = rhs.y; return *this; }
+    operator ImVec2() const                         { return ImVec2(x, y); }
+};
+typedef ImDrawVertVec2Compact<ImDrawVertPosComponent16> ImDrawVertPos16;
+typedef ImDrawVertVec2Compact<ImDrawVertUVComponent16>  ImDrawVertUV16;
+#define IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT struct ImDrawVert { ImDrawVertPos16 pos; ImDrawVertUV16 uv; ImU32 col; }
+#endif
+
 // Vertex layout
 #ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
 struct ImDrawVert
@@ -2006,11 +2072,41 @@ struct ImDrawVert
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
 #endif
 
+// [Internal] Result of testing whether the vertices of a draw command are inside its ClipRect, kept so that only indices added to
+// the command since are tested next time. See ImDrawList::_TryMergeDrawCmds() and ImDrawListSplitter::Merge().
+struct ImDrawCmdClipTest
+{
+    int                         CmdIdx;         // Index of the command in its command buffer, -1 if none
+    unsigned int                ElemCount;      // Number of leading indices of that command already tested
+    bool                        Clipped;        // Some of them are outside of the command ClipRect
+    ImDrawCmdClipTest()         { CmdIdx = -1; ElemCount = 0; Clipped = false; }
+};
+
 // For use by ImDrawListSplitter.
 struct ImDrawChannel
 {
     ImVector<ImDrawCmd>         _CmdBuffer;
-    ImVector<ImDrawIdx>         _IdxBuffer;
+    ImVector<ImDrawIdx>         _IdxBuffer;     // May be a range of ImDrawListSplitter::_IdxStorage (see _IdxBorrowed)
+    int                         _IdxGrowth;     // Number of indices added to this channel between the last Split() and Merge(), reserved in place by the next Split()
+    bool                        _IdxBorrowed;   // _IdxBuffer is a range of ImDrawListSplitter::_IdxStorage, not an allocation of its own
+    ImDrawCmdClipTest           _CmdClipTest;       // Backup of ImDrawList::_CmdClipTest while the channel is not current
+    ImDrawCmdClipTest           _CmdFirstClipTest;  // Same for the first command of the channel, tested when leaving the channel
+};
+
+// [Internal] Primitive recorded by an ImDrawList using ImDrawListFlags_DeferredTessellation.
+// Its vertices and indices are already reserved (so draw commands are final), they get written by ImDrawList::_FlushDeferredPrims().
+struct ImDrawDeferredPrim
+{
+    unsigned int    VtxOffset;          // Offset of reserved vertices in VtxBuffer
+    unsigned int    IdxOffset;          // Offset of reserved indices in IdxBuffer
+    unsigned int    VtxCurrentIdx;      // Value of _VtxCurrentIdx when reserving
+    int             PointsOffset;       // Offset of points in _DeferredPoints
+    int             PointsCount;
+    ImU32           Col;
+    float           Thickness;
+    ImDrawListFlags Flags;              // Anti-aliasing flags latched when recording
+    bool            Filled;             // AddConvexPolyFilled() or AddPolyline()
+    bool            Closed;
 };
 
 // Split/Merge functions are used to split the draw list into different layers which can be drawn into out of order.
@@ -2020,6 +2116,9 @@ struct ImDrawListSplitter
     int                         _Current;    // Current channel number (0)
     int                         _Count;      // Number of active channels (1+)
     ImVector<ImDrawChannel>     _Channels;   // Draw channels (not resized down so _Count might be < Channels.Size)
+    ImVector<ImDrawIdx>         _IdxStorage; // Channels 1+ write in place into consecutive ranges of it, after a range reserved for channel 0
+    int                         _IdxSplitSize; // Size of the draw list index buffer when Split() was called, -1 when channels use allocations of their own
+    ImTextureID                 _SplitTextureId; // Texture of the draw list when Split() was called
 
     inline ImDrawListSplitter()  { Clear(); }
     inline ~ImDrawListSplitter() { ClearFreeMemory(); }
@@ -2052,7 +2151,10 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLines        = 1 << 0,  // Enable anti-aliased lines/borders (*2 the number of triangles for 1.0f wide line or lines thin enough to be drawn using textures, otherwise *3 the number of triangles)
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering.
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
-    ImDrawListFlags_AllowVtxOffset          = 1 << 3   // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_RoundCornersUseTex      = 1 << 4,  // Enable anti-aliased rounded rectangles using textured corners when possible (fixed-size mesh instead of tessellated arcs). Require backend to render with bilinear filtering.
+    ImDrawListFlags_DeferredTessellation    = 1 << 5,  // Reserve geometry for AddPolyline()/AddConvexPolyFilled() immediately but write it later in _FlushDeferredPrims(). Set when 'io.ConfigDeferredTessellation' is enabled. Draw lists not owned by Dear ImGui need to call _FlushDeferredPrims() before rendering.
+    ImDrawListFlags_RetainContents          = 1 << 6   // Contents may be rendered again on the next frame without being rebuilt. Set by Dear ImGui on draw lists of windows which may be frozen (ImGuiWindowFlags_FreezeWhenIdle). ImDrawDataSnapshotRing copies those draw lists instead of taking their buffers. Their glyphs rasterized on demand (ImFontConfig::DynamicGlyphs) are kept in the atlas.
 };
 
 // Draw command list
@@ -2081,10 +2183,18 @@ struct ImDrawList
     ImVector<ImTextureID>   _TextureIdStack;    // [Internal]
     ImVector<ImVec2>        _Path;              // [Internal] current path building
     ImDrawCmd               _CmdHeader;         // [Internal] Template of active commands. Fields should match those of CmdBuffer.back().
+    ImDrawCmdClipTest       _CmdClipTest;       // [Internal] Whether the last command tested has all its geometry inside its ClipRect. See _TryMergeDrawCmds().
+    int                     _CmdMergedCount;    // [Internal] Number of commands merged across different clip rectangles since last reset (reported in Metrics)
+    ImVector<ImDrawDeferredPrim> _DeferredPrims; // [Internal] Primitives reserved but not tessellated yet (ImDrawListFlags_DeferredTessellation)
+    ImVector<ImVec2>        _DeferredPoints;    // [Internal] Points of _DeferredPrims
+    bool                    _DeferredFlushing;  // [Internal] Set while _FlushDeferredPrims() writes into already reserved space
+    ImVector<ImU32>         _DynamicGlyphs;     // [Internal] Glyphs rasterized on demand drawn into this list (ImFontConfig::DynamicGlyphs), never evicted while the list has ImDrawListFlags_RetainContents
+    ImVec4                  _OcclusionRect;     // [Internal] Area (x1, y1, x2, y2) fully covered by opaque contents of this list, which hides lists rendered before it (io.ConfigOcclusionCulling)
+    bool                    _IdxBorrowed;       // [Internal] IdxBuffer is a range reserved by an ImDrawListSplitter (in a channel other than 0): it is moved to its own allocation by _SpillIdxBuffer() before growing past its capacity
     ImDrawListSplitter      _Splitter;          // [Internal] for channels api (note: prefer using your own persistent instance of ImDrawListSplitter!)
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
-    ImDrawList(const ImDrawListSharedData* shared_data) { _Data = shared_data; Flags = ImDrawListFlags_None; _VtxCurrentIdx = 0; _VtxWritePtr = NULL; _IdxWritePtr = NULL; _OwnerName = NULL; }
+    ImDrawList(const ImDrawListSharedData* shared_data) { _Data = shared_data; Flags = ImDrawListFlags_None; _VtxCurrentIdx = 0; _VtxWritePtr = NULL; _IdxWritePtr = NULL; _OwnerName = NULL; _CmdMergedCount = 0; _DeferredFlushing = false; _OcclusionRect = ImVec4(0.0f, 0.0f, 0.0f, 0.0f); _IdxBorrowed = false; }
 
     ~ImDrawList() { _ClearFreeMemory(); }
     IMGUI_API void  PushClipRect(ImVec2 clip_rect_min, ImVec2 clip_rect_max, bool intersect_with_current_clip_rect = false);  // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
@@ -2117,7 +2227,17 @@ struct ImDrawList
     IMGUI_API void  AddText(const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end = NULL, float wrap_width = 0.0f, const ImVec4* cpu_fine_clip_rect = NULL);
     IMGUI_API void  AddPolyline(const ImVec2* points, int num_points, ImU32 col, bool closed, float thickness);
     IMGUI_API void  AddConvexPolyFilled(const ImVec2* points, int num_points, ImU32 col); // Note: Anti-aliased filling requires points to be in clockwise order.
-    IMGUI_API void  AddBezierCurve(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments = 0);
+    IMGUI_API void  AddBezierCurve(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments = 0); // Cubic Bezier (4 control points)
+    IMGUI_API void  AddBezierQuadratic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, ImU32 col, float thickness, int num_segments = 0);               // Quadratic Bezier (3 control points)
+
+    // Batched primitives
+    // - Draw many primitives of the same kind in one call, e.g. heatmaps or scatter plots: space is reserved once and vertices are written in bulk.
+    // - The output is the same as calling AddRectFilled(), AddCircleFilled() or AddLine() for each element in order (fully transparent elements are skipped).
+    // - 'cols' holds one color per element.
+    IMGUI_API void  AddRectsFilled(const ImVec2* p_mins, const ImVec2* p_maxs, const ImU32* cols, int count);
+    IMGUI_API void  AddRectFilledGrid(const ImVec2& p_min, const ImVec2& p_max, int cells_x, int cells_y, const ImU32* cols);    // cells_x * cells_y cells of equal size, colors stored row by row. Adjacent cells share their edges.
+    IMGUI_API void  AddCirclesFilled(const ImVec2* centers, const ImU32* cols, int count, float radius, int num_segments = 0);
+    IMGUI_API void  AddLines(const ImVec2* points, const ImU32* cols, int count, float thickness = 1.0f);                         // Line segments from points[n * 2] to points[n * 2 + 1]
 
     // Image primitives
     // - Read FAQ to understand what ImTextureID is.
@@ -2135,7 +2255,8 @@ struct ImDrawList
     inline    void  PathStroke(ImU32 col, bool closed, float thickness = 1.0f)  { AddPolyline(_Path.Data, _Path.Size, col, closed, thickness); _Path.Size = 0; }
     IMGUI_API void  PathArcTo(const ImVec2& center, float radius, float a_min, float a_max, int num_segments = 10);
     IMGUI_API void  PathArcToFast(const ImVec2& center, float radius, int a_min_of_12, int a_max_of_12);                                            // Use precomputed angles for a 12 steps circle
-    IMGUI_API void  PathBezierCurveTo(const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, int num_segments = 0);
+    IMGUI_API void  PathBezierCurveTo(const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, int num_segments = 0);                                 // Cubic Bezier (4 control points)
+    IMGUI_API void  PathBezierQuadraticCurveTo(const ImVec2& p2, const ImVec2& p3, int num_segments = 0);                                          // Quadratic Bezier (3 control points)
     IMGUI_API void  PathRect(const ImVec2& rect_min, const ImVec2& rect_max, float rounding = 0.0f, ImDrawCornerFlags rounding_corners = ImDrawCornerFlags_All);
 
     // Advanced
@@ -2169,6 +2290,9 @@ struct ImDrawList
     IMGUI_API void  _ResetForNewFrame();
     IMGUI_API void  _ClearFreeMemory();
     IMGUI_API void  _PopUnusedDrawCmd();
+    IMGUI_API void  _TryMergeDrawCmds();
+    IMGUI_API void  _FlushDeferredPrims();
+    IMGUI_API void  _SpillIdxBuffer(int new_size);
     IMGUI_API void  _OnChangedClipRect();
     IMGUI_API void  _OnChangedTextureID();
     IMGUI_API void  _OnChangedVtxOffset();
@@ -2187,15 +2311,39 @@ struct ImDrawData
     ImVec2          DisplayPos;             // Upper-left position of the viewport to render (== upper-left of the orthogonal projection matrix to use)
     ImVec2          DisplaySize;            // Size of the viewport to render (== io.DisplaySize for the main viewport) (DisplayPos + DisplaySize == lower-right of the orthogonal projection matrix to use)
     ImVec2          FramebufferScale;       // Amount of pixels for each unit of DisplaySize. Based on io.DisplayFramebufferScale. Generally (1,1) on normal display, (2,2) on OSX with Retina display.
+    ImVec4*         DirtyRects;             // Areas (x1, y1, x2, y2) which may differ from the previous frame, in the same coordinates as ImDrawCmd::ClipRect, rounded to whole units. With io.ConfigTrackDirtyRects: none when nothing changed. Otherwise: a single rectangle covering the display.
+    int             DirtyRectsCount;        // Number of rectangles in DirtyRects[]
 
     // Functions
     ImDrawData()    { Valid = false; Clear(); }
     ~ImDrawData()   { Clear(); }
-    void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = 0; DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.f, 0.f); } // The ImDrawList are owned by ImGuiContext!
+    void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = 0; DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.f, 0.f); DirtyRects = NULL; DirtyRectsCount = 0; } // The ImDrawList are owned by ImGuiContext!
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
 };
 
+// Ring of ImDrawData snapshots, to render on a separate thread while the next frame is being built.
+// - Snap() moves the command/index/vertex buffers of every draw list of an ImDrawData into the next snapshot of the ring, by swapping
+//   them with the buffers of the snapshot taken 'Snapshots.Size' calls earlier. Nothing is copied, and nothing is allocated once buffers have grown.
+// - Call Snap(ImGui::GetDrawData()) after ImGui::Render() and pass the returned ImDrawData to your render thread. It stays valid until Snap()
+//   has been called Snapshots.Size more times: with 2 snapshots, frame N can be rendered while frame N+1 is built and snapped; with 3, another
+//   frame can be queued. You need to synchronize with your render thread so a snapshot isn't reused while being rendered.
+// - The source ImDrawData is invalidated and its draw lists are emptied (Dear ImGui resets them in the next NewFrame() anyway).
+//   Draw lists with ImDrawListFlags_RetainContents are copied instead. ImDrawCmd::UserCallback receive the snapshot's copy of the draw list.
+// - Not compatible with ImFontConfig::DynamicGlyphs: building the next frame may evict and replace glyphs in the atlas texture while a
+//   snapshot still refers to them, so text of a snapshot rendered late may show the wrong glyphs.
+struct ImDrawDataSnapshotRing
+{
+    ImVector<ImDrawDataSnapshot*> Snapshots;    // Ring storage
+    int                         NextIndex;      // Index of the snapshot written by the next call to Snap()
+    int                         SnapCount;      // Number of calls to Snap(), used to release draw lists which haven't been snapped for a while
+
+    IMGUI_API ImDrawDataSnapshotRing(int snapshot_count = 2);
+    IMGUI_API ~ImDrawDataSnapshotRing();
+    IMGUI_API ImDrawData*       Snap(ImDrawData* src);
+    IMGUI_API void              ClearFreeMemory();
+};
+
 //-----------------------------------------------------------------------------
 // Font API (ImFontConfig, ImFontGlyph, ImFontAtlasFlags, ImFontAtlas, ImFontGlyphRangesBuilder, ImFont)
 //-----------------------------------------------------------------------------
@@ -2219,6 +2367,10 @@ struct ImFontConfig
     unsigned int    RasterizerFlags;        // 0x00     // Settings for custom font rasterizer (e.g. ImGuiFreeType). Leave as zero if you aren't using one.
     float           RasterizerMultiply;     // 1.0f     // Brighten (>1.0f) or darken (<1.0f) font output. Brightening small fonts may be a good workaround to make them more readable.
     ImWchar         EllipsisChar;           // -1       // Explicitly specify unicode codepoint of ellipsis character. When fonts are being merged first specified ellipsis will be used.
+    bool            DynamicGlyphs;          // false    // [BETA] Don't rasterize GlyphRanges into the atlas at Build() time but the first time each glyph is drawn, into a cache of DynamicGlyphsCacheSize slots reusing the least recently used ones (the largest glyphs are still baked). Useful for large ranges such as GetGlyphRangesChineseFull(). Requires the default stb_truetype builder, a renderer backend uploading ImFontAtlas::TexDirtyRects (ImGuiBackendFlags_RendererHasTexUpdates), and the input and texture data to stay available (don't call ClearInputData() or ClearTexData()). Not compatible with rendering ImDrawDataSnapshotRing snapshots after the next NewFrame().
+    int             DynamicGlyphsCacheSize; // 1024     // Number of glyphs of this font input which can be in the atlas at the same time, needs to be larger than the number of different glyphs drawn in a frame.
+    bool            SDF;                    // false    // [BETA] Store signed distance fields instead of coverage, so a single bake can be drawn sharply at any size (SetWindowFontScale(), zoomed canvases). Requires the default stb_truetype builder and a renderer backend setting ImFontAtlas::TexIDSDF to select a distance field shader, otherwise the glyphs are drawn blurry. Disables OversampleH/V and DynamicGlyphs. Read docs/FONTS.md for details.
+    int             SDFSpread;              // 4        // Distance in pixels (at SizePixels) covered by the field outside of the glyphs outline. Larger values allow larger effects but use more texture space. Must be >= 1.
 
     // [Internal]
     char            Name[40];               // Name (strictly to ease debugging)
@@ -2228,11 +2380,12 @@ struct ImFontConfig
 };
 
 // Hold rendering data for one glyph.
-// (Note: some language parsers may fail to convert the 31+1 bitfield members, in this case maybe drop store a single u32 or we can rework this)
+// (Note: some language parsers may fail to convert the 30+1+1 bitfield members, in this case maybe drop store a single u32 or we can rework this)
 struct ImFontGlyph
 {
-    unsigned int    Codepoint : 31;     // 0x0000..0xFFFF
+    unsigned int    Codepoint : 30;     // 0x0000..0xFFFF
     unsigned int    Visible : 1;        // Flag to allow early out when rendering
+    unsigned int    Dynamic : 1;        // Rasterized on demand (ImFontConfig::DynamicGlyphs): U0/V0/U1/V1 are only valid after ImFontAtlasUseDynamicGlyph() returned true
     float           AdvanceX;           // Distance to next character (= data from font + ImFontConfig::GlyphExtraSpacing.x baked in)
     float           X0, Y0, X1, Y1;     // Glyph corners
     float           U0, V0, U1, V1;     // Texture coordinates
@@ -2273,7 +2426,8 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_None               = 0,
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
-    ImFontAtlasFlags_NoBakedLines       = 1 << 2    // Don't build thick line textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_NoBakedRoundCorners = 1 << 3   // Don't build rounded corners textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them for rounded rectangles, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -2304,7 +2458,7 @@ struct ImFontAtlas
     IMGUI_API ImFont*           AddFontFromMemoryCompressedTTF(const void* compressed_font_data, int compressed_font_size, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // 'compressed_font_data' still owned by caller. Compress with binary_to_compressed_c.cpp.
     IMGUI_API ImFont*           AddFontFromMemoryCompressedBase85TTF(const char* compressed_font_data_base85, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL);              // 'compressed_font_data_base85' still owned by caller. Compress with binary_to_compressed_c.cpp with -base85 parameter.
     IMGUI_API void              ClearInputData();           // Clear input data (all ImFontConfig structures including sizes, TTF data, glyph ranges, etc.) = all the data used to build the texture and fonts.
-    IMGUI_API void              ClearTexData();             // Clear output texture data (CPU side). Saves RAM once the texture has been copied to graphics memory.
+    IMGUI_API void              ClearTexData();             // Clear output texture data (CPU side). Saves RAM once the texture has been copied to graphics memory. Not allowed with ImFontConfig::DynamicGlyphs, which rasterize into it.
     IMGUI_API void              ClearFonts();               // Clear output font data (glyphs storage, UV coordinates).
     IMGUI_API void              Clear();                    // Clear all input and output.
 
@@ -2319,6 +2473,16 @@ struct ImFontAtlas
     bool                        IsBuilt() const             { return Fonts.Size > 0 && (TexPixelsAlpha8 != NULL || TexPixelsRGBA32 != NULL); }
     void                        SetTexID(ImTextureID id)    { TexID = id; }
 
+    // [BETA] Save a built atlas (texture, glyphs, metrics, custom rectangles positions) and restore it on the next run without calling Build().
+    // The cache is keyed by a hash of the fonts data, ImFontConfig settings, glyph ranges, atlas settings and custom rectangles: add your fonts and
+    // custom rectangles as usual, then LoadCache***() returns false without touching the fonts if the cache is missing or doesn't match, in which
+    // case call Build() then SaveCache***(). Saving needs the input data and the Alpha8 texture (don't call ClearInputData()/ClearTexData() before).
+    // The builder isn't part of the key: use a different file for atlases built with imgui_freetype. Read docs/FONTS.md for details.
+    IMGUI_API bool              LoadCacheFromDisk(const char* filename);
+    IMGUI_API bool              LoadCacheFromMemory(const void* data, size_t data_size);
+    IMGUI_API bool              SaveCacheToDisk(const char* filename);
+    IMGUI_API bool              SaveCacheToMemory(ImVector<unsigned char>* out_data);
+
     //-------------------------------------------
     // Glyph Ranges
     //-------------------------------------------
@@ -2360,8 +2524,16 @@ struct ImFontAtlas
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
     ImFontAtlasFlags            Flags;              // Build flags (see ImFontAtlasFlags_)
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
+    ImTextureID                 TexIDSDF;           // Optional: Set by renderer backends supporting ImFontConfig::SDF to a value different from TexID, which they map to the same texture drawn with a distance field shader. Text of SDF fonts uses it instead of TexID. Leave to NULL otherwise.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0.
+    ImVector<ImVec4>            TexDirtyRects;      // Areas (x1, y1, x2, y2) of the texture pixels modified by glyphs rasterized on demand (ImFontConfig::DynamicGlyphs). Renderer backends need to upload them before rendering. Cleared by ImGui::NewFrame().
+
+    // Optional: Run the glyph lookups and rasterization of Build() on your own job system (same contract as io.RenderJobsFn). The texture is identical with or without it.
+    // Must call job_fn(job_data, n) for each n in [0, job_count), from any thread, and only return once all of them have completed. Jobs allocate memory with the functions
+    // set by SetAllocatorFunctions(), which must be thread-safe (the default ones are), but never access the ImGui context.
+    void                        (*BuildJobsFn)(void* user_data, int job_count, void (*job_fn)(void* job_data, int job_index), void* job_data);
+    void*                       BuildJobsUserData;
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
@@ -2375,10 +2547,17 @@ struct ImFontAtlas
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    ImVec4                      TexUvRoundCornerFilled[IM_DRAWLIST_TEX_ROUND_CORNERS_MAX + 1];  // UVs for baked anti-aliased filled rounded corners, indexed by radius. (x,y) is the outer corner, (z,w) the inner corner.
+    ImVec4                      TexUvRoundCornerStroked[IM_DRAWLIST_TEX_ROUND_CORNERS_MAX + 1]; // UVs for baked anti-aliased 1 pixel thick rounded corners, indexed by radius. Same layout.
 
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
+    int                         PackIdRoundCorners; // Custom texture rectangle ID for baked anti-aliased rounded corners of radius 1 (radius N is at PackIdRoundCorners + N - 1)
+
+    // [Internal] Glyphs rasterized on demand
+    ImVector<ImFontDynamicGlyphs*> DynamicGlyphs;  // One per font input using ImFontConfig::DynamicGlyphs, created by Build()
+    int                         DynamicGlyphsFrameCount; // Incremented by ImGui::NewFrame(). Glyphs used since then are never evicted.
 
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
@@ -2391,15 +2570,20 @@ struct ImFontAtlas
 struct ImFont
 {
     // Members: Hot ~20/24 bytes (for CalcTextSize)
-    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI).
+    ImVector<float>             IndexAdvanceX;      // 12-16 // out //            // Sparse. Glyphs->AdvanceX in a directly indexable way (cache-friendly for CalcTextSize functions which only this this info, and are often bottleneck in large UI). Only covers the first 4K page (U+0000..U+0FFF), see IndexPages.
     float                       FallbackAdvanceX;   // 4     // out // = FallbackGlyph->AdvanceX
     float                       FontSize;           // 4     // in  //            // Height of characters/line, set during loading (don't change after loading)
 
     // Members: Hot ~28/40 bytes (for CalcTextSize + render loop)
-    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Sparse. Index glyphs by Unicode code-point.
+    ImVector<ImWchar>           IndexLookup;        // 12-16 // out //            // Sparse. Index glyphs by Unicode code-point. Only covers the first 4K page (U+0000..U+0FFF), see IndexPages.
     ImVector<ImFontGlyph>       Glyphs;             // 12-16 // out //            // All glyphs.
     const ImFontGlyph*          FallbackGlyph;      // 4-8   // out // = FindGlyph(FontFallbackChar)
 
+    // Members: Warm ~36/48 bytes (for codepoints above U+0FFF)
+    ImVector<int>               IndexPages;         // 12-16 // out //            // Index of 4K pages above the first one, by page number (codepoint / 4096): offset of the page in IndexPagesLookup/IndexPagesAdvanceX, -1 if the page has no glyph.
+    ImVector<ImWchar>           IndexPagesLookup;   // 12-16 // out //            // 4096 entries per indexed page, same as IndexLookup.
+    ImVector<float>             IndexPagesAdvanceX; // 12-16 // out //            // 4096 entries per indexed page, same as IndexAdvanceX.
+
     // Members: Cold ~32/40 bytes
     ImFontAtlas*                ContainerAtlas;     // 4-8   // out //            // What we has been loaded into
     const ImFontConfig*         ConfigData;         // 4-8   // in  //            // Pointer within ContainerAtlas->ConfigData
@@ -2407,6 +2591,7 @@ struct ImFont
     ImWchar                     FallbackChar;       // 2     // in  // = '?'      // Replacement character if a glyph isn't found. Only set via SetFallbackChar()
     ImWchar                     EllipsisChar;       // 2     // out // = -1       // Character used for ellipsis rendering.
     bool                        DirtyLookupTables;  // 1     // out //
+    bool                        SDF;                // 1     // out // = false    // Glyphs are signed distance fields (ImFontConfig::SDF), drawn with ImFontAtlas::TexIDSDF.
     float                       Scale;              // 4     // in  // = 1.f      // Base font scale, multiplied by the per-window font scale which you can adjust with SetWindowFontScale()
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
@@ -2417,8 +2602,9 @@ struct ImFont
     IMGUI_API ~ImFont();
     IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;
     IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;
-    float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
+    float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : GetCharAdvancePaged(c); }
     bool                        IsLoaded() const                    { return ContainerAtlas != NULL; }
+    ImTextureID                 GetTexID() const                    { return (SDF && ContainerAtlas->TexIDSDF != NULL) ? ContainerAtlas->TexIDSDF : ContainerAtlas->TexID; }
     const char*                 GetDebugName() const                { return ConfigData ? ConfigData->Name : "<unknown>"; }
 
     // 'max_width' stops rendering after a certain width (could be turned into a 2d size). FLT_MAX to disable.
@@ -2431,7 +2617,10 @@ struct ImFont
     // [Internal] Don't use!
     IMGUI_API void              BuildLookupTable();
     IMGUI_API void              ClearOutputData();
-    IMGUI_API void              GrowIndex(int new_size);
+    IMGUI_API void              GrowIndex(int new_size);            // Grow IndexLookup/IndexAdvanceX, up to the first 4K page
+    IMGUI_API int               AddIndexPage(int page_n);           // Add a 4K page above the first one to IndexPages, return its offset in IndexPagesLookup/IndexPagesAdvanceX
+    IMGUI_API float             GetCharAdvancePaged(ImWchar c) const; // GetCharAdvance() for codepoints outside of IndexAdvanceX
+    IMGUI_API int               GetIndexMemoryUsage() const;        // Size in bytes of IndexLookup/IndexAdvanceX and IndexPages*
     IMGUI_API void              AddGlyph(const ImFontConfig* src_cfg, ImWchar c, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x);
     IMGUI_API void              AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst = true); // Makes 'dst' character/glyph points to 'src' character/glyph. Currently needs to be called AFTER fonts have been built.
     IMGUI_API void              SetGlyphVisible(ImWchar c, bool visible);
@@ -130,8 +130,8 @@ namespace IMGUI_STB_NAMESPACE
 
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+#define STBTT_malloc(x,u)   ((void)(u), ImGui::MemAllocNoMetrics(x))    // Called from ImFontAtlas::BuildJobsFn jobs
+#define STBTT_free(x,u)     ((void)(u), ImGui::MemFreeNoMetrics(x))
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -358,7 +358,16 @@ ImDrawListSharedData::ImDrawListSharedData()
         ArcFastVtx[i] = ImVec2(ImCos(a), ImSin(a));
     }
     memset(CircleSegmentCounts, 0, sizeof(CircleSegmentCounts)); // This will be set by SetCircleSegmentMaxError()
+    CircleSegmentSteps[0] = ImVec2(1.0f, 0.0f);
+    for (int i = 1; i < IM_ARRAYSIZE(CircleSegmentSteps); i++)
+    {
+        const float a = (2 * IM_PI) / (float)i;
+        CircleSegmentSteps[i] = ImVec2(ImCos(a), ImSin(a));
+    }
+    CurveFlattenMaxError = 0.0f;
+    memset(CurveSegmentCounts, 0, sizeof(CurveSegmentCounts));    // This will be set by SetCurveTessellationTol() or on first use
     TexUvLines = NULL;
+    TexUvRoundCornerFilled = TexUvRoundCornerStroked = NULL;
 }
 
 void ImDrawListSharedData::SetCircleSegmentMaxError(float max_error)
@@ -370,7 +379,24 @@ void ImDrawListSharedData::SetCircleSegmentMaxError(float max_error)
     {
         const float radius = i + 1.0f;
         const int segment_count = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC(radius, CircleSegmentMaxError);
-        CircleSegmentCounts[i] = (ImU8)ImMin(segment_count, 255);
+        CircleSegmentCounts[i] = (ImU16)segment_count;
+    }
+}
+
+// The maximum distance between an auto-tessellated curve and its polyline is CurveTessellationTol / 3 pixels.
+// (this keeps the quality of the default style.CurveTessellationTol value of 1.25f close to the former recursive subdivision)
+void ImDrawListSharedData::SetCurveTessellationTol(float tol)
+{
+    IM_ASSERT(tol > 0.0f);
+    CurveTessellationTol = tol;
+    if (CurveFlattenMaxError == tol / 3.0f)
+        return;
+    CurveFlattenMaxError = tol / 3.0f;
+    for (int i = 0; i < IM_ARRAYSIZE(CurveSegmentCounts); i++)
+    {
+        const float second_diff_len = (float)i;
+        const int segment_count = IM_DRAWLIST_CURVE_AUTO_SEGMENT_CALC(second_diff_len, CurveFlattenMaxError);
+        CurveSegmentCounts[i] = (ImU16)segment_count;
     }
 }
 
@@ -388,6 +414,12 @@ void ImDrawList::_ResetForNewFrame()
     VtxBuffer.resize(0);
     Flags = _Data->InitialFlags;
     memset(&_CmdHeader, 0, sizeof(_CmdHeader));
+    _CmdClipTest = ImDrawCmdClipTest();
+    _CmdMergedCount = 0;
+    _OcclusionRect = ImVec4(0.0f, 0.0f, 0.0f, 0.0f);
+    _DeferredPrims.resize(0);
+    _DeferredPoints.resize(0);
+    _DynamicGlyphs.resize(0);
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
     _IdxWritePtr = NULL;
@@ -401,9 +433,16 @@ void ImDrawList::_ResetForNewFrame()
 void ImDrawList::_ClearFreeMemory()
 {
     CmdBuffer.clear();
+    if (_IdxBorrowed)
+        memset(&IdxBuffer, 0, sizeof(IdxBuffer)); // Owned by an ImDrawListSplitter
     IdxBuffer.clear();
+    _IdxBorrowed = false;
     VtxBuffer.clear();
     Flags = ImDrawListFlags_None;
+    _CmdClipTest = ImDrawCmdClipTest();
+    _DeferredPrims.clear();
+    _DeferredPoints.clear();
+    _DynamicGlyphs.clear();
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
     _IdxWritePtr = NULL;
@@ -415,6 +454,7 @@ void ImDrawList::_ClearFreeMemory()
 
 ImDrawList* ImDrawList::CloneOutput() const
 {
+    IM_ASSERT(_DeferredPrims.Size == 0 && "Call _FlushDeferredPrims() first!");
     ImDrawList* dst = IM_NEW(ImDrawList(_Data));
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
@@ -466,6 +506,72 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* callback_data)
 #define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)   (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TextureId, VtxOffset
 #define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)      (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TextureId, VtxOffset
 
+// Return true when all vertices referenced by a command are inside its clip rectangle, i.e. the command doesn't rely on clipping.
+// Such commands may be merged with neighbor commands using different clip rectangles, the merged command using the union of them.
+// 'cmd_idx' points to the first index of the command. Only indices from 'elem_start' are tested.
+static bool ImDrawCmd_IsUnclipped(const ImDrawCmd* cmd, const ImDrawIdx* cmd_idx, const ImDrawVert* vtx_buffer, unsigned int elem_start = 0)
+{
+    const ImVec4 clip = cmd->ClipRect;
+    const ImDrawVert* vtx = vtx_buffer + cmd->VtxOffset;
+    for (const ImDrawIdx* idx = cmd_idx + elem_start, *idx_end = cmd_idx + cmd->ElemCount; idx < idx_end; idx++)
+    {
+        const ImVec2 p = vtx[*idx].pos;
+        if (p.x < clip.x || p.y < clip.y || p.x > clip.z || p.y > clip.w)
+            return false;
+    }
+    return true;
+}
+
+// Same as ImDrawCmd_IsUnclipped() for command number 'cmd_n', only testing indices added since the last test recorded in 'test'.
+// Indices are only ever appended to a command and its clip rectangle only grows once it has indices, so a previous result stays valid.
+static bool ImDrawCmd_IsUnclippedCached(ImDrawCmdClipTest* test, int cmd_n, const ImDrawCmd* cmd, const ImDrawIdx* cmd_idx, const ImDrawVert* vtx_buffer)
+{
+    if (test->CmdIdx != cmd_n || test->ElemCount > cmd->ElemCount)
+        *test = ImDrawCmdClipTest();
+    if (!test->Clipped && test->ElemCount < cmd->ElemCount)
+        test->Clipped = !ImDrawCmd_IsUnclipped(cmd, cmd_idx, vtx_buffer, test->ElemCount);
+    test->CmdIdx = cmd_n;
+    test->ElemCount = cmd->ElemCount;
+    return !test->Clipped;
+}
+
+// Return true when two consecutive commands can be merged into one, using the union of their clip rectangles.
+// This is only tried when clip rectangles differ: when they are equal, commands have been split on purpose (e.g. AddDrawCmd()).
+static inline bool ImDrawCmd_CanMergeAcrossClipRects(const ImDrawCmd* prev_cmd, const ImDrawCmd* next_cmd)
+{
+    return prev_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL && prev_cmd->TextureId == next_cmd->TextureId && prev_cmd->VtxOffset == next_cmd->VtxOffset
+        && memcmp(&prev_cmd->ClipRect, &next_cmd->ClipRect, sizeof(ImVec4)) != 0;
+}
+
+static inline ImVec4 ImDrawCmd_ClipRectUnion(const ImVec4& a, const ImVec4& b)
+{
+    return ImVec4(ImMin(a.x, b.x), ImMin(a.y, b.y), ImMax(a.z, b.z), ImMax(a.w, b.w));
+}
+
+// Merge current command into the previous one when neither of them rely on clipping (typical of non-scrolling windows and non-overflowing columns).
+// Called when the current command is done with, before starting a new one for a different clip rectangle.
+// We remember the last command tested (see ImDrawCmdClipTest) so that a chain of merged commands doesn't get tested again.
+void ImDrawList::_TryMergeDrawCmds()
+{
+    const int curr_idx = CmdBuffer.Size - 1;
+    if (curr_idx < 1 || _DeferredPrims.Size > 0) // Vertices of deferred primitives are not written yet
+        return;
+    ImDrawCmd* curr_cmd = &CmdBuffer.Data[curr_idx];
+    ImDrawCmd* prev_cmd = curr_cmd - 1;
+    if (!ImDrawCmd_CanMergeAcrossClipRects(prev_cmd, curr_cmd) || prev_cmd->IdxOffset + prev_cmd->ElemCount != curr_cmd->IdxOffset)
+        return;
+    if (!ImDrawCmd_IsUnclippedCached(&_CmdClipTest, curr_idx - 1, prev_cmd, IdxBuffer.Data + prev_cmd->IdxOffset, VtxBuffer.Data))
+        return;
+    if (!ImDrawCmd_IsUnclipped(curr_cmd, IdxBuffer.Data + curr_cmd->IdxOffset, VtxBuffer.Data))
+        return;
+
+    prev_cmd->ClipRect = ImDrawCmd_ClipRectUnion(prev_cmd->ClipRect, curr_cmd->ClipRect);
+    prev_cmd->ElemCount += curr_cmd->ElemCount;
+    CmdBuffer.pop_back();
+    _CmdClipTest.ElemCount = prev_cmd->ElemCount;
+    _CmdMergedCount++;
+}
+
 // Our scheme may appears a bit unusual, basically we want the most-common calls AddLine AddRect etc. to not have to perform any check so we always have a command ready in the stack.
 // The cost of figuring out if a new command has to be added or if we can merge is paid in those Update** functions only.
 void ImDrawList::_OnChangedClipRect()
@@ -474,6 +580,7 @@ void ImDrawList::_OnChangedClipRect()
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     if (curr_cmd->ElemCount != 0 && memcmp(&curr_cmd->ClipRect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0)
     {
+        _TryMergeDrawCmds();
         AddDrawCmd();
         return;
     }
@@ -496,6 +603,7 @@ void ImDrawList::_OnChangedTextureID()
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     if (curr_cmd->ElemCount != 0 && curr_cmd->TextureId != _CmdHeader.TextureId)
     {
+        _TryMergeDrawCmds();
         AddDrawCmd();
         return;
     }
@@ -597,10 +705,27 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
     _VtxWritePtr = VtxBuffer.Data + vtx_buffer_old_size;
 
     int idx_buffer_old_size = IdxBuffer.Size;
+    if (_IdxBorrowed && idx_buffer_old_size + idx_count > IdxBuffer.Capacity)
+        _SpillIdxBuffer(idx_buffer_old_size + idx_count);
     IdxBuffer.resize(idx_buffer_old_size + idx_count);
     _IdxWritePtr = IdxBuffer.Data + idx_buffer_old_size;
 }
 
+// Move IdxBuffer to an allocation of its own, when the current channel of an ImDrawListSplitter outgrows the range reserved for it by Split().
+void ImDrawList::_SpillIdxBuffer(int new_size)
+{
+    IM_ASSERT(_IdxBorrowed);
+    ImVector<ImDrawIdx> idx_buffer;
+    idx_buffer.reserve(IdxBuffer._grow_capacity(new_size));
+    idx_buffer.resize(IdxBuffer.Size);
+    if (IdxBuffer.Size > 0)
+        memcpy(idx_buffer.Data, IdxBuffer.Data, (size_t)IdxBuffer.Size * sizeof(ImDrawIdx));
+    memcpy(&IdxBuffer, &idx_buffer, sizeof(IdxBuffer));
+    memset(&idx_buffer, 0, sizeof(idx_buffer)); // Ownership moved to IdxBuffer, the range stays owned by the splitter
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+    _IdxBorrowed = false;
+}
+
 // Release the a number of reserved vertices/indices from the end of the last reservation made with PrimReserve().
 void ImDrawList::PrimUnreserve(int idx_count, int vtx_count)
 {
@@ -612,17 +737,101 @@ void ImDrawList::PrimUnreserve(int idx_count, int vtx_count)
     IdxBuffer.shrink(IdxBuffer.Size - idx_count);
 }
 
+// Types of ImDrawVert::pos and ImDrawVert::uv. Writers convert values shared by several vertices once, as with the compact
+// layout (IMGUI_USE_COMPACT_DRAWVERT) every conversion from float has a cost. Custom layouts are expected to use ImVec2.
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+typedef ImDrawVertPos16 ImDrawVertPos;
+typedef ImDrawVertUV16  ImDrawVertUV;
+#else
+typedef ImVec2          ImDrawVertPos;
+typedef ImVec2          ImDrawVertUV;
+#endif
+
+#if defined(IMGUI_ENABLE_SSE) && defined(IMGUI_USE_COMPACT_DRAWVERT)
+// Convert 4 components with the same rounding and clamping as ImDrawVertPosComponent16/ImDrawVertUVComponent16, to 32-bit integers.
+// Clamping happens in float (_mm_max_ps() returns its second operand for NaN, as the scalar code does), as _mm_cvttps_epi32() returns
+// INT_MIN for out of range values.
+static inline __m128i ImDrawVertPos16FromFloat4(__m128 pos)
+{
+    __m128 f = _mm_add_ps(_mm_mul_ps(pos, _mm_set1_ps(IM_DRAWVERT_POS16_ONE)), _mm_set1_ps(32768.5f));
+    f = _mm_min_ps(_mm_max_ps(f, _mm_set1_ps(1.0f)), _mm_set1_ps(65535.0f));
+    return _mm_sub_epi32(_mm_cvttps_epi32(f), _mm_set1_epi32(32768));
+}
+
+static inline __m128i ImDrawVertUV16FromFloat4(__m128 uv)
+{
+    __m128 f = _mm_add_ps(_mm_mul_ps(uv, _mm_set1_ps(65535.0f)), _mm_set1_ps(0.5f));
+    f = _mm_min_ps(_mm_max_ps(f, _mm_set1_ps(0.0f)), _mm_set1_ps(65535.0f));
+    return _mm_cvttps_epi32(f);
+}
+#endif
+
+// Write an axis aligned quad: (a.x,a.y) (c.x,a.y) (c.x,c.y) (a.x,c.y)
+static inline void ImDrawVertWriteRect(ImDrawVert* vtx, const ImVec2& a, const ImVec2& c, const ImVec2& uv_a_f32, const ImVec2& uv_c_f32, ImU32 col)
+{
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+    // Default layout: write the position and UV of each vertex with a single 16 bytes store
+    const __m128 pos = _mm_setr_ps(a.x, a.y, c.x, c.y);
+    const __m128 uv = _mm_setr_ps(uv_a_f32.x, uv_a_f32.y, uv_c_f32.x, uv_c_f32.y);
+    const __m128 pos_ca = _mm_shuffle_ps(pos, pos, _MM_SHUFFLE(3, 0, 1, 2));   // c.x, a.y, a.x, c.y
+    const __m128 uv_ca = _mm_shuffle_ps(uv, uv, _MM_SHUFFLE(3, 0, 1, 2));
+    _mm_storeu_ps(&vtx[0].pos.x, _mm_shuffle_ps(pos, uv, _MM_SHUFFLE(1, 0, 1, 0)));
+    _mm_storeu_ps(&vtx[1].pos.x, _mm_shuffle_ps(pos_ca, uv_ca, _MM_SHUFFLE(1, 0, 1, 0)));
+    _mm_storeu_ps(&vtx[2].pos.x, _mm_shuffle_ps(pos, uv, _MM_SHUFFLE(3, 2, 3, 2)));
+    _mm_storeu_ps(&vtx[3].pos.x, _mm_shuffle_ps(pos_ca, uv_ca, _MM_SHUFFLE(3, 2, 3, 2)));
+    vtx[0].col = vtx[1].col = vtx[2].col = vtx[3].col = col;
+#else
+    ImDrawVertPos pos_a, pos_c;
+    ImDrawVertUV uv_a, uv_c;
+#if defined(IMGUI_ENABLE_SSE) && defined(IMGUI_USE_COMPACT_DRAWVERT)
+    // Convert all components at once. UV are offset by -32768 to fit the signed range of _mm_packs_epi32().
+    const __m128i pos32 = ImDrawVertPos16FromFloat4(_mm_setr_ps(a.x, a.y, c.x, c.y));
+    const __m128i uv32 = _mm_sub_epi32(ImDrawVertUV16FromFloat4(_mm_setr_ps(uv_a_f32.x, uv_a_f32.y, uv_c_f32.x, uv_c_f32.y)), _mm_set1_epi32(32768));
+    __m128i packed = _mm_packs_epi32(pos32, uv32);
+    packed = _mm_xor_si128(packed, _mm_setr_epi16(0, 0, 0, 0, (short)0x8000, (short)0x8000, (short)0x8000, (short)0x8000));
+    ImU32 packed_u32[4];
+    _mm_storeu_si128((__m128i*)(void*)packed_u32, packed);
+    memcpy(&pos_a, &packed_u32[0], sizeof(ImU32));
+    memcpy(&pos_c, &packed_u32[1], sizeof(ImU32));
+    memcpy(&uv_a, &packed_u32[2], sizeof(ImU32));
+    memcpy(&uv_c, &packed_u32[3], sizeof(ImU32));
+#else
+    pos_a = a;
+    pos_c = c;
+    uv_a = uv_a_f32;
+    uv_c = uv_c_f32;
+#endif
+    vtx[0].pos = pos_a;                             vtx[0].uv = uv_a;                           vtx[0].col = col;
+    vtx[1].pos.x = pos_c.x; vtx[1].pos.y = pos_a.y; vtx[1].uv.x = uv_c.x; vtx[1].uv.y = uv_a.y; vtx[1].col = col;
+    vtx[2].pos = pos_c;                             vtx[2].uv = uv_c;                           vtx[2].col = col;
+    vtx[3].pos.x = pos_a.x; vtx[3].pos.y = pos_c.y; vtx[3].uv.x = uv_a.x; vtx[3].uv.y = uv_c.y; vtx[3].col = col;
+#endif
+}
+
+// Write positions of two vertices
+static inline void ImDrawVertWritePos2(ImDrawVert* v0, ImDrawVert* v1, float x0, float y0, float x1, float y1)
+{
+#if defined(IMGUI_ENABLE_SSE) && defined(IMGUI_USE_COMPACT_DRAWVERT)
+    const __m128i pos32 = ImDrawVertPos16FromFloat4(_mm_setr_ps(x0, y0, x1, y1));
+    const __m128i pos16 = _mm_packs_epi32(pos32, pos32);
+    const int pos16_0 = _mm_cvtsi128_si32(pos16);
+    const int pos16_1 = _mm_cvtsi128_si32(_mm_srli_si128(pos16, 4));
+    memcpy(&v0->pos, &pos16_0, sizeof(int));
+    memcpy(&v1->pos, &pos16_1, sizeof(int));
+#else
+    v0->pos.x = x0; v0->pos.y = y0;
+    v1->pos.x = x1; v1->pos.y = y1;
+#endif
+}
+
 // Fully unrolled with inline call to keep our debug builds decently fast.
 void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
 {
-    ImVec2 b(c.x, a.y), d(a.x, c.y), uv(_Data->TexUvWhitePixel);
+    const ImVec2 uv = _Data->TexUvWhitePixel;
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv; _VtxWritePtr[3].col = col;
+    ImDrawVertWriteRect(_VtxWritePtr, a, c, uv, uv, col);
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -630,14 +839,10 @@ void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
 
 void ImDrawList::PrimRectUV(const ImVec2& a, const ImVec2& c, const ImVec2& uv_a, const ImVec2& uv_c, ImU32 col)
 {
-    ImVec2 b(c.x, a.y), d(a.x, c.y), uv_b(uv_c.x, uv_a.y), uv_d(uv_a.x, uv_c.y);
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
+    ImDrawVertWriteRect(_VtxWritePtr, a, c, uv_a, uv_c, col);
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -662,6 +867,235 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_NORMALIZE2F_OVER_ZERO(VX,VY)     do { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = 1.0f / ImSqrt(d2); VX *= inv_len; VY *= inv_len; } } while (0)
 #define IM_FIXNORMAL2F(VX,VY)               do { float d2 = VX*VX + VY*VY; if (d2 < 0.5f) d2 = 0.5f; float inv_lensq = 1.0f / d2; VX *= inv_lensq; VY *= inv_lensq; } while (0)
 
+// Helpers for the anti-aliased paths of AddPolyline().
+// The SIMD variants process two points per iteration and use IEEE sqrt/div (not the rsqrt/rcp approximations) so their output is
+// bit-identical to the scalar code, which is also used for the remaining points and when IMGUI_DISABLE_SIMD is defined.
+// - ImPolylineComputeNormals(): out_normals[i] = normal of segment (i, i+1), last segment of a closed line wrapping to point 0.
+//   For an open line the last normal is duplicated so there is always one normal per point.
+// - ImPolylineComputeMiters(): in-place, replace normals with the per-point offset direction: average of the normals of the two segments
+//   meeting at the point, scaled so the stroke keeps its width at joints. For an open line the first point keeps its segment normal.
+// - ImPolylineWriteVertices(): write <vtx_per_point> vertices for each point, vertex n being offset along the point miter by offsets[n].
+static void ImPolylineComputeNormals(const ImVec2* points, const int points_count, bool closed, ImVec2* out_normals)
+{
+    const int count = closed ? points_count : points_count - 1;
+    int i1 = 0;
+#if defined(IMGUI_ENABLE_SSE)
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 neg_y = _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+    for (; i1 + 2 < points_count; i1 += 2)
+    {
+        __m128 d = _mm_sub_ps(_mm_loadu_ps(&points[i1 + 1].x), _mm_loadu_ps(&points[i1].x));    // dx0, dy0, dx1, dy1
+        __m128 d2 = _mm_mul_ps(d, d);
+        d2 = _mm_add_ps(d2, _mm_shuffle_ps(d2, d2, _MM_SHUFFLE(2, 3, 0, 1)));                  // dx*dx + dy*dy in both lanes of each pair
+        __m128 mask = _mm_cmpgt_ps(d2, zero);
+        __m128 inv_len = _mm_div_ps(one, _mm_sqrt_ps(d2));
+        inv_len = _mm_or_ps(_mm_and_ps(mask, inv_len), _mm_andnot_ps(mask, one));
+        d = _mm_mul_ps(d, inv_len);
+        _mm_storeu_ps(&out_normals[i1].x, _mm_xor_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)), neg_y)); // dy0, -dx0, dy1, -dx1
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float neg_y_values[4] = { 1.0f, -1.0f, 1.0f, -1.0f };
+    const float32x4_t neg_y = vld1q_f32(neg_y_values);
+    for (; i1 + 2 < points_count; i1 += 2)
+    {
+        float32x4_t d = vsubq_f32(vld1q_f32(&points[i1 + 1].x), vld1q_f32(&points[i1].x));
+        float32x4_t d2 = vmulq_f32(d, d);
+        d2 = vaddq_f32(d2, vrev64q_f32(d2));
+        uint32x4_t mask = vcgtq_f32(d2, zero);
+        float32x4_t inv_len = vbslq_f32(mask, vdivq_f32(one, vsqrtq_f32(d2)), one);
+        d = vmulq_f32(d, inv_len);
+        vst1q_f32(&out_normals[i1].x, vmulq_f32(vrev64q_f32(d), neg_y));
+    }
+#endif
+    for (; i1 < count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[i1].x = dy;
+        out_normals[i1].y = -dx;
+    }
+    if (!closed)
+        out_normals[points_count - 1] = out_normals[points_count - 2];
+}
+
+static void ImPolylineComputeMiters(ImVec2* normals, const int points_count, bool closed)
+{
+    // Iterate backward so each normal is overwritten only after both of its users have read it
+    const ImVec2 normal_last = normals[points_count - 1];
+    int i2 = points_count - 1;
+#if defined(IMGUI_ENABLE_SSE)
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    for (; i2 >= 2; i2 -= 2)
+    {
+        __m128 dm = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&normals[i2 - 2].x), _mm_loadu_ps(&normals[i2 - 1].x)), half);
+        __m128 d2 = _mm_mul_ps(dm, dm);
+        d2 = _mm_max_ps(half, _mm_add_ps(d2, _mm_shuffle_ps(d2, d2, _MM_SHUFFLE(2, 3, 0, 1))));
+        _mm_storeu_ps(&normals[i2 - 1].x, _mm_mul_ps(dm, _mm_div_ps(one, d2)));
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    for (; i2 >= 2; i2 -= 2)
+    {
+        float32x4_t dm = vmulq_f32(vaddq_f32(vld1q_f32(&normals[i2 - 2].x), vld1q_f32(&normals[i2 - 1].x)), half);
+        float32x4_t d2 = vmulq_f32(dm, dm);
+        d2 = vmaxq_f32(half, vaddq_f32(d2, vrev64q_f32(d2)));
+        vst1q_f32(&normals[i2 - 1].x, vmulq_f32(dm, vdivq_f32(one, d2)));
+    }
+#endif
+    for (; i2 >= 1; i2--)
+    {
+        float dm_x = (normals[i2 - 1].x + normals[i2].x) * 0.5f;
+        float dm_y = (normals[i2 - 1].y + normals[i2].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        normals[i2].x = dm_x;
+        normals[i2].y = dm_y;
+    }
+    if (closed)
+    {
+        float dm_x = (normal_last.x + normals[0].x) * 0.5f;
+        float dm_y = (normal_last.y + normals[0].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        normals[0].x = dm_x;
+        normals[0].y = dm_y;
+    }
+}
+
+static void ImPolylineWriteVertices(ImDrawVert* vtx_write, const ImVec2* points, const ImVec2* miters, const int points_count, const int vtx_per_point, const float* offsets, const ImVec2* uvs, const ImU32* cols)
+{
+    int i = 0;
+#if defined(IMGUI_ENABLE_SSE) && defined(IMGUI_USE_COMPACT_DRAWVERT)
+    // Compact layout: same rounding and clamping as ImDrawVertPosComponent16, two points at a time
+    ImDrawVertUV16 uvs16[4];
+    for (int n = 0; n < vtx_per_point; n++)
+        uvs16[n] = uvs[n];
+    for (; i + 1 < points_count; i += 2, vtx_write += vtx_per_point * 2)
+    {
+        const __m128 p = _mm_loadu_ps(&points[i].x);
+        const __m128 m = _mm_loadu_ps(&miters[i].x);
+        for (int n = 0; n < vtx_per_point; n++)
+        {
+            const __m128 pos = _mm_add_ps(p, _mm_mul_ps(m, _mm_set1_ps(offsets[n])));
+            const __m128i pos32 = ImDrawVertPos16FromFloat4(pos);
+            const __m128i pos16 = _mm_packs_epi32(pos32, pos32);
+            const int pos16_0 = _mm_cvtsi128_si32(pos16);
+            const int pos16_1 = _mm_cvtsi128_si32(_mm_srli_si128(pos16, 4));
+            ImDrawVert* v0 = &vtx_write[n];
+            ImDrawVert* v1 = &vtx_write[vtx_per_point + n];
+            memcpy(&v0->pos, &pos16_0, sizeof(int)); v0->uv = uvs16[n]; v0->col = cols[n];
+            memcpy(&v1->pos, &pos16_1, sizeof(int)); v1->uv = uvs16[n]; v1->col = cols[n];
+        }
+    }
+#elif defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
+    for (; i + 1 < points_count; i += 2, vtx_write += vtx_per_point * 2)
+    {
+        const __m128 p = _mm_loadu_ps(&points[i].x);
+        const __m128 m = _mm_loadu_ps(&miters[i].x);
+        for (int n = 0; n < vtx_per_point; n++)
+        {
+            const __m128 pos = _mm_add_ps(p, _mm_mul_ps(m, _mm_set1_ps(offsets[n])));
+            ImDrawVert* v0 = &vtx_write[n];
+            ImDrawVert* v1 = &vtx_write[vtx_per_point + n];
+            _mm_storel_pi((__m64*)(void*)&v0->pos, pos); v0->uv = uvs[n]; v0->col = cols[n];
+            _mm_storeh_pi((__m64*)(void*)&v1->pos, pos); v1->uv = uvs[n]; v1->col = cols[n];
+        }
+    }
+#elif defined(IMGUI_ENABLE_NEON) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
+    for (; i + 1 < points_count; i += 2, vtx_write += vtx_per_point * 2)
+    {
+        const float32x4_t p = vld1q_f32(&points[i].x);
+        const float32x4_t m = vld1q_f32(&miters[i].x);
+        for (int n = 0; n < vtx_per_point; n++)
+        {
+            const float32x4_t pos = vaddq_f32(p, vmulq_n_f32(m, offsets[n]));
+            ImDrawVert* v0 = &vtx_write[n];
+            ImDrawVert* v1 = &vtx_write[vtx_per_point + n];
+            vst1_f32(&v0->pos.x, vget_low_f32(pos)); v0->uv = uvs[n]; v0->col = cols[n];
+            vst1_f32(&v1->pos.x, vget_high_f32(pos)); v1->uv = uvs[n]; v1->col = cols[n];
+        }
+    }
+#endif
+    for (; i < points_count; i++, vtx_write += vtx_per_point)
+        for (int n = 0; n < vtx_per_point; n++)
+        {
+            vtx_write[n].pos.x = points[i].x + miters[i].x * offsets[n];
+            vtx_write[n].pos.y = points[i].y + miters[i].y * offsets[n];
+            vtx_write[n].uv = uvs[n];
+            vtx_write[n].col = cols[n];
+        }
+}
+
+// Reserve space for a primitive written by AddPolyline()/AddConvexPolyFilled(). Return false when the primitive got recorded instead of
+// being written now (ImDrawListFlags_DeferredTessellation): the reserved space is skipped over, and filled later by _FlushDeferredPrims().
+static bool ImDrawList_PrimReserveOrDefer(ImDrawList* draw_list, int idx_count, int vtx_count, const ImVec2* points, const int points_count, ImU32 col, bool filled, bool closed, float thickness)
+{
+    if (draw_list->_DeferredFlushing)
+        return true;
+    draw_list->PrimReserve(idx_count, vtx_count);
+    if (!(draw_list->Flags & ImDrawListFlags_DeferredTessellation))
+        return true;
+
+    ImDrawDeferredPrim prim;
+    prim.VtxOffset = (unsigned int)(draw_list->_VtxWritePtr - draw_list->VtxBuffer.Data);
+    prim.IdxOffset = (unsigned int)(draw_list->_IdxWritePtr - draw_list->IdxBuffer.Data);
+    prim.VtxCurrentIdx = draw_list->_VtxCurrentIdx;
+    prim.PointsOffset = draw_list->_DeferredPoints.Size;
+    prim.PointsCount = points_count;
+    prim.Col = col;
+    prim.Thickness = thickness;
+    prim.Flags = draw_list->Flags & ~ImDrawListFlags_DeferredTessellation;
+    prim.Filled = filled;
+    prim.Closed = closed;
+    draw_list->_DeferredPrims.push_back(prim);
+    draw_list->_DeferredPoints.resize(draw_list->_DeferredPoints.Size + points_count);
+    memcpy(draw_list->_DeferredPoints.Data + prim.PointsOffset, points, points_count * sizeof(ImVec2));
+
+    draw_list->_VtxWritePtr += vtx_count;
+    draw_list->_IdxWritePtr += idx_count;
+    draw_list->_VtxCurrentIdx += vtx_count;
+    return false;
+}
+
+// Write the geometry of primitives recorded with ImDrawListFlags_DeferredTessellation into their reserved space.
+// This only touches this draw list so it may run on any thread, and it is called by Render() for all draw lists (see io.RenderJobsFn).
+// It is also called before anything reads back vertices or swaps the index buffer (ShadeVertsXXX functions, channels).
+void ImDrawList::_FlushDeferredPrims()
+{
+    if (_DeferredPrims.Size == 0)
+        return;
+
+    ImDrawVert* backup_vtx_write_ptr = _VtxWritePtr;
+    ImDrawIdx* backup_idx_write_ptr = _IdxWritePtr;
+    const unsigned int backup_vtx_current_idx = _VtxCurrentIdx;
+    const ImDrawListFlags backup_flags = Flags;
+    _DeferredFlushing = true;
+    for (int prim_n = 0; prim_n < _DeferredPrims.Size; prim_n++)
+    {
+        const ImDrawDeferredPrim& prim = _DeferredPrims[prim_n];
+        _VtxWritePtr = VtxBuffer.Data + prim.VtxOffset;
+        _IdxWritePtr = IdxBuffer.Data + prim.IdxOffset;
+        _VtxCurrentIdx = prim.VtxCurrentIdx;
+        Flags = prim.Flags;
+        if (prim.Filled)
+            AddConvexPolyFilled(&_DeferredPoints[prim.PointsOffset], prim.PointsCount, prim.Col);
+        else
+            AddPolyline(&_DeferredPoints[prim.PointsOffset], prim.PointsCount, prim.Col, prim.Closed, prim.Thickness);
+    }
+    _DeferredFlushing = false;
+    _VtxWritePtr = backup_vtx_write_ptr;
+    _IdxWritePtr = backup_idx_write_ptr;
+    _VtxCurrentIdx = backup_vtx_current_idx;
+    Flags = backup_flags;
+    _DeferredPrims.resize(0);
+    _DeferredPoints.resize(0);
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, bool closed, float thickness)
@@ -694,25 +1128,17 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
 
         const int idx_count = use_texture ? (count * 6) : (thick_line ? count * 18 : count * 12);
         const int vtx_count = use_texture ? (points_count * 2) : (thick_line ? points_count * 4 : points_count * 3);
-        PrimReserve(idx_count, vtx_count);
+        if (!ImDrawList_PrimReserveOrDefer(this, idx_count, vtx_count, points, points_count, col, false, closed, thickness))
+            return;
 
         // Temporary buffer
-        // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
-        ImVec2* temp_normals = (ImVec2*)alloca(points_count * ((use_texture || !thick_line) ? 3 : 5) * sizeof(ImVec2)); //-V630
-        ImVec2* temp_points = temp_normals + points_count;
+        // Holds the normal of each line segment, then the averaged normal at each line point
+        ImVec2* temp_normals = (ImVec2*)alloca(points_count * sizeof(ImVec2)); //-V630
 
-        // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
-        {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
-        }
-        if (!closed)
-            temp_normals[points_count - 1] = temp_normals[points_count - 2];
+        // Calculate normals (tangents) for each line segment, then blend them at each line point
+        // If line is not closed, the first and last points use the normal of their only segment as there are no normals to blend
+        ImPolylineComputeNormals(points, points_count, closed, temp_normals);
+        ImPolylineComputeMiters(temp_normals, points_count, closed);
 
         // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
         if (use_texture || !thick_line)
@@ -727,38 +1153,11 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             //   allow scaling geometry while preserving one-screen-pixel AA fringe).
             const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                temp_points[0] = points[0] + temp_normals[0] * half_draw_size;
-                temp_points[1] = points[0] - temp_normals[0] * half_draw_size;
-                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * half_draw_size;
-                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            // Generate the indices to form a number of triangles for each line segment
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
                 const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertexes for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
                 if (use_texture)
                 {
                     // Add indices for two triangles
@@ -792,25 +1191,18 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                     tex_uvs.z = tex_uvs.z + (tex_uvs_1.z - tex_uvs.z) * fractional_thickness;
                     tex_uvs.w = tex_uvs.w + (tex_uvs_1.w - tex_uvs.w) * fractional_thickness;
                 }
-                ImVec2 tex_uv0(tex_uvs.x, tex_uvs.y);
-                ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
-                for (int i = 0; i < points_count; i++)
-                {
-                    _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
-                    _VtxWritePtr += 2;
-                }
+                const float offsets[2] = { half_draw_size, -half_draw_size };                           // Left-side outer edge, Right-side outer edge
+                const ImVec2 uvs[2] = { ImVec2(tex_uvs.x, tex_uvs.y), ImVec2(tex_uvs.z, tex_uvs.w) };
+                const ImU32 cols[2] = { col, col };
+                ImPolylineWriteVertices(_VtxWritePtr, points, temp_normals, points_count, 2, offsets, uvs, cols);
             }
             else
             {
                 // If we're not using a texture, we need the center vertex as well
-                for (int i = 0; i < points_count; i++)
-                {
-                    _VtxWritePtr[0].pos = points[i];              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 0]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
-                    _VtxWritePtr[2].pos = temp_points[i * 2 + 1]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
-                    _VtxWritePtr += 3;
-                }
+                const float offsets[3] = { 0.0f, half_draw_size, -half_draw_size };                     // Center of line, Left-side outer edge, Right-side outer edge
+                const ImVec2 uvs[3] = { opaque_uv, opaque_uv, opaque_uv };
+                const ImU32 cols[3] = { col, col_trans, col_trans };
+                ImPolylineWriteVertices(_VtxWritePtr, points, temp_normals, points_count, 3, offsets, uvs, cols);
             }
         }
         else
@@ -818,49 +1210,12 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             // [PATH 2] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
             const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                const int points_last = points_count - 1;
-                temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
-                temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
-                temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 0] = points[points_last] + temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 1] = points[points_last] + temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 2] = points[points_last] - temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            // Generate the indices to form a number of triangles for each line segment
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
                 const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
                 // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
                 _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
@@ -873,24 +1228,24 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 idx1 = idx2;
             }
 
-            // Add vertices
-            for (int i = 0; i < points_count; i++)
-            {
-                _VtxWritePtr[0].pos = temp_points[i * 4 + 0]; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i * 4 + 1]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i * 4 + 2]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
-                _VtxWritePtr += 4;
-            }
+            // Add vertices: outer edge of AA area, edges of the solid core, outer edge of AA area
+            const float offsets[4] = { half_inner_thickness + AA_SIZE, half_inner_thickness, -half_inner_thickness, -(half_inner_thickness + AA_SIZE) };
+            const ImVec2 uvs[4] = { opaque_uv, opaque_uv, opaque_uv, opaque_uv };
+            const ImU32 cols[4] = { col_trans, col, col, col_trans };
+            ImPolylineWriteVertices(_VtxWritePtr, points, temp_normals, points_count, 4, offsets, uvs, cols);
         }
+        _VtxWritePtr += vtx_count;
         _VtxCurrentIdx += (ImDrawIdx)vtx_count;
     }
     else
     {
         // [PATH 4] Non texture-based, Non anti-aliased lines
+        ImDrawVertUV vtx_uv;
+        vtx_uv = opaque_uv;
         const int idx_count = count * 6;
         const int vtx_count = count * 4;    // FIXME-OPT: Not sharing edges
-        PrimReserve(idx_count, vtx_count);
+        if (!ImDrawList_PrimReserveOrDefer(this, idx_count, vtx_count, points, points_count, col, false, closed, thickness))
+            return;
 
         for (int i1 = 0; i1 < count; i1++)
         {
@@ -904,10 +1259,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             dx *= (thickness * 0.5f);
             dy *= (thickness * 0.5f);
 
-            _VtxWritePtr[0].pos.x = p1.x + dy; _VtxWritePtr[0].pos.y = p1.y - dx; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr[1].pos.x = p2.x + dy; _VtxWritePtr[1].pos.y = p2.y - dx; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-            _VtxWritePtr[2].pos.x = p2.x - dy; _VtxWritePtr[2].pos.y = p2.y + dx; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-            _VtxWritePtr[3].pos.x = p1.x - dy; _VtxWritePtr[3].pos.y = p1.y + dx; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col;
+            _VtxWritePtr[0].pos.x = p1.x + dy; _VtxWritePtr[0].pos.y = p1.y - dx; _VtxWritePtr[0].uv = vtx_uv; _VtxWritePtr[0].col = col;
+            _VtxWritePtr[1].pos.x = p2.x + dy; _VtxWritePtr[1].pos.y = p2.y - dx; _VtxWritePtr[1].uv = vtx_uv; _VtxWritePtr[1].col = col;
+            _VtxWritePtr[2].pos.x = p2.x - dy; _VtxWritePtr[2].pos.y = p2.y + dx; _VtxWritePtr[2].uv = vtx_uv; _VtxWritePtr[2].col = col;
+            _VtxWritePtr[3].pos.x = p1.x - dy; _VtxWritePtr[3].pos.y = p1.y + dx; _VtxWritePtr[3].uv = vtx_uv; _VtxWritePtr[3].col = col;
             _VtxWritePtr += 4;
 
             _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + 1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + 2);
@@ -924,7 +1279,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
     if (points_count < 3)
         return;
 
-    const ImVec2 uv = _Data->TexUvWhitePixel;
+    ImDrawVertUV uv;
+    uv = _Data->TexUvWhitePixel;
 
     if (Flags & ImDrawListFlags_AntiAliasedFill)
     {
@@ -933,7 +1289,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         const ImU32 col_trans = col & ~IM_COL32_A_MASK;
         const int idx_count = (points_count - 2)*3 + points_count * 6;
         const int vtx_count = (points_count * 2);
-        PrimReserve(idx_count, vtx_count);
+        if (!ImDrawList_PrimReserveOrDefer(this, idx_count, vtx_count, points, points_count, col, true, true, 0.0f))
+            return;
 
         // Add indexes for fill
         unsigned int vtx_inner_idx = _VtxCurrentIdx;
@@ -969,8 +1326,9 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             dm_y *= AA_SIZE * 0.5f;
 
             // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+            ImDrawVertWritePos2(&_VtxWritePtr[0], &_VtxWritePtr[1], points[i1].x - dm_x, points[i1].y - dm_y, points[i1].x + dm_x, points[i1].y + dm_y); // Inner, Outer
+            _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
+            _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;
             _VtxWritePtr += 2;
 
             // Add indexes for fringes
@@ -985,7 +1343,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         // Non Anti-aliased Fill
         const int idx_count = (points_count - 2)*3;
         const int vtx_count = points_count;
-        PrimReserve(idx_count, vtx_count);
+        if (!ImDrawList_PrimReserveOrDefer(this, idx_count, vtx_count, points, points_count, col, true, true, 0.0f))
+            return;
         for (int i = 0; i < vtx_count; i++)
         {
             _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
@@ -1023,6 +1382,35 @@ void ImDrawList::PathArcToFast(const ImVec2& center, float radius, int a_min_of_
     }
 }
 
+// Append points of an arc, starting at unit vector 'dir' and rotating it by 'step' (cos, sin of the angle between two points) for each following point.
+// The accumulated rotation error stays below 1e-5 for 512 points, i.e. under 0.02 pixel for a radius of 2048.
+static inline void PathArcByRotation(ImVector<ImVec2>* path, const ImVec2& center, float radius, ImVec2 dir, const ImVec2& step, int num_points)
+{
+    path->reserve(path->Size + num_points);
+    ImVec2* out = path->Data + path->Size;
+    for (int n = 0; n < num_points; n++)
+    {
+        out[n] = ImVec2(center.x + dir.x * radius, center.y + dir.y * radius);
+        dir = ImVec2(dir.x * step.x - dir.y * step.y, dir.x * step.y + dir.y * step.x);
+    }
+    path->Size += num_points;
+}
+
+// Closed circle of 'num_segments' points, starting at angle 0 (the first point is not repeated).
+// Uses the precomputed rotations of ImDrawListSharedData::CircleSegmentSteps[], so no trigonometry is needed.
+static void ImDrawList_PathCircle(ImDrawList* draw_list, const ImVec2& center, float radius, int num_segments)
+{
+    const ImDrawListSharedData* data = draw_list->_Data;
+    if (radius == 0.0f)
+        draw_list->_Path.push_back(center);
+    else if (num_segments == 12)
+        draw_list->PathArcToFast(center, radius, 0, 12 - 1);
+    else if (num_segments < IM_ARRAYSIZE(data->CircleSegmentSteps))
+        PathArcByRotation(&draw_list->_Path, center, radius, ImVec2(1.0f, 0.0f), data->CircleSegmentSteps[num_segments], num_segments);
+    else
+        draw_list->PathArcTo(center, radius, 0.0f, (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments, num_segments - 1);
+}
+
 void ImDrawList::PathArcTo(const ImVec2& center, float radius, float a_min, float a_max, int num_segments)
 {
     if (radius == 0.0f)
@@ -1033,12 +1421,8 @@ void ImDrawList::PathArcTo(const ImVec2& center, float radius, float a_min, floa
 
     // Note that we are adding a point at both a_min and a_max.
     // If you are trying to draw a full closed circle you don't want the overlapping points!
-    _Path.reserve(_Path.Size + (num_segments + 1));
-    for (int i = 0; i <= num_segments; i++)
-    {
-        const float a = a_min + ((float)i / (float)num_segments) * (a_max - a_min);
-        _Path.push_back(ImVec2(center.x + ImCos(a) * radius, center.y + ImSin(a) * radius));
-    }
+    const float a_step = (a_max - a_min) / (float)num_segments;
+    PathArcByRotation(&_Path, center, radius, ImVec2(ImCos(a_min), ImSin(a_min)), ImVec2(ImCos(a_step), ImSin(a_step)), num_segments + 1);
 }
 
 ImVec2 ImBezierCalc(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, float t)
@@ -1051,30 +1435,32 @@ ImVec2 ImBezierCalc(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const
     return ImVec2(w1*p1.x + w2*p2.x + w3*p3.x + w4*p4.x, w1*p1.y + w2*p2.y + w3*p3.y + w4*p4.y);
 }
 
-// Closely mimics BezierClosestPointCasteljauStep() in imgui.cpp
-static void PathBezierToCasteljau(ImVector<ImVec2>* path, float x1, float y1, float x2, float y2, float x3, float y3, float x4, float y4, float tess_tol, int level)
+ImVec2 ImBezierQuadraticCalc(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, float t)
 {
-    float dx = x4 - x1;
-    float dy = y4 - y1;
-    float d2 = ((x2 - x4) * dy - (y2 - y4) * dx);
-    float d3 = ((x3 - x4) * dy - (y3 - y4) * dx);
-    d2 = (d2 >= 0) ? d2 : -d2;
-    d3 = (d3 >= 0) ? d3 : -d3;
-    if ((d2 + d3) * (d2 + d3) < tess_tol * (dx * dx + dy * dy))
-    {
-        path->push_back(ImVec2(x4, y4));
-    }
-    else if (level < 10)
-    {
-        float x12 = (x1 + x2)*0.5f,       y12 = (y1 + y2)*0.5f;
-        float x23 = (x2 + x3)*0.5f,       y23 = (y2 + y3)*0.5f;
-        float x34 = (x3 + x4)*0.5f,       y34 = (y3 + y4)*0.5f;
-        float x123 = (x12 + x23)*0.5f,    y123 = (y12 + y23)*0.5f;
-        float x234 = (x23 + x34)*0.5f,    y234 = (y23 + y34)*0.5f;
-        float x1234 = (x123 + x234)*0.5f, y1234 = (y123 + y234)*0.5f;
-        PathBezierToCasteljau(path, x1, y1,        x12, y12,    x123, y123,  x1234, y1234, tess_tol, level + 1);
-        PathBezierToCasteljau(path, x1234, y1234,  x234, y234,  x34, y34,    x4, y4,       tess_tol, level + 1);
-    }
+    float u = 1.0f - t;
+    float w1 = u*u;
+    float w2 = 2*u*t;
+    float w3 = t*t;
+    return ImVec2(w1*p1.x + w2*p2.x + w3*p3.x, w1*p1.y + w2*p2.y + w3*p3.y);
+}
+
+// Auto-tessellation of Bezier curves.
+// The number of segments is derived from the second derivative of the curve (Wang's formula): when sampling a curve at N even steps of t,
+// the distance between the curve and the polyline is at most max(|B''(t)|) / (8 * N^2). For a cubic curve |B''(t)| <= 6 * max(|p1 - 2*p2 + p3|, |p2 - 2*p3 + p4|),
+// for a quadratic curve |B''(t)| = 2 * |p1 - 2*p2 + p3|, which is the cubic bound for a value 3 times smaller.
+// Points are evaluated with ImBezierCalc()/ImBezierQuadraticCalc() like curves with an explicit number of segments, rather than with forward
+// differencing which drifts by a fraction of a pixel on long curves: ImBezierClosestPointCasteljau() gets the exact same points.
+static int ImBezierCalcAutoSegmentCount(float second_diff_len, const ImDrawListSharedData* data)
+{
+    if (data->CurveTessellationTol <= 0.0f)
+        return IM_DRAWLIST_CURVE_AUTO_SEGMENT_MAX;
+
+    // Build the cache on first use, or when CurveTessellationTol was modified directly (e.g. ImDrawList used without ImGui)
+    if (data->CurveFlattenMaxError != data->CurveTessellationTol / 3.0f)
+        ((ImDrawListSharedData*)data)->SetCurveTessellationTol(data->CurveTessellationTol);
+    if (second_diff_len < (float)IM_ARRAYSIZE(data->CurveSegmentCounts))
+        return data->CurveSegmentCounts[(int)second_diff_len]; // Use cached value
+    return IM_DRAWLIST_CURVE_AUTO_SEGMENT_CALC(second_diff_len, data->CurveFlattenMaxError);
 }
 
 void ImDrawList::PathBezierCurveTo(const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, int num_segments)
@@ -1082,20 +1468,44 @@ void ImDrawList::PathBezierCurveTo(const ImVec2& p2, const ImVec2& p3, const ImV
     ImVec2 p1 = _Path.back();
     if (num_segments == 0)
     {
-        PathBezierToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, p4.x, p4.y, _Data->CurveTessellationTol, 0); // Auto-tessellated
+        // Auto-tessellated
+        const ImVec2 d12 = p1 - p2 * 2.0f + p3, d23 = p2 - p3 * 2.0f + p4;
+        const float second_diff_len = ImSqrt(ImMax(ImDot(d12, d12), ImDot(d23, d23)));
+        num_segments = ImBezierCalcAutoSegmentCount(second_diff_len, _Data);
     }
-    else
+    _Path.reserve(_Path.Size + num_segments);
+    float t_step = 1.0f / (float)num_segments;
+    for (int i_step = 1; i_step <= num_segments; i_step++)
+        _Path.push_back(ImBezierCalc(p1, p2, p3, p4, t_step * i_step));
+}
+
+void ImDrawList::PathBezierQuadraticCurveTo(const ImVec2& p2, const ImVec2& p3, int num_segments)
+{
+    ImVec2 p1 = _Path.back();
+    if (num_segments == 0)
     {
-        float t_step = 1.0f / (float)num_segments;
-        for (int i_step = 1; i_step <= num_segments; i_step++)
-            _Path.push_back(ImBezierCalc(p1, p2, p3, p4, t_step * i_step));
+        // Auto-tessellated
+        const ImVec2 d12 = p1 - p2 * 2.0f + p3;
+        const float second_diff_len = ImSqrt(ImDot(d12, d12)) * (1.0f / 3.0f);
+        num_segments = ImBezierCalcAutoSegmentCount(second_diff_len, _Data);
     }
+    _Path.reserve(_Path.Size + num_segments);
+    float t_step = 1.0f / (float)num_segments;
+    for (int i_step = 1; i_step <= num_segments; i_step++)
+        _Path.push_back(ImBezierQuadraticCalc(p1, p2, p3, t_step * i_step));
 }
 
-void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDrawCornerFlags rounding_corners)
+// Reduce rounding so that rounded corners fit in the rectangle. Shared by PathRect() and the baked rounded corners path.
+static inline float ImDrawListClampRectRounding(const ImVec2& a, const ImVec2& b, float rounding, ImDrawCornerFlags rounding_corners)
 {
     rounding = ImMin(rounding, ImFabs(b.x - a.x) * ( ((rounding_corners & ImDrawCornerFlags_Top)  == ImDrawCornerFlags_Top)  || ((rounding_corners & ImDrawCornerFlags_Bot)   == ImDrawCornerFlags_Bot)   ? 0.5f : 1.0f ) - 1.0f);
     rounding = ImMin(rounding, ImFabs(b.y - a.y) * ( ((rounding_corners & ImDrawCornerFlags_Left) == ImDrawCornerFlags_Left) || ((rounding_corners & ImDrawCornerFlags_Right) == ImDrawCornerFlags_Right) ? 0.5f : 1.0f ) - 1.0f);
+    return rounding;
+}
+
+void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDrawCornerFlags rounding_corners)
+{
+    rounding = ImDrawListClampRectRounding(a, b, rounding, rounding_corners);
 
     if (rounding <= 0.0f || rounding_corners == 0)
     {
@@ -1117,21 +1527,134 @@ void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDr
     }
 }
 
+// Pixel-aligned fast paths for AddLine()/AddRect():
+// Strokes are centered on pixel centers (+0.5 offset), so an axis-aligned stroke with odd integer thickness at integer coordinates covers whole
+// pixels, and anti-aliasing fringes have no visible contribution. In this case we write the covered quads directly, with no normal computation.
+static inline bool ImDrawListIsPixelAligned(float v)            { return v == IM_FLOOR(v); }
+static inline bool ImDrawListIsOddIntegerThickness(float t)     { return t >= 1.0f && t == IM_FLOOR(t) && ((int)t & 1) != 0; }
+
 void ImDrawList::AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float thickness)
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (ImDrawListIsOddIntegerThickness(thickness))
+    {
+        // Line ends are not extended by PathStroke(), so they stay on pixel centers
+        const float half_out = (thickness - 1.0f) * 0.5f;
+        if (p1.y == p2.y && ImDrawListIsPixelAligned(p1.y))
+        {
+            PrimReserve(6, 4);
+            PrimRect(ImVec2(ImMin(p1.x, p2.x) + 0.5f, p1.y - half_out), ImVec2(ImMax(p1.x, p2.x) + 0.5f, p1.y + 1.0f + half_out), col);
+            return;
+        }
+        if (p1.x == p2.x && ImDrawListIsPixelAligned(p1.x))
+        {
+            PrimReserve(6, 4);
+            PrimRect(ImVec2(p1.x - half_out, ImMin(p1.y, p2.y) + 0.5f), ImVec2(p1.x + 1.0f + half_out, ImMax(p1.y, p2.y) + 0.5f), col);
+            return;
+        }
+    }
     PathLineTo(p1 + ImVec2(0.5f, 0.5f));
     PathLineTo(p2 + ImVec2(0.5f, 0.5f));
     PathStroke(col, false, thickness);
 }
 
+// Rounded rectangles using corners baked in the atlas (see ImFontAtlasBuildRenderRoundCornersTexData()).
+// They are drawn as a fixed-size mesh of textured corner quads + plain quads for the rest of the shape, instead of tessellated arcs.
+// UVs are laid out for the top-left corner: flip them for other corners so (uvs.x,uvs.y) always maps to the outer corner.
+static void ImDrawListPrimRoundCorner(ImDrawList* draw_list, const ImVec2& a, const ImVec2& c, const ImVec4& uvs, bool flip_x, bool flip_y, ImU32 col)
+{
+    const ImVec2 uv_a(flip_x ? uvs.z : uvs.x, flip_y ? uvs.w : uvs.y);
+    const ImVec2 uv_c(flip_x ? uvs.x : uvs.z, flip_y ? uvs.y : uvs.w);
+    draw_list->PrimRectUV(a, c, uv_a, uv_c, col);
+}
+
+// Return false if the rounding radius is not an integer, is not baked or the rectangle is too small to fit its corners, and the caller should use paths.
+static bool ImDrawListAddRectFilledRoundCornersTex(ImDrawList* draw_list, const ImVec2& a, const ImVec2& b, ImU32 col, float rounding, ImDrawCornerFlags rounding_corners)
+{
+    if (rounding < 1.0f || rounding > (float)IM_DRAWLIST_TEX_ROUND_CORNERS_MAX || rounding != ImFloor(rounding))
+        return false;
+    const int radius = (int)rounding;
+    const float size = rounding;
+    if (b.x - a.x < size * 2.0f || b.y - a.y < size * 2.0f)
+        return false;
+
+    // 4 corners (textured when rounded), top and bottom strips between the corners, middle band
+    const ImVec4& uvs = draw_list->_Data->TexUvRoundCornerFilled[radius];
+    draw_list->PrimReserve(7 * 6, 7 * 4);
+    if (rounding_corners & ImDrawCornerFlags_TopLeft)  ImDrawListPrimRoundCorner(draw_list, a, ImVec2(a.x + size, a.y + size), uvs, false, false, col); else draw_list->PrimRect(a, ImVec2(a.x + size, a.y + size), col);
+    if (rounding_corners & ImDrawCornerFlags_TopRight) ImDrawListPrimRoundCorner(draw_list, ImVec2(b.x - size, a.y), ImVec2(b.x, a.y + size), uvs, true, false, col); else draw_list->PrimRect(ImVec2(b.x - size, a.y), ImVec2(b.x, a.y + size), col);
+    if (rounding_corners & ImDrawCornerFlags_BotRight) ImDrawListPrimRoundCorner(draw_list, ImVec2(b.x - size, b.y - size), b, uvs, true, true, col); else draw_list->PrimRect(ImVec2(b.x - size, b.y - size), b, col);
+    if (rounding_corners & ImDrawCornerFlags_BotLeft)  ImDrawListPrimRoundCorner(draw_list, ImVec2(a.x, b.y - size), ImVec2(a.x + size, b.y), uvs, false, true, col); else draw_list->PrimRect(ImVec2(a.x, b.y - size), ImVec2(a.x + size, b.y), col);
+    draw_list->PrimRect(ImVec2(a.x + size, a.y), ImVec2(b.x - size, a.y + size), col);
+    draw_list->PrimRect(ImVec2(a.x + size, b.y - size), ImVec2(b.x - size, b.y), col);
+    draw_list->PrimRect(ImVec2(a.x, a.y + size), ImVec2(b.x, b.y - size), col);
+    return true;
+}
+
+// Only 1 pixel thick borders are baked, with all corners rounded.
+// 'rounding' is expected to be clamped for the rectangle inset by half a pixel (as used by the path version of AddRect()).
+static bool ImDrawListAddRectRoundCornersTex(ImDrawList* draw_list, const ImVec2& a, const ImVec2& b, ImU32 col, float rounding)
+{
+    if (rounding < 1.0f || rounding > (float)IM_DRAWLIST_TEX_ROUND_CORNERS_MAX || rounding != ImFloor(rounding))
+        return false;
+    const int radius = (int)rounding;
+    const float size = rounding + 1.0f;
+    if (b.x - a.x < size * 2.0f || b.y - a.y < size * 2.0f)
+        return false;
+
+    // 4 textured corners, 4 straight borders between them
+    const ImVec4& uvs = draw_list->_Data->TexUvRoundCornerStroked[radius];
+    draw_list->PrimReserve(8 * 6, 8 * 4);
+    ImDrawListPrimRoundCorner(draw_list, a, ImVec2(a.x + size, a.y + size), uvs, false, false, col);
+    ImDrawListPrimRoundCorner(draw_list, ImVec2(b.x - size, a.y), ImVec2(b.x, a.y + size), uvs, true, false, col);
+    ImDrawListPrimRoundCorner(draw_list, ImVec2(b.x - size, b.y - size), b, uvs, true, true, col);
+    ImDrawListPrimRoundCorner(draw_list, ImVec2(a.x, b.y - size), ImVec2(a.x + size, b.y), uvs, false, true, col);
+    draw_list->PrimRect(ImVec2(a.x + size, a.y), ImVec2(b.x - size, a.y + 1.0f), col);
+    draw_list->PrimRect(ImVec2(a.x + size, b.y - 1.0f), ImVec2(b.x - size, b.y), col);
+    draw_list->PrimRect(ImVec2(a.x, a.y + size), ImVec2(a.x + 1.0f, b.y - size), col);
+    draw_list->PrimRect(ImVec2(b.x - 1.0f, a.y + size), ImVec2(b.x, b.y - size), col);
+    return true;
+}
+
 // p_min = upper-left, p_max = lower-right
 // Note we don't render 1 pixels sized rectangles properly.
 void ImDrawList::AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding, ImDrawCornerFlags rounding_corners, float thickness)
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if ((rounding <= 0.0f || rounding_corners == 0) && ImDrawListIsOddIntegerThickness(thickness) && ImDrawListIsPixelAligned(p_min.x) && ImDrawListIsPixelAligned(p_min.y) && ImDrawListIsPixelAligned(p_max.x) && ImDrawListIsPixelAligned(p_max.y))
+    {
+        // Pixel-aligned frame: 4 outer + 4 inner vertices, 8 triangles (instead of 8 to 16 vertices and 8 to 16 triangles from PathStroke())
+        const float half_out = (thickness - 1.0f) * 0.5f;
+        const float half_in = (thickness + 1.0f) * 0.5f;
+        if (p_max.x - p_min.x >= thickness + 1.0f && p_max.y - p_min.y >= thickness + 1.0f)
+        {
+            const ImVec2 uv = _Data->TexUvWhitePixel;
+            PrimReserve(24, 8);
+            const ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
+            PrimWriteVtx(ImVec2(p_min.x - half_out, p_min.y - half_out), uv, col); // Outer
+            PrimWriteVtx(ImVec2(p_max.x + half_out, p_min.y - half_out), uv, col);
+            PrimWriteVtx(ImVec2(p_max.x + half_out, p_max.y + half_out), uv, col);
+            PrimWriteVtx(ImVec2(p_min.x - half_out, p_max.y + half_out), uv, col);
+            PrimWriteVtx(ImVec2(p_min.x + half_in, p_min.y + half_in), uv, col);   // Inner
+            PrimWriteVtx(ImVec2(p_max.x - half_in, p_min.y + half_in), uv, col);
+            PrimWriteVtx(ImVec2(p_max.x - half_in, p_max.y - half_in), uv, col);
+            PrimWriteVtx(ImVec2(p_min.x + half_in, p_max.y - half_in), uv, col);
+            for (int n = 0; n < 4; n++)
+            {
+                // One quad per side: outer[n], outer[n+1], inner[n+1], inner[n]
+                const ImDrawIdx n1 = (ImDrawIdx)((n + 1) & 3);
+                _IdxWritePtr[0] = (ImDrawIdx)(idx + n); _IdxWritePtr[1] = (ImDrawIdx)(idx + n1); _IdxWritePtr[2] = (ImDrawIdx)(idx + 4 + n1);
+                _IdxWritePtr[3] = (ImDrawIdx)(idx + n); _IdxWritePtr[4] = (ImDrawIdx)(idx + 4 + n1); _IdxWritePtr[5] = (ImDrawIdx)(idx + 4 + n);
+                _IdxWritePtr += 6;
+            }
+            return;
+        }
+    }
+    if ((Flags & ImDrawListFlags_AntiAliasedLines) && (Flags & ImDrawListFlags_RoundCornersUseTex) && rounding > 0.0f && thickness <= 1.0f && (rounding_corners & ImDrawCornerFlags_All) == ImDrawCornerFlags_All)
+        if (ImDrawListAddRectRoundCornersTex(this, p_min, p_max, col, ImDrawListClampRectRounding(p_min + ImVec2(0.50f, 0.50f), p_max - ImVec2(0.50f, 0.50f), rounding, rounding_corners)))
+            return;
     if (Flags & ImDrawListFlags_AntiAliasedLines)
         PathRect(p_min + ImVec2(0.50f, 0.50f), p_max - ImVec2(0.50f, 0.50f), rounding, rounding_corners);
     else
@@ -1143,8 +1666,13 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (rounding > 0.0f && rounding_corners == 0 && (!(Flags & ImDrawListFlags_AntiAliasedFill) || (ImDrawListIsPixelAligned(p_min.x) && ImDrawListIsPixelAligned(p_min.y) && ImDrawListIsPixelAligned(p_max.x) && ImDrawListIsPixelAligned(p_max.y))))
+        rounding = 0.0f; // No rounded corners and no visible AA fringe: same as a plain quad
     if (rounding > 0.0f)
     {
+        if ((Flags & ImDrawListFlags_AntiAliasedFill) && (Flags & ImDrawListFlags_RoundCornersUseTex) && rounding_corners != 0)
+            if (ImDrawListAddRectFilledRoundCornersTex(this, p_min, p_max, col, ImDrawListClampRectRounding(p_min, p_max, rounding, rounding_corners), rounding_corners))
+                return;
         PathRect(p_min, p_max, rounding, rounding_corners);
         PathFillConvex(col);
     }
@@ -1217,33 +1745,27 @@ void ImDrawList::AddTriangleFilled(const ImVec2& p1, const ImVec2& p2, const ImV
     PathFillConvex(col);
 }
 
+static int ImDrawList_CalcCircleSegmentCount(const ImDrawListSharedData* data, float radius, int num_segments)
+{
+    // Explicit segment count (still clamp to avoid drawing insanely tessellated shapes)
+    if (num_segments > 0)
+        return ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
+
+    // Automatic segment count
+    const int radius_idx = (int)radius - 1;
+    if (radius_idx >= 0 && radius_idx < IM_ARRAYSIZE(data->CircleSegmentCounts))
+        return data->CircleSegmentCounts[radius_idx]; // Use cached value
+    return IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC(radius, data->CircleSegmentMaxError);
+}
+
 void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int num_segments, float thickness)
 {
     if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f)
         return;
 
-    // Obtain segment count
-    if (num_segments <= 0)
-    {
-        // Automatic segment count
-        const int radius_idx = (int)radius - 1;
-        if (radius_idx < IM_ARRAYSIZE(_Data->CircleSegmentCounts))
-            num_segments = _Data->CircleSegmentCounts[radius_idx]; // Use cached value
-        else
-            num_segments = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC(radius, _Data->CircleSegmentMaxError);
-    }
-    else
-    {
-        // Explicit segment count (still clamp to avoid drawing insanely tessellated shapes)
-        num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
-    }
+    num_segments = ImDrawList_CalcCircleSegmentCount(_Data, radius, num_segments);
 
-    // Because we are filling a closed shape we remove 1 from the count of segments/points
-    const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
-    if (num_segments == 12)
-        PathArcToFast(center, radius - 0.5f, 0, 12 - 1);
-    else
-        PathArcTo(center, radius - 0.5f, 0.0f, a_max, num_segments - 1);
+    ImDrawList_PathCircle(this, center, radius - 0.5f, num_segments);
     PathStroke(col, true, thickness);
 }
 
@@ -1252,28 +1774,9 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
     if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f)
         return;
 
-    // Obtain segment count
-    if (num_segments <= 0)
-    {
-        // Automatic segment count
-        const int radius_idx = (int)radius - 1;
-        if (radius_idx < IM_ARRAYSIZE(_Data->CircleSegmentCounts))
-            num_segments = _Data->CircleSegmentCounts[radius_idx]; // Use cached value
-        else
-            num_segments = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC(radius, _Data->CircleSegmentMaxError);
-    }
-    else
-    {
-        // Explicit segment count (still clamp to avoid drawing insanely tessellated shapes)
-        num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
-    }
+    num_segments = ImDrawList_CalcCircleSegmentCount(_Data, radius, num_segments);
 
-    // Because we are filling a closed shape we remove 1 from the count of segments/points
-    const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
-    if (num_segments == 12)
-        PathArcToFast(center, radius, 0, 12 - 1);
-    else
-        PathArcTo(center, radius, 0.0f, a_max, num_segments - 1);
+    ImDrawList_PathCircle(this, center, radius, num_segments);
     PathFillConvex(col);
 }
 
@@ -1283,9 +1786,7 @@ void ImDrawList::AddNgon(const ImVec2& center, float radius, ImU32 col, int num_
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
 
-    // Because we are filling a closed shape we remove 1 from the count of segments/points
-    const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
-    PathArcTo(center, radius - 0.5f, 0.0f, a_max, num_segments - 1);
+    ImDrawList_PathCircle(this, center, radius - 0.5f, num_segments);
     PathStroke(col, true, thickness);
 }
 
@@ -1295,9 +1796,7 @@ void ImDrawList::AddNgonFilled(const ImVec2& center, float radius, ImU32 col, in
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
 
-    // Because we are filling a closed shape we remove 1 from the count of segments/points
-    const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
-    PathArcTo(center, radius, 0.0f, a_max, num_segments - 1);
+    ImDrawList_PathCircle(this, center, radius, num_segments);
     PathFillConvex(col);
 }
 
@@ -1312,6 +1811,297 @@ void ImDrawList::AddBezierCurve(const ImVec2& p1, const ImVec2& p2, const ImVec2
     PathStroke(col, false, thickness);
 }
 
+// Quadratic Bezier takes 3 controls points
+void ImDrawList::AddBezierQuadratic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, ImU32 col, float thickness, int num_segments)
+{
+    if ((col & IM_COL32_A_MASK) == 0)
+        return;
+
+    PathLineTo(p1);
+    PathBezierQuadraticCurveTo(p2, p3, num_segments);
+    PathStroke(col, false, thickness);
+}
+
+// Reserve space for up to 'count' primitives of the same size for the batched functions below. With 16-bit indices, reserve fewer
+// of them if needed to stay within the vertex range of the current command: PrimReserve() then moves to a new vertex offset
+// between batches (with ImDrawListFlags_AllowVtxOffset), as it would when drawing one primitive at a time. Return the reserved count.
+static int ImDrawList_PrimReserveBatch(ImDrawList* draw_list, int count, int idx_per_prim, int vtx_per_prim)
+{
+    if (sizeof(ImDrawIdx) == 2)
+    {
+        int fit_count = ((1 << 16) - 1 - (int)draw_list->_VtxCurrentIdx) / vtx_per_prim;
+        if (fit_count <= 0)
+            fit_count = ((1 << 16) - 1) / vtx_per_prim;
+        count = ImMin(count, fit_count);
+    }
+    draw_list->PrimReserve(count * idx_per_prim, count * vtx_per_prim);
+    return count;
+}
+
+// Release the end of the last reservation which wasn't written (skipped transparent primitives, or primitives using less than reserved).
+static void ImDrawList_PrimUnreserveUnwritten(ImDrawList* draw_list)
+{
+    const int idx_unwritten = (int)(draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - draw_list->_IdxWritePtr);
+    const int vtx_unwritten = (int)(draw_list->VtxBuffer.Data + draw_list->VtxBuffer.Size - draw_list->_VtxWritePtr);
+    if (idx_unwritten > 0 || vtx_unwritten > 0)
+        draw_list->PrimUnreserve(idx_unwritten, vtx_unwritten);
+}
+
+void ImDrawList::AddRectsFilled(const ImVec2* p_mins, const ImVec2* p_maxs, const ImU32* cols, int count)
+{
+    for (int n = 0; n < count;)
+    {
+        const int batch_end = n + ImDrawList_PrimReserveBatch(this, count - n, 6, 4);
+        for (; n < batch_end; n++)
+            if (cols[n] & IM_COL32_A_MASK)
+                PrimRect(p_mins[n], p_maxs[n], cols[n]);
+        ImDrawList_PrimUnreserveUnwritten(this);
+    }
+}
+
+// Cells edges are computed with the same expression on both sides, so adjacent cells share them exactly.
+void ImDrawList::AddRectFilledGrid(const ImVec2& p_min, const ImVec2& p_max, int cells_x, int cells_y, const ImU32* cols)
+{
+    if (cells_x <= 0 || cells_y <= 0)
+        return;
+
+    const float cell_w = (p_max.x - p_min.x) / cells_x;
+    const float cell_h = (p_max.y - p_min.y) / cells_y;
+    for (int y = 0; y < cells_y; y++, cols += cells_x)
+    {
+        const float y0 = p_min.y + cell_h * y;
+        const float y1 = (y + 1 == cells_y) ? p_max.y : p_min.y + cell_h * (y + 1);
+        for (int x = 0; x < cells_x;)
+        {
+            const int batch_end = x + ImDrawList_PrimReserveBatch(this, cells_x - x, 6, 4);
+            for (; x < batch_end; x++)
+                if (cols[x] & IM_COL32_A_MASK)
+                {
+                    const float x0 = p_min.x + cell_w * x;
+                    const float x1 = (x + 1 == cells_x) ? p_max.x : p_min.x + cell_w * (x + 1);
+                    PrimRect(ImVec2(x0, y0), ImVec2(x1, y1), cols[x]);
+                }
+            ImDrawList_PrimUnreserveUnwritten(this);
+        }
+    }
+}
+
+// The shape is tessellated once around (0,0) like AddCircleFilled() + AddConvexPolyFilled() do, then copied at each center.
+// With anti-aliasing, fringe positions may differ from AddCircleFilled() in their last bits, as their offsets are computed once.
+void ImDrawList::AddCirclesFilled(const ImVec2* centers, const ImU32* cols, int count, float radius, int num_segments)
+{
+    if (count <= 0 || radius <= 0.0f)
+        return;
+    num_segments = ImDrawList_CalcCircleSegmentCount(_Data, radius, num_segments);
+
+    const int path_size = _Path.Size;
+    ImDrawList_PathCircle(this, ImVec2(0.0f, 0.0f), radius, num_segments);
+    const ImVec2* points = _Path.Data + path_size;
+    const int points_count = _Path.Size - path_size;
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedFill) != 0;
+    const int idx_count = anti_aliased ? (points_count - 2) * 3 + points_count * 6 : (points_count - 2) * 3;
+    const int vtx_count = anti_aliased ? points_count * 2 : points_count;
+    ImVec2* vtx_pos = (ImVec2*)alloca(vtx_count * sizeof(ImVec2)); //-V630
+    unsigned int* idx_offsets = (unsigned int*)alloca(idx_count * sizeof(unsigned int));
+    unsigned int* idx_write = idx_offsets;
+    if (anti_aliased)
+    {
+        // Inner and outer vertex for each point, see AddConvexPolyFilled()
+        const float AA_SIZE = 1.0f;
+        for (int i = 2; i < points_count; i++)
+        {
+            idx_write[0] = 0; idx_write[1] = (i - 1) << 1; idx_write[2] = i << 1;
+            idx_write += 3;
+        }
+        ImVec2* temp_normals = (ImVec2*)alloca(points_count * sizeof(ImVec2)); //-V630
+        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            float dx = points[i1].x - points[i0].x;
+            float dy = points[i1].y - points[i0].y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+            temp_normals[i0].x = dy;
+            temp_normals[i0].y = -dx;
+        }
+        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            float dm_x = (temp_normals[i0].x + temp_normals[i1].x) * 0.5f;
+            float dm_y = (temp_normals[i0].y + temp_normals[i1].y) * 0.5f;
+            IM_FIXNORMAL2F(dm_x, dm_y);
+            dm_x *= AA_SIZE * 0.5f;
+            dm_y *= AA_SIZE * 0.5f;
+            vtx_pos[i1 * 2 + 0] = ImVec2(points[i1].x - dm_x, points[i1].y - dm_y);
+            vtx_pos[i1 * 2 + 1] = ImVec2(points[i1].x + dm_x, points[i1].y + dm_y);
+            idx_write[0] = i1 << 1; idx_write[1] = i0 << 1; idx_write[2] = (i0 << 1) + 1;
+            idx_write[3] = (i0 << 1) + 1; idx_write[4] = (i1 << 1) + 1; idx_write[5] = i1 << 1;
+            idx_write += 6;
+        }
+    }
+    else
+    {
+        for (int i = 0; i < points_count; i++)
+            vtx_pos[i] = points[i];
+        for (int i = 2; i < points_count; i++)
+        {
+            idx_write[0] = 0; idx_write[1] = i - 1; idx_write[2] = i;
+            idx_write += 3;
+        }
+    }
+    _Path.Size = path_size;
+
+    ImDrawVertUV uv;
+    uv = _Data->TexUvWhitePixel;
+    for (int n = 0; n < count;)
+    {
+        const int batch_end = n + ImDrawList_PrimReserveBatch(this, count - n, idx_count, vtx_count);
+        for (; n < batch_end; n++)
+        {
+            const ImU32 col = cols[n];
+            if ((col & IM_COL32_A_MASK) == 0)
+                continue;
+            const ImU32 col_outer = anti_aliased ? (col & ~IM_COL32_A_MASK) : col;
+            const ImVec2 center = centers[n];
+            ImDrawVert* vtx_write = _VtxWritePtr;
+            int v = 0;
+            for (; v + 1 < vtx_count; v += 2, vtx_write += 2)
+            {
+                ImDrawVertWritePos2(&vtx_write[0], &vtx_write[1], center.x + vtx_pos[v].x, center.y + vtx_pos[v].y, center.x + vtx_pos[v + 1].x, center.y + vtx_pos[v + 1].y);
+                vtx_write[0].uv = uv; vtx_write[0].col = col;
+                vtx_write[1].uv = uv; vtx_write[1].col = col_outer;
+            }
+            if (v < vtx_count)
+            {
+                vtx_write[0].pos = ImVec2(center.x + vtx_pos[v].x, center.y + vtx_pos[v].y);
+                vtx_write[0].uv = uv; vtx_write[0].col = col;
+            }
+            for (int i = 0; i < idx_count; i++)
+                _IdxWritePtr[i] = (ImDrawIdx)(_VtxCurrentIdx + idx_offsets[i]);
+            _VtxWritePtr += vtx_count;
+            _IdxWritePtr += idx_count;
+            _VtxCurrentIdx += vtx_count;
+        }
+        ImDrawList_PrimUnreserveUnwritten(this);
+    }
+}
+
+// Each segment is written as AddLine() would, using the helpers of AddPolyline() for a 2 points line.
+void ImDrawList::AddLines(const ImVec2* points, const ImU32* cols, int count, float thickness)
+{
+    if (count <= 0)
+        return;
+
+    // Setup the vertices and indices of one segment, see AddPolyline()
+    const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedLines) != 0;
+    const bool thick_line = (thickness > 1.0f);
+    const float stroke_thickness = anti_aliased ? ImMax(thickness, 1.0f) : thickness;
+    const int integer_thickness = (int)stroke_thickness;
+    const float fractional_thickness = stroke_thickness - integer_thickness;
+    const bool use_texture = anti_aliased && (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f);
+    const bool pixel_aligned_rects = ImDrawListIsOddIntegerThickness(thickness);
+    const float half_out = (thickness - 1.0f) * 0.5f;
+    int vtx_per_point = 2;
+    float offsets[4];
+    ImVec2 uvs[4] = { opaque_uv, opaque_uv, opaque_uv, opaque_uv };
+    bool col_is_opaque[4] = { true, true, true, true };
+    static const unsigned int idx_tex[6] = { 2, 0, 1, 3, 1, 2 };
+    static const unsigned int idx_thin[12] = { 3, 0, 2, 2, 5, 3, 4, 1, 0, 0, 3, 4 };
+    static const unsigned int idx_thick[18] = { 5, 1, 2, 2, 6, 5, 5, 1, 0, 0, 4, 5, 6, 2, 3, 3, 7, 6 };
+    const unsigned int* idx_offsets = NULL;
+    int idx_count = 6;
+    if (use_texture)
+    {
+        ImVec4 tex_uvs = _Data->TexUvLines[integer_thickness];
+        if (fractional_thickness != 0.0f)
+        {
+            const ImVec4 tex_uvs_1 = _Data->TexUvLines[integer_thickness + 1];
+            tex_uvs.x = tex_uvs.x + (tex_uvs_1.x - tex_uvs.x) * fractional_thickness; // inlined ImLerp()
+            tex_uvs.y = tex_uvs.y + (tex_uvs_1.y - tex_uvs.y) * fractional_thickness;
+            tex_uvs.z = tex_uvs.z + (tex_uvs_1.z - tex_uvs.z) * fractional_thickness;
+            tex_uvs.w = tex_uvs.w + (tex_uvs_1.w - tex_uvs.w) * fractional_thickness;
+        }
+        const float half_draw_size = (stroke_thickness * 0.5f) + 1;
+        offsets[0] = half_draw_size; offsets[1] = -half_draw_size;
+        uvs[0] = ImVec2(tex_uvs.x, tex_uvs.y); uvs[1] = ImVec2(tex_uvs.z, tex_uvs.w);
+        idx_offsets = idx_tex;
+    }
+    else if (anti_aliased && !thick_line)
+    {
+        const float AA_SIZE = 1.0f;
+        vtx_per_point = 3;
+        offsets[0] = 0.0f; offsets[1] = AA_SIZE; offsets[2] = -AA_SIZE;
+        col_is_opaque[1] = col_is_opaque[2] = false;
+        idx_offsets = idx_thin;
+        idx_count = 12;
+    }
+    else if (anti_aliased)
+    {
+        const float AA_SIZE = 1.0f;
+        const float half_inner_thickness = (stroke_thickness - AA_SIZE) * 0.5f;
+        vtx_per_point = 4;
+        offsets[0] = half_inner_thickness + AA_SIZE; offsets[1] = half_inner_thickness; offsets[2] = -half_inner_thickness; offsets[3] = -(half_inner_thickness + AA_SIZE);
+        col_is_opaque[0] = col_is_opaque[3] = false;
+        idx_offsets = idx_thick;
+        idx_count = 18;
+    }
+    const int vtx_count = anti_aliased ? vtx_per_point * 2 : 4;
+
+    ImDrawVertUV vtx_uv;
+    vtx_uv = opaque_uv;
+    for (int n = 0; n < count;)
+    {
+        const int batch_end = n + ImDrawList_PrimReserveBatch(this, count - n, idx_count, vtx_count);
+        for (; n < batch_end; n++)
+        {
+            const ImU32 col = cols[n];
+            if ((col & IM_COL32_A_MASK) == 0)
+                continue;
+            const ImVec2& p1 = points[n * 2 + 0];
+            const ImVec2& p2 = points[n * 2 + 1];
+            if (pixel_aligned_rects && p1.y == p2.y && ImDrawListIsPixelAligned(p1.y))
+            {
+                PrimRect(ImVec2(ImMin(p1.x, p2.x) + 0.5f, p1.y - half_out), ImVec2(ImMax(p1.x, p2.x) + 0.5f, p1.y + 1.0f + half_out), col);
+                continue;
+            }
+            if (pixel_aligned_rects && p1.x == p2.x && ImDrawListIsPixelAligned(p1.x))
+            {
+                PrimRect(ImVec2(p1.x - half_out, ImMin(p1.y, p2.y) + 0.5f), ImVec2(p1.x + 1.0f + half_out, ImMax(p1.y, p2.y) + 0.5f), col);
+                continue;
+            }
+
+            const ImVec2 line_points[2] = { ImVec2(p1.x + 0.5f, p1.y + 0.5f), ImVec2(p2.x + 0.5f, p2.y + 0.5f) };
+            if (anti_aliased)
+            {
+                ImVec2 miters[2];
+                ImPolylineComputeNormals(line_points, 2, false, miters);
+                ImPolylineComputeMiters(miters, 2, false);
+                const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+                const ImU32 vtx_cols[4] = { col_is_opaque[0] ? col : col_trans, col_is_opaque[1] ? col : col_trans, col_is_opaque[2] ? col : col_trans, col_is_opaque[3] ? col : col_trans };
+                ImPolylineWriteVertices(_VtxWritePtr, line_points, miters, 2, vtx_per_point, offsets, uvs, vtx_cols);
+                for (int i = 0; i < idx_count; i++)
+                    _IdxWritePtr[i] = (ImDrawIdx)(_VtxCurrentIdx + idx_offsets[i]);
+            }
+            else
+            {
+                float dx = line_points[1].x - line_points[0].x;
+                float dy = line_points[1].y - line_points[0].y;
+                IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+                dx *= (thickness * 0.5f);
+                dy *= (thickness * 0.5f);
+                _VtxWritePtr[0].pos.x = line_points[0].x + dy; _VtxWritePtr[0].pos.y = line_points[0].y - dx; _VtxWritePtr[0].uv = vtx_uv; _VtxWritePtr[0].col = col;
+                _VtxWritePtr[1].pos.x = line_points[1].x + dy; _VtxWritePtr[1].pos.y = line_points[1].y - dx; _VtxWritePtr[1].uv = vtx_uv; _VtxWritePtr[1].col = col;
+                _VtxWritePtr[2].pos.x = line_points[1].x - dy; _VtxWritePtr[2].pos.y = line_points[1].y + dx; _VtxWritePtr[2].uv = vtx_uv; _VtxWritePtr[2].col = col;
+                _VtxWritePtr[3].pos.x = line_points[0].x - dy; _VtxWritePtr[3].pos.y = line_points[0].y + dx; _VtxWritePtr[3].uv = vtx_uv; _VtxWritePtr[3].col = col;
+                _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + 1); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + 2);
+                _IdxWritePtr[3] = (ImDrawIdx)(_VtxCurrentIdx); _IdxWritePtr[4] = (ImDrawIdx)(_VtxCurrentIdx + 2); _IdxWritePtr[5] = (ImDrawIdx)(_VtxCurrentIdx + 3);
+            }
+            _VtxWritePtr += vtx_count;
+            _IdxWritePtr += idx_count;
+            _VtxCurrentIdx += vtx_count;
+        }
+        ImDrawList_PrimUnreserveUnwritten(this);
+    }
+}
+
 void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end, float wrap_width, const ImVec4* cpu_fine_clip_rect)
 {
     if ((col & IM_COL32_A_MASK) == 0)
@@ -1416,12 +2206,15 @@ void ImDrawListSplitter::ClearFreeMemory()
     {
         if (i == _Current)
             memset(&_Channels[i], 0, sizeof(_Channels[i]));  // Current channel is a copy of CmdBuffer/IdxBuffer, don't destruct again
+        else if (_Channels[i]._IdxBorrowed)
+            memset(&_Channels[i]._IdxBuffer, 0, sizeof(_Channels[i]._IdxBuffer)); // Range of _IdxStorage
         _Channels[i]._CmdBuffer.clear();
         _Channels[i]._IdxBuffer.clear();
     }
     _Current = 0;
     _Count = 1;
     _Channels.clear();
+    _IdxStorage.clear();
 }
 
 void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
@@ -1435,18 +2228,24 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
     // Channels[] (24/32 bytes each) hold storage that we'll swap with draw_list->_CmdBuffer/_IdxBuffer
     // The content of Channels[0] at this point doesn't matter. We clear it to make state tidy in a debugger but we don't strictly need to.
     // When we switch to the next channel, we'll copy draw_list->_CmdBuffer/_IdxBuffer into Channels[0] and then Channels[1] into draw_list->CmdBuffer/_IdxBuffer
+    const int idx_growth_0 = (old_channels_count > 0) ? _Channels[0]._IdxGrowth : 0;
     memset(&_Channels[0], 0, sizeof(ImDrawChannel));
+    _Channels[0]._IdxGrowth = idx_growth_0;
+    _Channels[0]._CmdClipTest = _Channels[0]._CmdFirstClipTest = ImDrawCmdClipTest();
     for (int i = 1; i < channels_count; i++)
     {
         if (i >= old_channels_count)
         {
             IM_PLACEMENT_NEW(&_Channels[i]) ImDrawChannel();
+            _Channels[i]._IdxGrowth = 0;
+            _Channels[i]._IdxBorrowed = false;
         }
         else
         {
             _Channels[i]._CmdBuffer.resize(0);
             _Channels[i]._IdxBuffer.resize(0);
         }
+        _Channels[i]._CmdClipTest = _Channels[i]._CmdFirstClipTest = ImDrawCmdClipTest();
         if (_Channels[i]._CmdBuffer.Size == 0)
         {
             ImDrawCmd draw_cmd;
@@ -1454,6 +2253,109 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
             _Channels[i]._CmdBuffer.push_back(draw_cmd);
         }
     }
+
+    _SplitTextureId = draw_list->_CmdHeader.TextureId;
+
+    // Write indices in place: channel 0 keeps writing into the draw list index buffer, other channels each get a range of _IdxStorage, sized
+    // after the number of indices they received the previous time. The start of _IdxStorage is reserved for the indices of channel 0, so that
+    // Merge() can copy them there and swap buffers, rather than copying all other channels when channel 0 is the smallest.
+    // A channel outgrowing its range moves to its own allocation (see ImDrawList::_SpillIdxBuffer()) and gets copied by Merge().
+    // Not possible when the draw list index buffer is itself a range of another splitter.
+    _IdxSplitSize = -1;
+    if (channels_count <= 1 || draw_list->_IdxBorrowed)
+        return;
+    _IdxSplitSize = draw_list->IdxBuffer.Size;
+    int idx_offset = _IdxSplitSize + _Channels[0]._IdxGrowth;
+    int idx_storage_size = idx_offset;
+    for (int i = 1; i < channels_count; i++)
+        idx_storage_size += _Channels[i]._IdxGrowth;
+    _IdxStorage.resize(idx_storage_size);
+    for (int i = 1; i < channels_count; i++)
+    {
+        ImDrawChannel& ch = _Channels[i];
+        ch._IdxBuffer.clear(); // Own allocation of a channel which outgrew its range
+        ch._IdxBuffer.Data = _IdxStorage.Data + idx_offset;
+        ch._IdxBuffer.Size = 0;
+        ch._IdxBuffer.Capacity = ch._IdxGrowth;
+        ch._IdxBorrowed = true;
+        idx_offset += ch._IdxGrowth;
+    }
+}
+
+// Append indices of channels 1+ to the draw list index buffer.
+static void ImDrawListSplitter_MergeIdxCopy(ImDrawListSplitter* splitter, ImDrawList* draw_list, int new_idx_buffer_count)
+{
+    ImVector<ImDrawChannel>& channels = splitter->_Channels;
+    if (draw_list->_IdxBorrowed && draw_list->IdxBuffer.Size + new_idx_buffer_count > draw_list->IdxBuffer.Capacity)
+        draw_list->_SpillIdxBuffer(draw_list->IdxBuffer.Size + new_idx_buffer_count);
+    draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
+    ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
+    for (int i = 1; i < splitter->_Count; i++)
+    {
+        ImDrawChannel& ch = channels[i];
+        if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
+    }
+    draw_list->_IdxWritePtr = idx_write;
+}
+
+// Copy indices of channel 0 to the start of _IdxStorage, move ranges written in place by channels 1+ right after them, and swap buffers.
+// Ranges don't move when channel 0 and every other channel filled their range exactly. Channels which outgrew their range are copied last.
+static void ImDrawListSplitter_MergeIdxSwap(ImDrawListSplitter* splitter, ImDrawList* draw_list, int new_idx_buffer_count)
+{
+    ImVector<ImDrawChannel>& channels = splitter->_Channels;
+    ImVector<ImDrawIdx>& idx_buffer = splitter->_IdxStorage;
+    const int idx_count_0 = draw_list->IdxBuffer.Size;
+    const int idx_count = idx_count_0 + new_idx_buffer_count;
+    for (int i = 1; i < splitter->_Count; i++)
+        if (channels[i]._IdxBorrowed)
+            channels[i]._IdxGrowth = (int)(channels[i]._IdxBuffer.Data - idx_buffer.Data); // Temporarily store the source offset, restored below
+    if (idx_count > idx_buffer.Size)
+        idx_buffer.resize(idx_count);
+    if (idx_count_0 > 0)
+        memcpy(idx_buffer.Data, draw_list->IdxBuffer.Data, (size_t)idx_count_0 * sizeof(ImDrawIdx)); // Range reserved for channel 0, can't overlap others
+
+    // Ranges moving down are moved first in increasing order, then ranges moving up in decreasing order: a range never overwrites one
+    // which hasn't moved yet. Ranges in the right place already (the common case) are left untouched.
+    int dst_offset = idx_count_0;
+    for (int i = 1; i < splitter->_Count; i++)
+    {
+        const ImDrawChannel& ch = channels[i];
+        if (ch._IdxBorrowed && dst_offset < ch._IdxGrowth)
+            memmove(idx_buffer.Data + dst_offset, idx_buffer.Data + ch._IdxGrowth, (size_t)ch._IdxBuffer.Size * sizeof(ImDrawIdx));
+        dst_offset += ch._IdxBuffer.Size;
+    }
+    for (int i = splitter->_Count - 1; i >= 1; i--)
+    {
+        const ImDrawChannel& ch = channels[i];
+        dst_offset -= ch._IdxBuffer.Size;
+        if (ch._IdxBorrowed && dst_offset > ch._IdxGrowth)
+            memmove(idx_buffer.Data + dst_offset, idx_buffer.Data + ch._IdxGrowth, (size_t)ch._IdxBuffer.Size * sizeof(ImDrawIdx));
+    }
+    for (int i = 1; i < splitter->_Count; i++)
+    {
+        ImDrawChannel& ch = channels[i];
+        if (!ch._IdxBorrowed && ch._IdxBuffer.Size > 0)
+            memcpy(idx_buffer.Data + dst_offset, ch._IdxBuffer.Data, (size_t)ch._IdxBuffer.Size * sizeof(ImDrawIdx));
+        dst_offset += ch._IdxBuffer.Size;
+        ch._IdxGrowth = ch._IdxBuffer.Size;
+    }
+    idx_buffer.resize(idx_count);
+    draw_list->IdxBuffer.swap(idx_buffer); // The previous draw list buffer becomes _IdxStorage for the next Split()
+    draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + idx_count;
+}
+
+// Test whether the first and last commands of the current channel are unclipped, while its indices are likely still in cache: Merge() needs
+// to know to merge them with neighbor channels across clip rectangles. Only done for commands using the texture the draw list had when
+// splitting (typically the font atlas, shared by most channels), other commands are rarely mergeable and are tested by Merge() if needed.
+static void ImDrawListSplitter_TestChannelBoundaries(ImDrawListSplitter* splitter, ImDrawList* draw_list)
+{
+    const int last_n = (draw_list->CmdBuffer.Size > 1 && draw_list->CmdBuffer.back().ElemCount == 0) ? draw_list->CmdBuffer.Size - 2 : draw_list->CmdBuffer.Size - 1; // Merge() removes a trailing empty command
+    const ImDrawCmd* first_cmd = &draw_list->CmdBuffer.Data[0];
+    const ImDrawCmd* last_cmd = &draw_list->CmdBuffer.Data[last_n];
+    if ((splitter->_Current < splitter->_Count - 1 || last_n == 0) && last_cmd->UserCallback == NULL && last_cmd->TextureId == splitter->_SplitTextureId)
+        ImDrawCmd_IsUnclippedCached(&draw_list->_CmdClipTest, last_n, last_cmd, draw_list->IdxBuffer.Data + last_cmd->IdxOffset, draw_list->VtxBuffer.Data);
+    if (splitter->_Current > 0 && last_n > 0 && first_cmd->UserCallback == NULL && first_cmd->TextureId == splitter->_SplitTextureId)
+        ImDrawCmd_IsUnclippedCached(&splitter->_Channels[splitter->_Current]._CmdFirstClipTest, 0, first_cmd, draw_list->IdxBuffer.Data + first_cmd->IdxOffset, draw_list->VtxBuffer.Data);
 }
 
 void ImDrawListSplitter::Merge(ImDrawList* draw_list)
@@ -1462,6 +2364,8 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     if (_Count <= 1)
         return;
 
+    // Write deferred primitives of the current channel before reading back vertices (SetCurrentChannel() only does it when switching)
+    draw_list->_FlushDeferredPrims();
     SetCurrentChannel(draw_list, 0);
     draw_list->_PopUnusedDrawCmd();
 
@@ -1469,6 +2373,10 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
     ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
+    const ImDrawIdx* last_cmd_idx = last_cmd ? draw_list->IdxBuffer.Data + last_cmd->IdxOffset : NULL;
+    ImDrawCmdClipTest* last_cmd_test = &draw_list->_CmdClipTest;
+    int last_cmd_n = draw_list->CmdBuffer.Size - 1;
+    int last_cmd_unclipped = -1; // -1: not known yet, only tested when needed (usually cached by SetCurrentChannel())
     int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
     for (int i = 1; i < _Count; i++)
     {
@@ -1487,10 +2395,34 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
                 last_cmd->ElemCount += next_cmd->ElemCount;
                 idx_offset += next_cmd->ElemCount;
                 ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
+                ch._CmdClipTest.CmdIdx--;
+                last_cmd_unclipped = 0;
+            }
+            else if (ImDrawCmd_CanMergeAcrossClipRects(last_cmd, next_cmd))
+            {
+                // Same when neither command rely on clipping (e.g. non-overflowing columns). See ImDrawList::_TryMergeDrawCmds().
+                if (last_cmd_unclipped == -1)
+                    last_cmd_unclipped = ImDrawCmd_IsUnclippedCached(last_cmd_test, last_cmd_n, last_cmd, last_cmd_idx, draw_list->VtxBuffer.Data) ? 1 : 0;
+                ImDrawCmdClipTest* next_cmd_test = (ch._CmdClipTest.CmdIdx == 0) ? &ch._CmdClipTest : &ch._CmdFirstClipTest;
+                if (last_cmd_unclipped == 1 && ImDrawCmd_IsUnclippedCached(next_cmd_test, 0, next_cmd, ch._IdxBuffer.Data + next_cmd->IdxOffset, draw_list->VtxBuffer.Data))
+                {
+                    last_cmd->ClipRect = ImDrawCmd_ClipRectUnion(last_cmd->ClipRect, next_cmd->ClipRect);
+                    last_cmd->ElemCount += next_cmd->ElemCount;
+                    idx_offset += next_cmd->ElemCount;
+                    ch._CmdBuffer.erase(ch._CmdBuffer.Data);
+                    ch._CmdClipTest.CmdIdx--;
+                    draw_list->_CmdMergedCount++;
+                }
             }
         }
         if (ch._CmdBuffer.Size > 0)
+        {
             last_cmd = &ch._CmdBuffer.back();
+            last_cmd_idx = ch._IdxBuffer.Data + last_cmd->IdxOffset; // Before IdxOffset is fixed below
+            last_cmd_test = &ch._CmdClipTest;
+            last_cmd_n = ch._CmdBuffer.Size - 1;
+            last_cmd_unclipped = -1;
+        }
         new_cmd_buffer_count += ch._CmdBuffer.Size;
         new_idx_buffer_count += ch._IdxBuffer.Size;
         for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
@@ -1499,19 +2431,39 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
             idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
         }
     }
-    draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
-    draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
 
-    // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
+    // Write commands in order (they are fairly small structures)
+    draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
     ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
-    ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
         if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
-        if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
     }
-    draw_list->_IdxWritePtr = idx_write;
+
+    // Write indices in order
+    if (_IdxSplitSize >= 0)
+    {
+        // Swap buffers when indices of channel 0 fit the range reserved for them and are fewer than those of other channels, else append the latter
+        const int idx_count_0 = draw_list->IdxBuffer.Size;
+        const bool swap_buffers = (idx_count_0 <= _IdxSplitSize + _Channels[0]._IdxGrowth && idx_count_0 <= new_idx_buffer_count);
+        for (int i = 0; i < _Count; i++)
+            _Channels[i]._IdxGrowth = ((i == 0) ? idx_count_0 - _IdxSplitSize : _Channels[i]._IdxBuffer.Size);
+        if (swap_buffers)
+            ImDrawListSplitter_MergeIdxSwap(this, draw_list, new_idx_buffer_count);
+        else
+            ImDrawListSplitter_MergeIdxCopy(this, draw_list, new_idx_buffer_count);
+        for (int i = 1; i < _Count; i++)
+            if (_Channels[i]._IdxBorrowed)
+            {
+                memset(&_Channels[i]._IdxBuffer, 0, sizeof(_Channels[i]._IdxBuffer));
+                _Channels[i]._IdxBorrowed = false;
+            }
+    }
+    else
+    {
+        ImDrawListSplitter_MergeIdxCopy(this, draw_list, new_idx_buffer_count);
+    }
 
     // Ensure there's always a non-callback draw command trailing the command-buffer
     if (draw_list->CmdBuffer.Size == 0 || draw_list->CmdBuffer.back().UserCallback != NULL)
@@ -1524,6 +2476,7 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
         draw_list->AddDrawCmd();
 
+    draw_list->_CmdClipTest = ImDrawCmdClipTest();
     _Count = 1;
 }
 
@@ -1533,13 +2486,21 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
     if (_Current == idx)
         return;
 
+    // Deferred primitives keep offsets into the current IdxBuffer
+    draw_list->_FlushDeferredPrims();
+    ImDrawListSplitter_TestChannelBoundaries(this, draw_list);
+
     // Overwrite ImVector (12/16 bytes), four times. This is merely a silly optimization instead of doing .swap()
     memcpy(&_Channels.Data[_Current]._CmdBuffer, &draw_list->CmdBuffer, sizeof(draw_list->CmdBuffer));
     memcpy(&_Channels.Data[_Current]._IdxBuffer, &draw_list->IdxBuffer, sizeof(draw_list->IdxBuffer));
+    _Channels.Data[_Current]._IdxBorrowed = draw_list->_IdxBorrowed;
+    _Channels.Data[_Current]._CmdClipTest = draw_list->_CmdClipTest;
     _Current = idx;
     memcpy(&draw_list->CmdBuffer, &_Channels.Data[idx]._CmdBuffer, sizeof(draw_list->CmdBuffer));
     memcpy(&draw_list->IdxBuffer, &_Channels.Data[idx]._IdxBuffer, sizeof(draw_list->IdxBuffer));
+    draw_list->_IdxBorrowed = _Channels.Data[idx]._IdxBorrowed;
     draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
+    draw_list->_CmdClipTest = _Channels.Data[idx]._CmdClipTest;
 
     // If current command is used with different settings we need to add a new command
     ImDrawCmd* curr_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
@@ -1564,8 +2525,19 @@ void ImDrawData::DeIndexAllBuffers()
         if (cmd_list->IdxBuffer.empty())
             continue;
         new_vtx_buffer.resize(cmd_list->IdxBuffer.Size);
-        for (int j = 0; j < cmd_list->IdxBuffer.Size; j++)
-            new_vtx_buffer[j] = cmd_list->VtxBuffer[cmd_list->IdxBuffer[j]];
+        ImDrawVert* vtx_write = new_vtx_buffer.Data;
+        const ImDrawVert* vtx_read = cmd_list->VtxBuffer.Data;
+        const ImDrawIdx* idx_read = cmd_list->IdxBuffer.Data;
+        const ImDrawIdx* idx_end = idx_read + cmd_list->IdxBuffer.Size;
+        for (; idx_read + 4 <= idx_end; idx_read += 4, vtx_write += 4)
+        {
+            vtx_write[0] = vtx_read[idx_read[0]];
+            vtx_write[1] = vtx_read[idx_read[1]];
+            vtx_write[2] = vtx_read[idx_read[2]];
+            vtx_write[3] = vtx_read[idx_read[3]];
+        }
+        for (; idx_read < idx_end; idx_read++)
+            *vtx_write++ = vtx_read[*idx_read];
         cmd_list->VtxBuffer.swap(new_vtx_buffer);
         cmd_list->IdxBuffer.resize(0);
         TotalVtxCount += cmd_list->VtxBuffer.Size;
@@ -1577,15 +2549,141 @@ void ImDrawData::DeIndexAllBuffers()
 // or if there is a difference between your window resolution and framebuffer resolution.
 void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
 {
+#if defined(IMGUI_ENABLE_SSE)
+    const __m128 scale = _mm_setr_ps(fb_scale.x, fb_scale.y, fb_scale.x, fb_scale.y);
+#endif
     for (int i = 0; i < CmdListsCount; i++)
     {
         ImDrawList* cmd_list = CmdLists[i];
-        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        for (ImDrawCmd* cmd = cmd_list->CmdBuffer.Data, *cmd_end = cmd + cmd_list->CmdBuffer.Size; cmd < cmd_end; cmd++)
         {
-            ImDrawCmd* cmd = &cmd_list->CmdBuffer[cmd_i];
+#if defined(IMGUI_ENABLE_SSE)
+            _mm_storeu_ps(&cmd->ClipRect.x, _mm_mul_ps(_mm_loadu_ps(&cmd->ClipRect.x), scale));
+#else
             cmd->ClipRect = ImVec4(cmd->ClipRect.x * fb_scale.x, cmd->ClipRect.y * fb_scale.y, cmd->ClipRect.z * fb_scale.x, cmd->ClipRect.w * fb_scale.y);
+#endif
+        }
+    }
+}
+
+ImDrawDataSnapshotRing::ImDrawDataSnapshotRing(int snapshot_count)
+{
+    IM_ASSERT(snapshot_count >= 1);
+    Snapshots.resize(snapshot_count);
+    for (int n = 0; n < snapshot_count; n++)
+        Snapshots[n] = IM_NEW(ImDrawDataSnapshot)();
+    NextIndex = SnapCount = 0;
+}
+
+ImDrawDataSnapshotRing::~ImDrawDataSnapshotRing()
+{
+    for (int n = 0; n < Snapshots.Size; n++)
+        IM_DELETE(Snapshots[n]);
+    Snapshots.clear();
+}
+
+void ImDrawDataSnapshotRing::ClearFreeMemory()
+{
+    for (int n = 0; n < Snapshots.Size; n++)
+        Snapshots[n]->ClearFreeMemory();
+}
+
+void ImDrawDataSnapshot::ClearFreeMemory()
+{
+    DrawData.Clear();
+    for (int n = 0; n < Lists.Size; n++)
+        IM_DELETE(Lists[n]);
+    CmdLists.clear();
+    Lists.clear();
+    ListsSource.clear();
+    ListsLastSnap.clear();
+    ListsMap.Clear();
+}
+
+// Draw lists of a snapshot whose source draw list hasn't been snapped during that many calls to Snap() are released.
+static const int DRAWDATA_SNAPSHOT_RELEASE_AFTER_SNAPS = 120;
+
+ImDrawData* ImDrawDataSnapshotRing::Snap(ImDrawData* src)
+{
+    IM_ASSERT(src->Valid);
+    ImDrawDataSnapshot* snap = Snapshots[NextIndex];
+    NextIndex = (NextIndex + 1) % Snapshots.Size;
+    SnapCount++;
+
+    snap->CmdLists.resize(0);
+    for (int n = 0; n < src->CmdListsCount; n++)
+    {
+        ImDrawList* src_list = src->CmdLists[n];
+        IM_ASSERT(src_list->_DeferredPrims.Size == 0 && "Call _FlushDeferredPrims() first!");
+
+        // Find the draw list which received the buffers of this source draw list last time
+        const ImGuiID key = ImHashData(&src_list, sizeof(src_list));
+        int list_idx = snap->ListsMap.GetInt(key, 0) - 1;
+        if (list_idx < 0 || snap->ListsSource[list_idx] != src_list)
+        {
+            list_idx = snap->Lists.Size;
+            snap->Lists.push_back(IM_NEW(ImDrawList)(src_list->_Data));
+            snap->ListsSource.push_back(src_list);
+            snap->ListsLastSnap.push_back(0);
+            snap->ListsMap.SetInt(key, list_idx + 1);
+        }
+        ImDrawList* dst_list = snap->Lists[list_idx];
+
+        if (src_list->Flags & ImDrawListFlags_RetainContents)
+        {
+            // Copy, reusing our capacity (ImVector<>::operator= would free it)
+            dst_list->CmdBuffer.resize(src_list->CmdBuffer.Size);
+            dst_list->IdxBuffer.resize(src_list->IdxBuffer.Size);
+            dst_list->VtxBuffer.resize(src_list->VtxBuffer.Size);
+            memcpy(dst_list->CmdBuffer.Data, src_list->CmdBuffer.Data, (size_t)src_list->CmdBuffer.size_in_bytes());
+            memcpy(dst_list->IdxBuffer.Data, src_list->IdxBuffer.Data, (size_t)src_list->IdxBuffer.size_in_bytes());
+            memcpy(dst_list->VtxBuffer.Data, src_list->VtxBuffer.Data, (size_t)src_list->VtxBuffer.size_in_bytes());
+        }
+        else
+        {
+            // Swap: the source draw list gets the buffers of the snapshot taken Snapshots.Size calls ago
+            dst_list->CmdBuffer.swap(src_list->CmdBuffer);
+            dst_list->IdxBuffer.swap(src_list->IdxBuffer);
+            dst_list->VtxBuffer.swap(src_list->VtxBuffer);
+            src_list->CmdBuffer.resize(0);
+            src_list->IdxBuffer.resize(0);
+            src_list->VtxBuffer.resize(0);
+            src_list->_VtxWritePtr = NULL;
+            src_list->_IdxWritePtr = NULL;
+        }
+        dst_list->Flags = src_list->Flags;
+        dst_list->_OwnerName = src_list->_OwnerName;
+        snap->ListsLastSnap[list_idx] = SnapCount;
+        snap->CmdLists.push_back(dst_list);
+    }
+
+    // Release draw lists not used for a while (e.g. closed windows)
+    bool released = false;
+    for (int list_idx = 0; list_idx < snap->Lists.Size; list_idx++)
+        if (SnapCount - snap->ListsLastSnap[list_idx] > DRAWDATA_SNAPSHOT_RELEASE_AFTER_SNAPS)
+        {
+            IM_DELETE(snap->Lists[list_idx]);
+            snap->Lists.erase(snap->Lists.Data + list_idx);
+            snap->ListsSource.erase(snap->ListsSource.Data + list_idx);
+            snap->ListsLastSnap.erase(snap->ListsLastSnap.Data + list_idx);
+            list_idx--;
+            released = true;
         }
+    if (released)
+    {
+        snap->ListsMap.Clear();
+        for (int list_idx = 0; list_idx < snap->Lists.Size; list_idx++)
+            snap->ListsMap.SetInt(ImHashData(&snap->ListsSource[list_idx], sizeof(ImDrawList*)), list_idx + 1);
     }
+
+    snap->DirtyRects.resize(src->DirtyRectsCount);
+    if (src->DirtyRectsCount > 0)
+        memcpy(snap->DirtyRects.Data, src->DirtyRects, (size_t)src->DirtyRectsCount * sizeof(ImVec4));
+    snap->DrawData = *src;
+    snap->DrawData.CmdLists = snap->CmdLists.Data;
+    snap->DrawData.DirtyRects = snap->DirtyRects.Data;
+    src->Valid = false;
+    return &snap->DrawData;
 }
 
 //-----------------------------------------------------------------------------
@@ -1595,6 +2693,7 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
 // Generic linear color gradient, write to RGB fields, leave A untouched.
 void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1)
 {
+    draw_list->_FlushDeferredPrims();
     ImVec2 gradient_extent = gradient_p1 - gradient_p0;
     float gradient_inv_length2 = 1.0f / ImLengthSqr(gradient_extent);
     ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
@@ -1605,7 +2704,36 @@ void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int ve
     const int col_delta_r = ((int)(col1 >> IM_COL32_R_SHIFT) & 0xFF) - col0_r;
     const int col_delta_g = ((int)(col1 >> IM_COL32_G_SHIFT) & 0xFF) - col0_g;
     const int col_delta_b = ((int)(col1 >> IM_COL32_B_SHIFT) & 0xFF) - col0_b;
-    for (ImDrawVert* vert = vert_start; vert < vert_end; vert++)
+    ImDrawVert* vert = vert_start;
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
+    // Four vertices at a time, same operations and rounding as the scalar loop below (ImClamp() maps to max/min with this operand order)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 p0_x = _mm_set1_ps(gradient_p0.x), p0_y = _mm_set1_ps(gradient_p0.y);
+    const __m128 extent_x = _mm_set1_ps(gradient_extent.x), extent_y = _mm_set1_ps(gradient_extent.y);
+    const __m128 inv_length2 = _mm_set1_ps(gradient_inv_length2);
+    const __m128 col0_r4 = _mm_set1_ps((float)col0_r), col0_g4 = _mm_set1_ps((float)col0_g), col0_b4 = _mm_set1_ps((float)col0_b);
+    const __m128 col_delta_r4 = _mm_set1_ps((float)col_delta_r), col_delta_g4 = _mm_set1_ps((float)col_delta_g), col_delta_b4 = _mm_set1_ps((float)col_delta_b);
+    for (; vert + 4 <= vert_end; vert += 4)
+    {
+        const __m128 p01 = _mm_loadh_pi(_mm_loadl_pi(zero, (const __m64*)(const void*)&vert[0].pos), (const __m64*)(const void*)&vert[1].pos);
+        const __m128 p23 = _mm_loadh_pi(_mm_loadl_pi(zero, (const __m64*)(const void*)&vert[2].pos), (const __m64*)(const void*)&vert[3].pos);
+        const __m128 x = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 y = _mm_shuffle_ps(p01, p23, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m128 d = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(x, p0_x), extent_x), _mm_mul_ps(_mm_sub_ps(y, p0_y), extent_y));
+        const __m128 t = _mm_min_ps(one, _mm_max_ps(zero, _mm_mul_ps(d, inv_length2)));
+        const __m128i r = _mm_cvttps_epi32(_mm_add_ps(col0_r4, _mm_mul_ps(col_delta_r4, t)));
+        const __m128i g = _mm_cvttps_epi32(_mm_add_ps(col0_g4, _mm_mul_ps(col_delta_g4, t)));
+        const __m128i b = _mm_cvttps_epi32(_mm_add_ps(col0_b4, _mm_mul_ps(col_delta_b4, t)));
+        ImU32 cols[4];
+        _mm_storeu_si128((__m128i*)(void*)cols, _mm_or_si128(_mm_slli_epi32(r, IM_COL32_R_SHIFT), _mm_or_si128(_mm_slli_epi32(g, IM_COL32_G_SHIFT), _mm_slli_epi32(b, IM_COL32_B_SHIFT))));
+        vert[0].col = cols[0] | (vert[0].col & IM_COL32_A_MASK);
+        vert[1].col = cols[1] | (vert[1].col & IM_COL32_A_MASK);
+        vert[2].col = cols[2] | (vert[2].col & IM_COL32_A_MASK);
+        vert[3].col = cols[3] | (vert[3].col & IM_COL32_A_MASK);
+    }
+#endif
+    for (; vert < vert_end; vert++)
     {
         float d = ImDot(vert->pos - gradient_p0, gradient_extent);
         float t = ImClamp(d * gradient_inv_length2, 0.0f, 1.0f);
@@ -1619,6 +2747,7 @@ void ImGui::ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int ve
 // Distribute UV over (a, b) rectangle
 void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, bool clamp)
 {
+    draw_list->_FlushDeferredPrims();
     const ImVec2 size = b - a;
     const ImVec2 uv_size = uv_b - uv_a;
     const ImVec2 scale = ImVec2(
@@ -1627,16 +2756,34 @@ void ImGui::ShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int ve
 
     ImDrawVert* vert_start = draw_list->VtxBuffer.Data + vert_start_idx;
     ImDrawVert* vert_end = draw_list->VtxBuffer.Data + vert_end_idx;
+    const ImVec2 min = ImMin(uv_a, uv_b);
+    const ImVec2 max = ImMax(uv_a, uv_b);
+    ImDrawVert* vertex = vert_start;
+#if defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
+    // Two vertices at a time, same operations and rounding as the scalar loops below (ImClamp() maps to max/min with this operand order)
+    const __m128 a2 = _mm_setr_ps(a.x, a.y, a.x, a.y);
+    const __m128 scale2 = _mm_setr_ps(scale.x, scale.y, scale.x, scale.y);
+    const __m128 uv_a2 = _mm_setr_ps(uv_a.x, uv_a.y, uv_a.x, uv_a.y);
+    const __m128 min2 = _mm_setr_ps(min.x, min.y, min.x, min.y);
+    const __m128 max2 = _mm_setr_ps(max.x, max.y, max.x, max.y);
+    for (; vertex + 2 <= vert_end; vertex += 2)
+    {
+        const __m128 pos = _mm_loadh_pi(_mm_loadl_pi(a2, (const __m64*)(const void*)&vertex[0].pos), (const __m64*)(const void*)&vertex[1].pos);
+        __m128 uv = _mm_add_ps(uv_a2, _mm_mul_ps(_mm_sub_ps(pos, a2), scale2));
+        if (clamp)
+            uv = _mm_min_ps(max2, _mm_max_ps(min2, uv));
+        _mm_storel_pi((__m64*)(void*)&vertex[0].uv, uv);
+        _mm_storeh_pi((__m64*)(void*)&vertex[1].uv, uv);
+    }
+#endif
     if (clamp)
     {
-        const ImVec2 min = ImMin(uv_a, uv_b);
-        const ImVec2 max = ImMax(uv_a, uv_b);
-        for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+        for (; vertex < vert_end; ++vertex)
             vertex->uv = ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max);
     }
     else
     {
-        for (ImDrawVert* vertex = vert_start; vertex < vert_end; ++vertex)
+        for (; vertex < vert_end; ++vertex)
             vertex->uv = uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
     }
 }
@@ -1664,6 +2811,10 @@ ImFontConfig::ImFontConfig()
     RasterizerFlags = 0x00;
     RasterizerMultiply = 1.0f;
     EllipsisChar = (ImWchar)-1;
+    DynamicGlyphs = false;
+    DynamicGlyphsCacheSize = 1024;
+    SDF = false;
+    SDFSpread = 4;
     memset(Name, 0, sizeof(Name));
     DstFont = NULL;
 }
@@ -1725,15 +2876,19 @@ ImFontAtlas::ImFontAtlas()
     Locked = false;
     Flags = ImFontAtlasFlags_None;
     TexID = (ImTextureID)NULL;
+    TexIDSDF = (ImTextureID)NULL;
     TexDesiredWidth = 0;
     TexGlyphPadding = 1;
+    BuildJobsFn = NULL;
+    BuildJobsUserData = NULL;
+    DynamicGlyphsFrameCount = 0;
 
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
     TexWidth = TexHeight = 0;
     TexUvScale = ImVec2(0.0f, 0.0f);
     TexUvWhitePixel = ImVec2(0.0f, 0.0f);
-    PackIdMouseCursors = PackIdLines = -1;
+    PackIdMouseCursors = PackIdLines = PackIdRoundCorners = -1;
 }
 
 ImFontAtlas::~ImFontAtlas()
@@ -1745,6 +2900,7 @@ ImFontAtlas::~ImFontAtlas()
 void    ImFontAtlas::ClearInputData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasClearDynamicGlyphs(this); // Need FontData
     for (int i = 0; i < ConfigData.Size; i++)
         if (ConfigData[i].FontData && ConfigData[i].FontDataOwnedByAtlas)
         {
@@ -1761,7 +2917,7 @@ void    ImFontAtlas::ClearInputData()
         }
     ConfigData.clear();
     CustomRects.clear();
-    PackIdMouseCursors = PackIdLines = -1;
+    PackIdMouseCursors = PackIdLines = PackIdRoundCorners = -1;
 }
 
 void    ImFontAtlas::ClearTexData()
@@ -1771,13 +2927,17 @@ void    ImFontAtlas::ClearTexData()
         IM_FREE(TexPixelsAlpha8);
     if (TexPixelsRGBA32)
         IM_FREE(TexPixelsRGBA32);
+    IM_ASSERT(DynamicGlyphs.Size == 0 && "Cannot clear texture data of an atlas using ImFontConfig::DynamicGlyphs: glyphs are rasterized into it on demand.");
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
+    TexDirtyRects.clear();
+    ImFontAtlasClearDynamicGlyphs(this); // Glyphs not rasterized yet won't be drawn
 }
 
 void    ImFontAtlas::ClearFonts()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasClearDynamicGlyphs(this);
     for (int i = 0; i < Fonts.Size; i++)
         IM_DELETE(Fonts[i]);
     Fonts.clear();
@@ -1857,6 +3017,7 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
         new_font_cfg.DstFont->EllipsisChar = font_cfg->EllipsisChar;
 
     // Invalidate texture
+    ImFontAtlasClearDynamicGlyphs(this);
     ClearTexData();
     return new_font_cfg.DstFont;
 }
@@ -2052,6 +3213,10 @@ struct ImFontBuildSrcData
     int                 GlyphsCount;        // Glyph count (excluding missing glyphs and glyphs already set by an earlier source font)
     ImBitVector         GlyphsSet;          // Glyph bit map (random access, 1-bit per codepoint. This will be a maximum of 8KB)
     ImVector<int>       GlyphsList;         // Glyph codepoints list (flattened version of GlyphsMap)
+    bool                DynamicGlyphs;      // cfg.DynamicGlyphs: pack a grid of DynamicSlotsCount slots, glyphs fitting a slot get an empty rectangle and are not rendered
+    int                 DynamicSlotsCount;
+    int                 DynamicSlotWidth, DynamicSlotHeight;
+    stbrp_rect          DynamicSlotsRect;
 };
 
 // Temporary data for one destination ImFont* (multiple source fonts can be merged into one destination ImFont)
@@ -2075,6 +3240,221 @@ static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>*
                     out->push_back((int)(((it - it_begin) << 5) + bit_n));
 }
 
+// The glyph lookups and rasterization of each source font are split in jobs, which can run in parallel with atlas->BuildJobsFn.
+// Jobs only write to their own part of the bit sets/rectangles/texture, everything order-dependent (resolving overlaps between
+// source fonts, packing) stays serial, so the output doesn't depend on how jobs are scheduled.
+static const int FONT_ATLAS_BUILD_JOB_CODEPOINTS = 4096;    // Codepoints looked up per job. Must be a multiple of 32 so jobs don't share ImBitVector words.
+static const int FONT_ATLAS_BUILD_JOB_GLYPHS = 256;         // Glyphs measured or rasterized per job.
+static const int FONT_ATLAS_DYNAMIC_SLOT_PERCENTILE = 95;   // Slots of ImFontConfig::DynamicGlyphs fit this percentage of the glyphs, larger glyphs are baked.
+
+struct ImFontBuildJob
+{
+    int                 SrcIndex;           // Index into src_tmp_array[]
+    int                 Begin, End;         // Codepoints or glyphs range [Begin, End)
+    int                 Surface;            // Output of the measuring jobs
+};
+
+struct ImFontBuildJobsData
+{
+    ImFontAtlas*                    Atlas;
+    ImFontBuildSrcData*             Src;
+    ImVector<ImFontBuildJob>        Jobs;
+    const stbtt_pack_context*       PackContext;
+};
+
+static void ImFontAtlasBuildRunJobs(ImFontAtlas* atlas, ImFontBuildJobsData* jobs_data, void (*job_fn)(void* job_data, int job_index))
+{
+    if (atlas->BuildJobsFn != NULL && jobs_data->Jobs.Size > 1)
+    {
+        atlas->BuildJobsFn(atlas->BuildJobsUserData, jobs_data->Jobs.Size, job_fn, jobs_data);
+        return;
+    }
+    for (int n = 0; n < jobs_data->Jobs.Size; n++)
+        job_fn(jobs_data, n);
+}
+
+// Check for the presence of every requested codepoint of the job range in the font data
+static void ImFontAtlasBuildFindGlyphsJob(void* job_data, int job_index)
+{
+    ImFontBuildJobsData* jobs_data = (ImFontBuildJobsData*)job_data;
+    const ImFontBuildJob& job = jobs_data->Jobs[job_index];
+    ImFontBuildSrcData& src_tmp = jobs_data->Src[job.SrcIndex];
+    for (const ImWchar* src_range = src_tmp.SrcRanges; src_range[0] && src_range[1]; src_range += 2)
+    {
+        const unsigned int codepoint_begin = ImMax((unsigned int)src_range[0], (unsigned int)job.Begin);
+        const unsigned int codepoint_end = ImMin((unsigned int)src_range[1] + 1, (unsigned int)job.End);
+        for (unsigned int codepoint = codepoint_begin; codepoint < codepoint_end; codepoint++)
+            if (stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint))
+                src_tmp.GlyphsSet.SetBit(codepoint);
+    }
+}
+
+// Gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
+// Same as stbtt__oversample_shift(), which is private to the stb_truetype implementation (see IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION)
+static float ImFontAtlasBuildOversampleShift(int oversample)
+{
+    return oversample ? -(float)(oversample - 1) / (2.0f * (float)oversample) : 0.0f;
+}
+
+static void ImFontAtlasBuildMeasureGlyphsJob(void* job_data, int job_index)
+{
+    ImFontBuildJobsData* jobs_data = (ImFontBuildJobsData*)job_data;
+    ImFontBuildJob& job = jobs_data->Jobs[job_index];
+    ImFontBuildSrcData& src_tmp = jobs_data->Src[job.SrcIndex];
+    const ImFontConfig& cfg = jobs_data->Atlas->ConfigData[job.SrcIndex];
+    const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
+    const int padding = jobs_data->Atlas->TexGlyphPadding;
+    job.Surface = 0;
+    for (int glyph_i = job.Begin; glyph_i < job.End; glyph_i++)
+    {
+        int x0, y0, x1, y1;
+        const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
+        IM_ASSERT(glyph_index_in_font != 0);
+        if (cfg.SDF)
+        {
+            // Distance fields: same box as stbtt_GetGlyphSDF() (no oversampling, grown by the spread), empty for blank glyphs
+            int advance, lsb;
+            stbtt_GetGlyphHMetrics(&src_tmp.FontInfo, glyph_index_in_font, &advance, &lsb);
+            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale, scale, 0, 0, &x0, &y0, &x1, &y1);
+            const bool blank = (x0 == x1 || y0 == y1);
+            x0 -= cfg.SDFSpread; y0 -= cfg.SDFSpread;
+            x1 += cfg.SDFSpread; y1 += cfg.SDFSpread;
+            src_tmp.Rects[glyph_i].w = blank ? 0 : (stbrp_coord)(x1 - x0 + padding);
+            src_tmp.Rects[glyph_i].h = blank ? 0 : (stbrp_coord)(y1 - y0 + padding);
+            job.Surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
+            stbtt_packedchar& pc = src_tmp.PackedChars[glyph_i];
+            pc.xadvance = scale * advance;
+            pc.xoff = blank ? 0.0f : (float)x0;
+            pc.yoff = blank ? 0.0f : (float)y0;
+            pc.xoff2 = blank ? 0.0f : (float)x1;
+            pc.yoff2 = blank ? 0.0f : (float)y1;
+            continue;
+        }
+
+        stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+        src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
+        src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+        job.Surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
+
+        // Glyphs rasterized on demand: output the same metrics as stbtt_PackFontRangesRenderIntoRects(), without position in the texture
+        if (src_tmp.DynamicGlyphs)
+        {
+            int advance, lsb;
+            stbtt_GetGlyphHMetrics(&src_tmp.FontInfo, glyph_index_in_font, &advance, &lsb);
+            const float sub_x = ImFontAtlasBuildOversampleShift(cfg.OversampleH);
+            const float sub_y = ImFontAtlasBuildOversampleShift(cfg.OversampleV);
+            stbtt_packedchar& pc = src_tmp.PackedChars[glyph_i];
+            pc.x0 = pc.y0 = pc.x1 = pc.y1 = 0;
+            pc.xadvance = scale * advance;
+            pc.xoff = (float)x0 * (1.0f / cfg.OversampleH) + sub_x;
+            pc.yoff = (float)y0 * (1.0f / cfg.OversampleV) + sub_y;
+            pc.xoff2 = (x0 + src_tmp.Rects[glyph_i].w - padding) * (1.0f / cfg.OversampleH) + sub_x;
+            pc.yoff2 = (y0 + src_tmp.Rects[glyph_i].h - padding) * (1.0f / cfg.OversampleV) + sub_y;
+        }
+    }
+}
+
+// Render/rasterize the glyphs of the job range into their (disjoint) rectangles of the texture
+static void ImFontAtlasBuildRenderGlyphsJob(void* job_data, int job_index)
+{
+    ImFontBuildJobsData* jobs_data = (ImFontBuildJobsData*)job_data;
+    const ImFontBuildJob& job = jobs_data->Jobs[job_index];
+    ImFontBuildSrcData& src_tmp = jobs_data->Src[job.SrcIndex];
+    const ImFontConfig& cfg = jobs_data->Atlas->ConfigData[job.SrcIndex];
+
+    // Distance fields: generate each glyph and copy it at the top-left of its rectangle (the padding is on the right/bottom, like stbtt_PackFontRangesRenderIntoRects() does)
+    if (cfg.SDF)
+    {
+        ImFontAtlas* atlas = jobs_data->Atlas;
+        const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
+        for (int glyph_i = job.Begin; glyph_i < job.End; glyph_i++)
+        {
+            const stbrp_rect& r = src_tmp.Rects[glyph_i];
+            if (!r.was_packed || r.w == 0 || r.h == 0)
+                continue;
+            int w, h, x_off, y_off;
+            unsigned char* sdf_pixels = stbtt_GetGlyphSDF(&src_tmp.FontInfo, scale, stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]), cfg.SDFSpread, 128, 128.0f / cfg.SDFSpread, &w, &h, &x_off, &y_off);
+            if (sdf_pixels == NULL)
+                continue;
+            IM_ASSERT(w + atlas->TexGlyphPadding == r.w && h + atlas->TexGlyphPadding == r.h);
+            for (int y = 0; y < h; y++)
+                memcpy(atlas->TexPixelsAlpha8 + (r.y + y) * atlas->TexWidth + r.x, sdf_pixels + y * w, (size_t)w);
+            stbtt_FreeSDF(sdf_pixels, NULL);
+            stbtt_packedchar& pc = src_tmp.PackedChars[glyph_i];
+            pc.x0 = (unsigned short)r.x;
+            pc.y0 = (unsigned short)r.y;
+            pc.x1 = (unsigned short)(r.x + w);
+            pc.y1 = (unsigned short)(r.y + h);
+        }
+        return;
+    }
+
+    stbtt_pack_context spc = *jobs_data->PackContext; // stbtt_PackFontRangesRenderIntoRects() modifies the oversampling fields
+    stbtt_pack_range pack_range = src_tmp.PackRange;
+    pack_range.array_of_unicode_codepoints += job.Begin;
+    pack_range.chardata_for_range += job.Begin;
+    pack_range.num_chars = job.End - job.Begin;
+    stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &pack_range, 1, src_tmp.Rects + job.Begin);
+
+    // Apply multiply operator
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        ImFontAtlas* atlas = jobs_data->Atlas;
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        stbrp_rect* r = &src_tmp.Rects[job.Begin];
+        for (int glyph_i = job.Begin; glyph_i < job.End; glyph_i++, r++)
+            if (r->was_packed)
+                ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+    }
+}
+
+static int IMGUI_CDECL ImFontAtlasBuildCompareInt(const void* lhs, const void* rhs)
+{
+    return *(const int*)lhs - *(const int*)rhs;
+}
+
+// Split the glyphs of every source font in jobs of FONT_ATLAS_BUILD_JOB_GLYPHS
+static void ImFontAtlasBuildSetupGlyphsJobs(ImFontBuildJobsData* jobs_data, int src_count)
+{
+    jobs_data->Jobs.resize(0);
+    for (int src_i = 0; src_i < src_count; src_i++)
+    {
+        const ImFontBuildSrcData& src_tmp = jobs_data->Src[src_i];
+        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i += FONT_ATLAS_BUILD_JOB_GLYPHS)
+        {
+            ImFontBuildJob job;
+            job.SrcIndex = src_i;
+            job.Begin = glyph_i;
+            job.End = ImMin(glyph_i + FONT_ATLAS_BUILD_JOB_GLYPHS, src_tmp.GlyphsCount);
+            job.Surface = 0;
+            jobs_data->Jobs.push_back(job);
+        }
+    }
+}
+
+// Keep what we need to rasterize the glyphs of a font input using ImFontConfig::DynamicGlyphs (also used when loading a cache)
+static void ImFontAtlasBuildAddDynamicGlyphs(ImFontAtlas* atlas, int config_index, const stbtt_fontinfo* font_info, int glyphs_offset, int glyphs_count, int slots_count, int slots_x, int slots_y, int slot_w, int slot_h, int slots_per_row)
+{
+    ImFontDynamicGlyphs* dynamic_glyphs = IM_NEW(ImFontDynamicGlyphs)();
+    dynamic_glyphs->DstFont = atlas->ConfigData[config_index].DstFont;
+    dynamic_glyphs->ConfigIndex = config_index;
+    dynamic_glyphs->FontInfo = IM_ALLOC(sizeof(stbtt_fontinfo));
+    memcpy(dynamic_glyphs->FontInfo, font_info, sizeof(stbtt_fontinfo));
+    dynamic_glyphs->GlyphsOffset = glyphs_offset;
+    dynamic_glyphs->GlyphsCount = glyphs_count;
+    dynamic_glyphs->GlyphsSlot.resize(glyphs_count, -1);
+    dynamic_glyphs->SlotsGlyph.resize(slots_count, -1);
+    dynamic_glyphs->SlotsLastUsedFrame.resize(slots_count, 0);
+    dynamic_glyphs->SlotsLastDrawList.resize(slots_count, NULL);
+    dynamic_glyphs->SlotsX = slots_x;
+    dynamic_glyphs->SlotsY = slots_y;
+    dynamic_glyphs->SlotWidth = slot_w;
+    dynamic_glyphs->SlotHeight = slot_h;
+    dynamic_glyphs->SlotsPerRow = slots_per_row;
+    atlas->DynamicGlyphs.push_back(dynamic_glyphs);
+}
+
 bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
@@ -2083,9 +3463,11 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
     // Clear atlas
     atlas->TexID = (ImTextureID)NULL;
+    atlas->TexIDSDF = (ImTextureID)NULL;
     atlas->TexWidth = atlas->TexHeight = 0;
     atlas->TexUvScale = ImVec2(0.0f, 0.0f);
     atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
+    ImFontAtlasClearDynamicGlyphs(atlas);
     atlas->ClearTexData();
 
     // Temporary storage for building
@@ -2118,6 +3500,9 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         if (!stbtt_InitFont(&src_tmp.FontInfo, (unsigned char*)cfg.FontData, font_offset))
             return false;
 
+        IM_ASSERT(!cfg.SDF || cfg.SDFSpread >= 1);
+        src_tmp.DynamicGlyphs = cfg.DynamicGlyphs && !cfg.SDF;
+
         // Measure highest codepoints
         ImFontBuildDstData& dst_tmp = dst_tmp_array[src_tmp.DstIndex];
         src_tmp.SrcRanges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
@@ -2128,30 +3513,46 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     }
 
     // 2. For every requested codepoint, check for their presence in the font data, and handle redundancy or overlaps between source fonts to avoid unused glyphs.
+    ImFontBuildJobsData jobs_data;
+    jobs_data.Atlas = atlas;
+    jobs_data.Src = src_tmp_array.Data;
+    jobs_data.PackContext = NULL;
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+    {
+        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
+        src_tmp.GlyphsSet.Create(src_tmp.GlyphsHighest + 1);
+        for (int codepoint = 0; codepoint <= src_tmp.GlyphsHighest; codepoint += FONT_ATLAS_BUILD_JOB_CODEPOINTS)
+        {
+            ImFontBuildJob job;
+            job.SrcIndex = src_i;
+            job.Begin = codepoint;
+            job.End = ImMin(codepoint + FONT_ATLAS_BUILD_JOB_CODEPOINTS, src_tmp.GlyphsHighest + 1);
+            job.Surface = 0;
+            jobs_data.Jobs.push_back(job);
+        }
+    }
+    ImFontAtlasBuildRunJobs(atlas, &jobs_data, ImFontAtlasBuildFindGlyphsJob);
+
+    // Don't overwrite glyphs of an earlier source font. We could make this an option for MergeMode (e.g. MergeOverwrite==true)
     int total_glyphs_count = 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
         ImFontBuildDstData& dst_tmp = dst_tmp_array[src_tmp.DstIndex];
-        src_tmp.GlyphsSet.Create(src_tmp.GlyphsHighest + 1);
         if (dst_tmp.GlyphsSet.Storage.empty())
             dst_tmp.GlyphsSet.Create(dst_tmp.GlyphsHighest + 1);
-
-        for (const ImWchar* src_range = src_tmp.SrcRanges; src_range[0] && src_range[1]; src_range += 2)
-            for (unsigned int codepoint = src_range[0]; codepoint <= src_range[1]; codepoint++)
-            {
-                if (dst_tmp.GlyphsSet.TestBit(codepoint))    // Don't overwrite existing glyphs. We could make this an option for MergeMode (e.g. MergeOverwrite==true)
-                    continue;
-                if (!stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint))    // It is actually in the font?
-                    continue;
-
-                // Add to avail set/counters
+        for (int word_n = 0; word_n < src_tmp.GlyphsSet.Storage.Size; word_n++)
+        {
+            const ImU32 entries_32 = src_tmp.GlyphsSet.Storage[word_n] & ~dst_tmp.GlyphsSet.Storage[word_n];
+            src_tmp.GlyphsSet.Storage[word_n] = entries_32;
+            dst_tmp.GlyphsSet.Storage[word_n] |= entries_32;
+            for (ImU32 bits = entries_32; bits != 0; bits &= bits - 1)
                 src_tmp.GlyphsCount++;
-                dst_tmp.GlyphsCount++;
-                src_tmp.GlyphsSet.SetBit(codepoint);
-                dst_tmp.GlyphsSet.SetBit(codepoint);
-                total_glyphs_count++;
-            }
+        }
+
+        // Add to avail counters
+        dst_tmp.GlyphsCount += src_tmp.GlyphsCount;
+        total_glyphs_count += src_tmp.GlyphsCount;
     }
 
     // 3. Unpack our bit map into a flat list (we now have all the Unicode points that we know are requested _and_ available _and_ not overlapping another)
@@ -2177,7 +3578,6 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     memset(buf_packedchars.Data, 0, (size_t)buf_packedchars.size_in_bytes());
 
     // 4. Gather glyphs sizes so we can pack them in our virtual canvas.
-    int total_surface = 0;
     int buf_rects_out_n = 0;
     int buf_packedchars_out_n = 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
@@ -2200,21 +3600,63 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp.PackRange.chardata_for_range = src_tmp.PackedChars;
         src_tmp.PackRange.h_oversample = (unsigned char)cfg.OversampleH;
         src_tmp.PackRange.v_oversample = (unsigned char)cfg.OversampleV;
+    }
+    ImFontAtlasBuildSetupGlyphsJobs(&jobs_data, src_tmp_array.Size);
+    ImFontAtlasBuildRunJobs(atlas, &jobs_data, ImFontAtlasBuildMeasureGlyphsJob);
+    int total_surface = 0;
+    for (int job_n = 0; job_n < jobs_data.Jobs.Size; job_n++)
+        if (!src_tmp_array[jobs_data.Jobs[job_n].SrcIndex].DynamicGlyphs)
+            total_surface += jobs_data.Jobs[job_n].Surface;
 
-        // Gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
-        const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
-        const int padding = atlas->TexGlyphPadding;
-        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
+    // Glyphs rasterized on demand share slots sized for FONT_ATLAS_DYNAMIC_SLOT_PERCENTILE of them (so a few very large glyphs don't
+    // inflate every slot). Glyphs fitting a slot get an empty rectangle, the larger ones are packed and rendered as usual.
+    ImVector<int> buf_sizes;
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+    {
+        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
+        if (!src_tmp.DynamicGlyphs || src_tmp.GlyphsCount == 0)
+            continue;
+        const int percentile_n = (src_tmp.GlyphsCount - 1) * FONT_ATLAS_DYNAMIC_SLOT_PERCENTILE / 100;
+        buf_sizes.resize(src_tmp.GlyphsCount);
+        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
+            buf_sizes[glyph_i] = src_tmp.Rects[glyph_i].w;
+        ImQsort(buf_sizes.Data, (size_t)buf_sizes.Size, sizeof(int), ImFontAtlasBuildCompareInt);
+        src_tmp.DynamicSlotWidth = buf_sizes[percentile_n];
+        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
+            buf_sizes[glyph_i] = src_tmp.Rects[glyph_i].h;
+        ImQsort(buf_sizes.Data, (size_t)buf_sizes.Size, sizeof(int), ImFontAtlasBuildCompareInt);
+        src_tmp.DynamicSlotHeight = buf_sizes[percentile_n];
+
+        int fitting_count = 0, fitting_surface = 0, glyphs_surface = 0;
+        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
+        {
+            const stbrp_rect& r = src_tmp.Rects[glyph_i];
+            glyphs_surface += r.w * r.h;
+            if (r.w <= src_tmp.DynamicSlotWidth && r.h <= src_tmp.DynamicSlotHeight)
+            {
+                fitting_count++;
+                fitting_surface += r.w * r.h;
+            }
+        }
+        src_tmp.DynamicSlotsCount = ImClamp(atlas->ConfigData[src_i].DynamicGlyphsCacheSize, 1, fitting_count);
+
+        // Bake everything when the slots would take more room than the glyphs they replace (e.g. cache as large as the font)
+        const int slots_surface = src_tmp.DynamicSlotsCount * src_tmp.DynamicSlotWidth * src_tmp.DynamicSlotHeight;
+        if (slots_surface >= fitting_surface)
+        {
+            src_tmp.DynamicGlyphs = false;
+            total_surface += glyphs_surface;
+            continue;
+        }
+        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
         {
-            int x0, y0, x1, y1;
-            const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
-            IM_ASSERT(glyph_index_in_font != 0);
-            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
-            total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
+            stbrp_rect& r = src_tmp.Rects[glyph_i];
+            if (r.w <= src_tmp.DynamicSlotWidth && r.h <= src_tmp.DynamicSlotHeight)
+                r.w = r.h = 0;
         }
+        total_surface += glyphs_surface - fitting_surface + slots_surface;
     }
+    buf_sizes.clear();
 
     // We need a width for the skyline algorithm, any width!
     // The exact width doesn't really matter much, but some API/GPU have texture size limitations and increasing width can decrease height.
@@ -2240,6 +3682,20 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         if (src_tmp.GlyphsCount == 0)
             continue;
 
+        if (src_tmp.DynamicGlyphs)
+        {
+            // Pack a single rectangle for the grid of slots, then the glyphs too large for a slot
+            // (stbtt_PackBegin() leaves 'padding' pixels on the right side of the texture)
+            stbrp_rect& r = src_tmp.DynamicSlotsRect;
+            const int slots_per_row = ImClamp((atlas->TexWidth - atlas->TexGlyphPadding) / src_tmp.DynamicSlotWidth, 1, src_tmp.DynamicSlotsCount);
+            r.w = (stbrp_coord)(slots_per_row * src_tmp.DynamicSlotWidth);
+            r.h = (stbrp_coord)(((src_tmp.DynamicSlotsCount + slots_per_row - 1) / slots_per_row) * src_tmp.DynamicSlotHeight);
+            stbrp_pack_rects((stbrp_context*)spc.pack_info, &r, 1);
+            IM_ASSERT(r.was_packed && "Glyphs of ImFontConfig::DynamicGlyphs too large for the texture width?");
+            if (r.was_packed)
+                atlas->TexHeight = ImMax(atlas->TexHeight, r.y + r.h);
+        }
+
         stbrp_pack_rects((stbrp_context*)spc.pack_info, src_tmp.Rects, src_tmp.GlyphsCount);
 
         // Extend texture height and mark missing glyphs as non-packed so we won't render them.
@@ -2258,27 +3714,10 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
+    jobs_data.PackContext = &spc;
+    ImFontAtlasBuildRunJobs(atlas, &jobs_data, ImFontAtlasBuildRenderGlyphsJob);
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
-    {
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
-
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
-        {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
-        }
-        src_tmp.Rects = NULL;
-    }
+        src_tmp_array[src_i].Rects = NULL;
 
     // End packing
     stbtt_PackEnd(&spc);
@@ -2304,9 +3743,13 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         const float ascent = ImFloor(unscaled_ascent * font_scale + ((unscaled_ascent > 0.0f) ? +1 : -1));
         const float descent = ImFloor(unscaled_descent * font_scale + ((unscaled_descent > 0.0f) ? +1 : -1));
         ImFontAtlasBuildSetupFont(atlas, dst_font, &cfg, ascent, descent);
+        if (!cfg.MergeMode)
+            dst_font->SDF = cfg.SDF;
+        IM_ASSERT(dst_font->SDF == cfg.SDF && "Font inputs merged into a same ImFont need the same ImFontConfig::SDF setting.");
         const float font_off_x = cfg.GlyphOffset.x;
         const float font_off_y = cfg.GlyphOffset.y + IM_ROUND(dst_font->Ascent);
 
+        const int glyphs_offset = dst_font->Glyphs.Size;
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
         {
             // Register glyph
@@ -2316,6 +3759,14 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             float unused_x = 0.0f, unused_y = 0.0f;
             stbtt_GetPackedQuad(src_tmp.PackedChars, atlas->TexWidth, atlas->TexHeight, glyph_i, &unused_x, &unused_y, &q, 0);
             dst_font->AddGlyph(&cfg, (ImWchar)codepoint, q.x0 + font_off_x, q.y0 + font_off_y, q.x1 + font_off_x, q.y1 + font_off_y, q.s0, q.t0, q.s1, q.t1, pc.xadvance);
+            dst_font->Glyphs.back().Dynamic = (src_tmp.DynamicGlyphs && pc.x1 == pc.x0); // Not rendered by ImFontAtlasBuildRenderGlyphsJob()
+        }
+
+        // Glyphs rasterized on demand: keep what we need to rasterize them
+        if (src_tmp.DynamicGlyphs && src_tmp.DynamicSlotsRect.was_packed)
+        {
+            const stbrp_rect& r = src_tmp.DynamicSlotsRect;
+            ImFontAtlasBuildAddDynamicGlyphs(atlas, src_i, &src_tmp.FontInfo, glyphs_offset, src_tmp.GlyphsCount, src_tmp.DynamicSlotsCount, r.x, r.y, src_tmp.DynamicSlotWidth, src_tmp.DynamicSlotHeight, r.w / src_tmp.DynamicSlotWidth);
         }
     }
 
@@ -2327,6 +3778,161 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     return true;
 }
 
+// Rasterize a glyph rasterized on demand into a slot, with the same code as when baking it in ImFontAtlasBuildWithStbTruetype()
+static void ImFontAtlasRasterizeDynamicGlyph(ImFontAtlas* atlas, ImFontDynamicGlyphs* dynamic_glyphs, int glyph_i, int slot)
+{
+    ImFontGlyph* glyph = &dynamic_glyphs->DstFont->Glyphs[dynamic_glyphs->GlyphsOffset + glyph_i];
+    const ImFontConfig& cfg = atlas->ConfigData[dynamic_glyphs->ConfigIndex];
+    const stbtt_fontinfo* font_info = (const stbtt_fontinfo*)dynamic_glyphs->FontInfo;
+    const int slot_x = dynamic_glyphs->SlotsX + (slot % dynamic_glyphs->SlotsPerRow) * dynamic_glyphs->SlotWidth;
+    const int slot_y = dynamic_glyphs->SlotsY + (slot / dynamic_glyphs->SlotsPerRow) * dynamic_glyphs->SlotHeight;
+    for (int y = slot_y; y < slot_y + dynamic_glyphs->SlotHeight; y++)
+        memset(atlas->TexPixelsAlpha8 + slot_x + y * atlas->TexWidth, 0, (size_t)dynamic_glyphs->SlotWidth);
+
+    // Measure (see ImFontAtlasBuildMeasureGlyphsJob)
+    int codepoint = (int)glyph->Codepoint;
+    int x0, y0, x1, y1;
+    const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(font_info, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(font_info, -cfg.SizePixels);
+    const int padding = atlas->TexGlyphPadding;
+    stbtt_GetGlyphBitmapBoxSubpixel(font_info, stbtt_FindGlyphIndex(font_info, codepoint), scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+    stbrp_rect r = {};
+    r.x = (stbrp_coord)slot_x;
+    r.y = (stbrp_coord)slot_y;
+    r.w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
+    r.h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+    r.was_packed = 1;
+    IM_ASSERT(r.w <= dynamic_glyphs->SlotWidth && r.h <= dynamic_glyphs->SlotHeight);
+
+    // Render (see ImFontAtlasBuildRenderGlyphsJob)
+    stbtt_pack_context spc = {};
+    spc.pixels = atlas->TexPixelsAlpha8;
+    spc.width = atlas->TexWidth;
+    spc.height = atlas->TexHeight;
+    spc.stride_in_bytes = atlas->TexWidth;
+    spc.padding = padding;
+    stbtt_packedchar pc;
+    stbtt_pack_range pack_range = {};
+    pack_range.font_size = cfg.SizePixels;
+    pack_range.array_of_unicode_codepoints = &codepoint;
+    pack_range.num_chars = 1;
+    pack_range.chardata_for_range = &pc;
+    pack_range.h_oversample = (unsigned char)cfg.OversampleH;
+    pack_range.v_oversample = (unsigned char)cfg.OversampleV;
+    stbtt_PackFontRangesRenderIntoRects(&spc, font_info, &pack_range, 1, &r);
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r.x, r.y, r.w, r.h, atlas->TexWidth * 1);
+    }
+    if (atlas->TexPixelsRGBA32 != NULL)
+        for (int y = slot_y; y < slot_y + dynamic_glyphs->SlotHeight; y++)
+        {
+            const unsigned char* src = atlas->TexPixelsAlpha8 + slot_x + y * atlas->TexWidth;
+            unsigned int* dst = atlas->TexPixelsRGBA32 + slot_x + y * atlas->TexWidth;
+            for (int n = dynamic_glyphs->SlotWidth; n > 0; n--)
+                *dst++ = IM_COL32(255, 255, 255, (unsigned int)(*src++));
+        }
+    atlas->TexDirtyRects.push_back(ImVec4((float)slot_x, (float)slot_y, (float)(slot_x + dynamic_glyphs->SlotWidth), (float)(slot_y + dynamic_glyphs->SlotHeight)));
+
+    // Same texture coordinates as stbtt_GetPackedQuad()
+    const float ipw = 1.0f / atlas->TexWidth, iph = 1.0f / atlas->TexHeight;
+    glyph->U0 = pc.x0 * ipw;
+    glyph->V0 = pc.y0 * iph;
+    glyph->U1 = pc.x1 * ipw;
+    glyph->V1 = pc.y1 * iph;
+    dynamic_glyphs->RasterizedCount++;
+}
+
+// Called before drawing a glyph with the Dynamic flag into 'draw_list': rasterize it if it isn't in the texture, and mark it as used in this frame.
+// Return false if it can't be drawn (all slots are used by glyphs drawn in this frame).
+bool ImFontAtlasUseDynamicGlyph(ImFontAtlas* atlas, const ImFont* font, const ImFontGlyph* glyph, ImDrawList* draw_list)
+{
+    const int glyph_n = (int)(glyph - font->Glyphs.Data);
+    for (int n = 0; n < atlas->DynamicGlyphs.Size; n++)
+    {
+        ImFontDynamicGlyphs* dynamic_glyphs = atlas->DynamicGlyphs[n];
+        const int glyph_i = glyph_n - dynamic_glyphs->GlyphsOffset;
+        if (dynamic_glyphs->DstFont != font || glyph_i < 0 || glyph_i >= dynamic_glyphs->GlyphsCount)
+            continue;
+
+        int slot = dynamic_glyphs->GlyphsSlot[glyph_i];
+        if (slot < 0)
+        {
+            if (dynamic_glyphs->SlotsUsed < dynamic_glyphs->SlotsGlyph.Size)
+            {
+                slot = dynamic_glyphs->SlotsUsed++;
+            }
+            else
+            {
+                // Evict the least recently used glyph
+                for (int slot_n = 0; slot_n < dynamic_glyphs->SlotsGlyph.Size; slot_n++)
+                    if (dynamic_glyphs->SlotsLastUsedFrame[slot_n] != atlas->DynamicGlyphsFrameCount)
+                        if (slot < 0 || dynamic_glyphs->SlotsLastUsedFrame[slot_n] < dynamic_glyphs->SlotsLastUsedFrame[slot])
+                            slot = slot_n;
+                if (slot < 0)
+                {
+                    dynamic_glyphs->OverflowCount++;
+                    return false;
+                }
+                dynamic_glyphs->GlyphsSlot[dynamic_glyphs->SlotsGlyph[slot]] = -1;
+                dynamic_glyphs->EvictedCount++;
+            }
+            dynamic_glyphs->GlyphsSlot[glyph_i] = slot;
+            dynamic_glyphs->SlotsGlyph[slot] = glyph_i;
+            ImFontAtlasRasterizeDynamicGlyph(atlas, dynamic_glyphs, glyph_i, slot);
+        }
+
+        // Record the glyph into the draw list, in case it is rendered again in later frames (see ImFontAtlasKeepDynamicGlyphs)
+        if (dynamic_glyphs->SlotsLastUsedFrame[slot] != atlas->DynamicGlyphsFrameCount || dynamic_glyphs->SlotsLastDrawList[slot] != draw_list)
+        {
+            IM_ASSERT(n < 256 && glyph_i < (1 << 24));
+            draw_list->_DynamicGlyphs.push_back(((ImU32)n << 24) | (ImU32)glyph_i);
+            dynamic_glyphs->SlotsLastDrawList[slot] = draw_list;
+        }
+        dynamic_glyphs->SlotsLastUsedFrame[slot] = atlas->DynamicGlyphsFrameCount;
+        return true;
+    }
+    return false;
+}
+
+// Mark the glyphs rasterized on demand drawn into a draw list as used in this frame, so they are not evicted while its contents
+// may be rendered again (ImDrawListFlags_RetainContents: windows frozen with ImGuiWindowFlags_FreezeWhenIdle). Called by ImGui::NewFrame().
+void ImFontAtlasKeepDynamicGlyphs(ImFontAtlas* atlas, const ImDrawList* draw_list)
+{
+    for (int n = 0; n < draw_list->_DynamicGlyphs.Size; n++)
+    {
+        const ImU32 entry = draw_list->_DynamicGlyphs[n];
+        const int dynamic_glyphs_n = (int)(entry >> 24);
+        const int glyph_i = (int)(entry & 0xFFFFFF);
+        if (dynamic_glyphs_n >= atlas->DynamicGlyphs.Size || glyph_i >= atlas->DynamicGlyphs[dynamic_glyphs_n]->GlyphsCount)
+            continue; // Atlas was rebuilt
+        ImFontDynamicGlyphs* dynamic_glyphs = atlas->DynamicGlyphs[dynamic_glyphs_n];
+        const int slot = dynamic_glyphs->GlyphsSlot[glyph_i];
+        if (slot >= 0)
+        {
+            dynamic_glyphs->SlotsLastUsedFrame[slot] = atlas->DynamicGlyphsFrameCount;
+            dynamic_glyphs->SlotsLastDrawList[slot] = NULL; // Still record it into the next list drawing it in this frame
+        }
+    }
+}
+
+void ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas)
+{
+    atlas->DynamicGlyphsFrameCount++;
+    atlas->TexDirtyRects.resize(0);
+}
+
+void ImFontAtlasClearDynamicGlyphs(ImFontAtlas* atlas)
+{
+    for (int n = 0; n < atlas->DynamicGlyphs.Size; n++)
+    {
+        IM_FREE(atlas->DynamicGlyphs[n]->FontInfo);
+        IM_DELETE(atlas->DynamicGlyphs[n]);
+    }
+    atlas->DynamicGlyphs.clear();
+}
+
 void ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent)
 {
     if (!font_config->MergeMode)
@@ -2435,6 +4041,68 @@ static void ImFontAtlasBuildRenderLinesTexData(ImFontAtlas* atlas)
     }
 }
 
+// Coverage of a rounded corner shape, in corner-local coordinates where (0,0) is the outer corner of the rectangle.
+// - Filled: the rectangle interior, with a quarter disc of radius 'r' centered on (r,r).
+// - Stroked: a 1 pixel thick border, following PathRect() + PathStroke() conventions used by AddRect(): the path is inset by half a pixel,
+//   so the ring is centered on (r+0.5,r+0.5), and continues as 1 pixel straight bands past the end of the arc.
+static bool ImFontAtlasBuildRoundCornerContains(float x, float y, int radius, bool stroked)
+{
+    if (x < 0.0f || y < 0.0f)
+        return false;
+    const float r = (float)radius;
+    const float c = stroked ? r + 0.5f : r;
+    if (x > c || y > c)
+    {
+        if (!stroked)
+            return true;
+        if (x > c && y > c)
+            return false;                                       // Rectangle interior
+        return (x > c) ? (y <= 1.0f) : (x <= 1.0f);             // Straight borders past the end of the arc
+    }
+    const float d2 = (x - c) * (x - c) + (y - c) * (y - c);
+    return stroked ? (d2 >= (r - 0.5f) * (r - 0.5f) && d2 <= (r + 0.5f) * (r + 0.5f)) : (d2 <= r * r);
+}
+
+static void ImFontAtlasBuildRenderRoundCornersTexData(ImFontAtlas* atlas)
+{
+    if (atlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners)
+        return;
+
+    // Each radius has its own rectangle holding the filled corner on top of the stroked corner, both for the top-left corner
+    // (other corners are drawn by flipping UVs). Every corner is surrounded by 1 texel of padding computed from the same
+    // shape, so bilinear filtering of non pixel-aligned rectangles doesn't bleed neighbor data.
+    // Coverage is obtained by super-sampling each texel.
+    const int SAMPLES = 8;
+    for (int radius = 1; radius <= IM_DRAWLIST_TEX_ROUND_CORNERS_MAX; radius++)
+    {
+        ImFontAtlasCustomRect* r = atlas->GetCustomRectByIndex(atlas->PackIdRoundCorners + radius - 1);
+        IM_ASSERT(r->IsPacked());
+        for (int stroked = 0; stroked < 2; stroked++)
+        {
+            const int size = stroked ? radius + 1 : radius;     // Corner size in pixels, not counting padding
+            const int pad_y = stroked ? radius + 2 : 0;         // Stroked corner is stored below the filled one
+            IM_ASSERT(size + 2 <= r->Width && pad_y + size + 2 <= r->Height);
+            for (int y = -1; y <= size; y++)
+            {
+                unsigned char* write_ptr = &atlas->TexPixelsAlpha8[(r->X + 1) + (r->Y + pad_y + 1 + y) * atlas->TexWidth];
+                for (int x = -1; x <= size; x++)
+                {
+                    int hits = 0;
+                    for (int sy = 0; sy < SAMPLES; sy++)
+                        for (int sx = 0; sx < SAMPLES; sx++)
+                            hits += ImFontAtlasBuildRoundCornerContains(x + (sx + 0.5f) / SAMPLES, y + (sy + 0.5f) / SAMPLES, radius, stroked != 0) ? 1 : 0;
+                    write_ptr[x] = (unsigned char)((hits * 255 + (SAMPLES * SAMPLES) / 2) / (SAMPLES * SAMPLES));
+                }
+            }
+
+            // Calculate UVs for this corner, excluding padding
+            ImVec2 uv0 = ImVec2((float)(r->X + 1), (float)(r->Y + pad_y + 1)) * atlas->TexUvScale;
+            ImVec2 uv1 = ImVec2((float)(r->X + 1 + size), (float)(r->Y + pad_y + 1 + size)) * atlas->TexUvScale;
+            (stroked ? atlas->TexUvRoundCornerStroked : atlas->TexUvRoundCornerFilled)[radius] = ImVec4(uv0.x, uv0.y, uv1.x, uv1.y);
+        }
+    }
+}
+
 // Note: this is called / shared by both the stb_truetype and the FreeType builder
 void ImFontAtlasBuildInit(ImFontAtlas* atlas)
 {
@@ -2454,6 +4122,19 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
         if (!(atlas->Flags & ImFontAtlasFlags_NoBakedLines))
             atlas->PackIdLines = atlas->AddCustomRectRegular(IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 2, IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1);
     }
+
+    // Register texture regions for rounded corners, one per radius: filled corner (radius x radius) above stroked corner (radius+1 x radius+1)
+    // The +2 here are for padding on each side of both corners
+    if (atlas->PackIdRoundCorners < 0)
+    {
+        if (!(atlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners))
+            for (int radius = 1; radius <= IM_DRAWLIST_TEX_ROUND_CORNERS_MAX; radius++)
+            {
+                const int id = atlas->AddCustomRectRegular(radius + 1 + 2, (radius + 2) + (radius + 1 + 2));
+                if (radius == 1)
+                    atlas->PackIdRoundCorners = id;
+            }
+    }
 }
 
 // This is called/shared by both the stb_truetype and the FreeType builder.
@@ -2463,6 +4144,7 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
     IM_ASSERT(atlas->TexPixelsAlpha8 != NULL);
     ImFontAtlasBuildRenderDefaultTexData(atlas);
     ImFontAtlasBuildRenderLinesTexData(atlas);
+    ImFontAtlasBuildRenderRoundCornersTexData(atlas);
 
     // Register custom rectangle glyphs
     for (int i = 0; i < atlas->CustomRects.Size; i++)
@@ -2501,6 +4183,307 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
     }
 }
 
+// Persistent atlas cache: a built atlas saved by SaveCacheToMemory() is restored by LoadCacheFromMemory() without running Build().
+// Layout (native endianness, sizes of stored structures are part of the key):
+// - Header: FONT_ATLAS_CACHE_MAGIC, FONT_ATLAS_CACHE_VERSION, key from ImFontAtlasCalcCacheKey()
+// - Texture size, white pixel/lines/rounded corners UV, position of each custom rectangle
+// - For each font: ImFontAtlasCacheFont + glyphs
+// - For each font input using ImFontConfig::DynamicGlyphs: ImFontAtlasCacheDynamicGlyphs
+// - Alpha8 texture
+static const ImU32 FONT_ATLAS_CACHE_MAGIC = 0x41464D49; // "IMFA"
+static const ImU32 FONT_ATLAS_CACHE_VERSION = 2;
+
+struct ImFontAtlasCacheFont
+{
+    float               Ascent, Descent;
+    int                 ConfigDataCount;    // 0 when Build() didn't setup the font (no glyphs)
+    int                 EllipsisChar;
+    int                 MetricsTotalSurface;
+    int                 GlyphsCount;
+    int                 SDF;
+};
+
+struct ImFontAtlasCacheDynamicGlyphs
+{
+    int                 ConfigIndex, GlyphsOffset, GlyphsCount, SlotsCount;
+    int                 SlotsX, SlotsY, SlotWidth, SlotHeight, SlotsPerRow;
+};
+
+struct ImFontAtlasCacheReader
+{
+    const unsigned char* Data;
+    const unsigned char* DataEnd;
+
+    ImFontAtlasCacheReader(const void* data, size_t data_size) { Data = (const unsigned char*)data; DataEnd = Data + data_size; }
+    const void* Read(size_t size)           { if ((size_t)(DataEnd - Data) < size) return NULL; const void* p = Data; Data += size; return p; }
+    bool        Read(void* dst, size_t size){ const void* p = Read(size); if (p) memcpy(dst, p, size); return p != NULL; }
+};
+
+// Reject glyphs which would make rendering read outside of the texture or index lookup tables
+static bool ImFontAtlasCacheValidateGlyph(const ImFontGlyph& glyph)
+{
+    if (glyph.Codepoint > IM_UNICODE_CODEPOINT_MAX)
+        return false;
+    if (!(glyph.U0 >= 0.0f && glyph.U1 <= 1.0f && glyph.U0 <= glyph.U1 && glyph.V0 >= 0.0f && glyph.V1 <= 1.0f && glyph.V0 <= glyph.V1)) // Also rejects NaN
+        return false;
+    const float coords[] = { glyph.AdvanceX, glyph.X0, glyph.Y0, glyph.X1, glyph.Y1 };
+    for (int n = 0; n < IM_ARRAYSIZE(coords); n++)
+        if (!(coords[n] >= -FLT_MAX && coords[n] <= FLT_MAX))
+            return false;
+    return true;
+}
+
+static void ImFontAtlasCacheWrite(ImVector<unsigned char>* buf, const void* data, size_t size)
+{
+    const int offset = buf->Size;
+    buf->resize(offset + (int)size);
+    memcpy(buf->Data + offset, data, size);
+}
+
+// Hash everything Build() takes as input: font data, ImFontConfig settings, glyph ranges, atlas settings and custom rectangles.
+static ImU32 ImFontAtlasCalcCacheKey(ImFontAtlas* atlas)
+{
+    const int atlas_ints[] = { IMGUI_VERSION_NUM, (int)sizeof(ImFontGlyph), (int)sizeof(ImFontAtlasCustomRect), atlas->Flags, atlas->TexDesiredWidth, atlas->TexGlyphPadding, atlas->Fonts.Size, atlas->ConfigData.Size, atlas->CustomRects.Size };
+    ImU32 key = ImHashData(atlas_ints, sizeof(atlas_ints));
+    for (int cfg_i = 0; cfg_i < atlas->ConfigData.Size; cfg_i++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[cfg_i];
+        const int cfg_ints[] = { cfg.FontDataSize, cfg.FontNo, cfg.OversampleH, cfg.OversampleV, cfg.PixelSnapH, cfg.MergeMode, (int)cfg.RasterizerFlags, (int)cfg.EllipsisChar, cfg.DynamicGlyphs, cfg.DynamicGlyphsCacheSize, cfg.SDF, cfg.SDFSpread, (int)(atlas->Fonts.find(cfg.DstFont) - atlas->Fonts.Data) };
+        const float cfg_floats[] = { cfg.SizePixels, cfg.GlyphExtraSpacing.x, cfg.GlyphExtraSpacing.y, cfg.GlyphOffset.x, cfg.GlyphOffset.y, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX, cfg.RasterizerMultiply };
+        const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
+        int ranges_count = 0;
+        while (ranges[ranges_count] && ranges[ranges_count + 1])
+            ranges_count += 2;
+        key = ImHashData(cfg_ints, sizeof(cfg_ints), key);
+        key = ImHashData(cfg_floats, sizeof(cfg_floats), key);
+        key = ImHashData(ranges, sizeof(ImWchar) * ranges_count, key);
+        key = ImHashData(cfg.FontData, (size_t)cfg.FontDataSize, key);
+    }
+    for (int rect_i = 0; rect_i < atlas->CustomRects.Size; rect_i++)
+    {
+        const ImFontAtlasCustomRect& r = atlas->CustomRects[rect_i];
+        const int rect_ints[] = { r.Width, r.Height, (int)r.GlyphID, r.Font ? (int)(atlas->Fonts.find(r.Font) - atlas->Fonts.Data) : -1 };
+        const float rect_floats[] = { r.GlyphAdvanceX, r.GlyphOffset.x, r.GlyphOffset.y };
+        key = ImHashData(rect_ints, sizeof(rect_ints), key);
+        key = ImHashData(rect_floats, sizeof(rect_floats), key);
+    }
+    return key;
+}
+
+bool    ImFontAtlas::SaveCacheToMemory(ImVector<unsigned char>* out_data)
+{
+    out_data->resize(0);
+    if (!IsBuilt() || TexPixelsAlpha8 == NULL || ConfigData.empty()) // Need the input data for the key and the Alpha8 texture (don't call ClearInputData() or ClearTexData() before saving)
+        return false;
+
+    const ImU32 header[] = { FONT_ATLAS_CACHE_MAGIC, FONT_ATLAS_CACHE_VERSION, ImFontAtlasCalcCacheKey(this) };
+    const int tex_size[] = { TexWidth, TexHeight };
+    ImFontAtlasCacheWrite(out_data, header, sizeof(header));
+    ImFontAtlasCacheWrite(out_data, tex_size, sizeof(tex_size));
+    ImFontAtlasCacheWrite(out_data, &TexUvWhitePixel, sizeof(TexUvWhitePixel));
+    ImFontAtlasCacheWrite(out_data, TexUvLines, sizeof(TexUvLines));
+    ImFontAtlasCacheWrite(out_data, TexUvRoundCornerFilled, sizeof(TexUvRoundCornerFilled));
+    ImFontAtlasCacheWrite(out_data, TexUvRoundCornerStroked, sizeof(TexUvRoundCornerStroked));
+    for (int rect_i = 0; rect_i < CustomRects.Size; rect_i++)
+    {
+        const unsigned short rect_pos[] = { CustomRects[rect_i].X, CustomRects[rect_i].Y };
+        ImFontAtlasCacheWrite(out_data, rect_pos, sizeof(rect_pos));
+    }
+    for (int font_i = 0; font_i < Fonts.Size; font_i++)
+    {
+        const ImFont* font = Fonts[font_i];
+        ImFontAtlasCacheFont cache_font;
+        memset(&cache_font, 0, sizeof(cache_font));
+        cache_font.Ascent = font->Ascent;
+        cache_font.Descent = font->Descent;
+        cache_font.ConfigDataCount = font->IsLoaded() ? font->ConfigDataCount : 0;
+        cache_font.EllipsisChar = (int)font->EllipsisChar;
+        cache_font.MetricsTotalSurface = font->MetricsTotalSurface;
+        cache_font.GlyphsCount = font->Glyphs.Size;
+        cache_font.SDF = font->SDF;
+        ImFontAtlasCacheWrite(out_data, &cache_font, sizeof(cache_font));
+        ImFontAtlasCacheWrite(out_data, font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes());
+    }
+    const int dynamic_count = DynamicGlyphs.Size;
+    ImFontAtlasCacheWrite(out_data, &dynamic_count, sizeof(dynamic_count));
+    for (int n = 0; n < DynamicGlyphs.Size; n++)
+    {
+        const ImFontDynamicGlyphs* dynamic_glyphs = DynamicGlyphs[n];
+        ImFontAtlasCacheDynamicGlyphs cache_dynamic_glyphs;
+        cache_dynamic_glyphs.ConfigIndex = dynamic_glyphs->ConfigIndex;
+        cache_dynamic_glyphs.GlyphsOffset = dynamic_glyphs->GlyphsOffset;
+        cache_dynamic_glyphs.GlyphsCount = dynamic_glyphs->GlyphsCount;
+        cache_dynamic_glyphs.SlotsCount = dynamic_glyphs->SlotsGlyph.Size;
+        cache_dynamic_glyphs.SlotsX = dynamic_glyphs->SlotsX;
+        cache_dynamic_glyphs.SlotsY = dynamic_glyphs->SlotsY;
+        cache_dynamic_glyphs.SlotWidth = dynamic_glyphs->SlotWidth;
+        cache_dynamic_glyphs.SlotHeight = dynamic_glyphs->SlotHeight;
+        cache_dynamic_glyphs.SlotsPerRow = dynamic_glyphs->SlotsPerRow;
+        ImFontAtlasCacheWrite(out_data, &cache_dynamic_glyphs, sizeof(cache_dynamic_glyphs));
+    }
+    ImFontAtlasCacheWrite(out_data, TexPixelsAlpha8, (size_t)TexWidth * TexHeight);
+    return true;
+}
+
+bool    ImFontAtlas::SaveCacheToDisk(const char* filename)
+{
+    ImVector<unsigned char> data;
+    if (!SaveCacheToMemory(&data))
+        return false;
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    const bool ret = ImFileWrite(data.Data, 1, (ImU64)data.Size, f) == (ImU64)data.Size;
+    ImFileClose(f);
+    return ret;
+}
+
+bool    ImFontAtlas::LoadCacheFromMemory(const void* data, size_t data_size)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    if (ConfigData.empty())
+        AddFontDefault();
+    ImFontAtlasBuildInit(this);
+
+    // Validate everything before modifying the atlas, so a mismatching or truncated cache leaves it ready for Build()
+    ImFontAtlasCacheReader reader(data, data_size);
+    ImU32 header[3];
+    if (!reader.Read(header, sizeof(header)) || header[0] != FONT_ATLAS_CACHE_MAGIC || header[1] != FONT_ATLAS_CACHE_VERSION || header[2] != ImFontAtlasCalcCacheKey(this))
+        return false;
+    int tex_size[2];
+    if (!reader.Read(tex_size, sizeof(tex_size)) || tex_size[0] <= 0 || tex_size[1] <= 0 || tex_size[0] > 0x8000 || tex_size[1] > 0x8000)
+        return false;
+    const void* uv_white_pixel = reader.Read(sizeof(TexUvWhitePixel));
+    const void* uv_lines = reader.Read(sizeof(TexUvLines));
+    const void* uv_round_corner_filled = reader.Read(sizeof(TexUvRoundCornerFilled));
+    const void* uv_round_corner_stroked = reader.Read(sizeof(TexUvRoundCornerStroked));
+    const void* rects_pos = reader.Read(sizeof(unsigned short) * 2 * CustomRects.Size);
+    if (uv_white_pixel == NULL || uv_lines == NULL || uv_round_corner_filled == NULL || uv_round_corner_stroked == NULL || rects_pos == NULL)
+        return false;
+    for (int rect_i = 0; rect_i < CustomRects.Size; rect_i++)
+    {
+        unsigned short rect_pos[2];
+        memcpy(rect_pos, (const unsigned short*)rects_pos + rect_i * 2, sizeof(rect_pos));
+        if (rect_pos[0] + CustomRects[rect_i].Width > tex_size[0] || rect_pos[1] + CustomRects[rect_i].Height > tex_size[1])
+            return false;
+    }
+    ImVector<ImFontAtlasCacheFont> cache_fonts;
+    ImVector<const void*> cache_fonts_glyphs;
+    cache_fonts.resize(Fonts.Size);
+    cache_fonts_glyphs.resize(Fonts.Size);
+    for (int font_i = 0; font_i < Fonts.Size; font_i++)
+    {
+        const ImFontAtlasCacheFont& cache_font = cache_fonts[font_i];
+        if (!reader.Read(&cache_fonts[font_i], sizeof(ImFontAtlasCacheFont)) || cache_font.GlyphsCount < 0 || cache_font.GlyphsCount >= 0xFFFF)
+            return false;
+        if ((cache_fonts_glyphs[font_i] = reader.Read(sizeof(ImFontGlyph) * cache_font.GlyphsCount)) == NULL)
+            return false;
+    }
+    int dynamic_count = 0;
+    if (!reader.Read(&dynamic_count, sizeof(dynamic_count)) || dynamic_count < 0 || dynamic_count > ConfigData.Size)
+        return false;
+    ImVector<ImFontAtlasCacheDynamicGlyphs> cache_dynamic_glyphs;
+    ImVector<stbtt_fontinfo> cache_dynamic_font_infos;
+    cache_dynamic_glyphs.resize(dynamic_count);
+    cache_dynamic_font_infos.resize(dynamic_count);
+    for (int n = 0; n < dynamic_count; n++)
+    {
+        const ImFontAtlasCacheDynamicGlyphs& dg = cache_dynamic_glyphs[n];
+        if (!reader.Read(&cache_dynamic_glyphs[n], sizeof(ImFontAtlasCacheDynamicGlyphs)) || dg.ConfigIndex < 0 || dg.ConfigIndex >= ConfigData.Size || !ConfigData[dg.ConfigIndex].DynamicGlyphs)
+            return false;
+        const int font_i = (int)(Fonts.find(ConfigData[dg.ConfigIndex].DstFont) - Fonts.Data);
+        if (font_i >= Fonts.Size || dg.GlyphsOffset < 0 || dg.GlyphsCount < 0 || dg.GlyphsOffset > cache_fonts[font_i].GlyphsCount - dg.GlyphsCount)
+            return false;
+
+        // Slots are laid out in rows of SlotsPerRow slots starting at (SlotsX, SlotsY), they need to be within the texture
+        if (dg.SlotsCount <= 0 || dg.SlotsPerRow <= 0 || dg.SlotWidth <= 0 || dg.SlotHeight <= 0 || dg.SlotsX < 0 || dg.SlotsY < 0)
+            return false;
+        const ImS64 slots_rows = (dg.SlotsCount + dg.SlotsPerRow - 1) / dg.SlotsPerRow;
+        if (dg.SlotsX + (ImS64)dg.SlotsPerRow * dg.SlotWidth > tex_size[0] || dg.SlotsY + slots_rows * dg.SlotHeight > tex_size[1])
+            return false;
+
+        // Glyphs rasterized on demand need the stb_truetype font info back
+        const ImFontConfig& cfg = ConfigData[dg.ConfigIndex];
+        const int font_offset = stbtt_GetFontOffsetForIndex((unsigned char*)cfg.FontData, cfg.FontNo);
+        if (font_offset < 0 || !stbtt_InitFont(&cache_dynamic_font_infos[n], (unsigned char*)cfg.FontData, font_offset))
+            return false;
+    }
+    for (int font_i = 0; font_i < Fonts.Size; font_i++)
+        for (int glyph_i = 0; glyph_i < cache_fonts[font_i].GlyphsCount; glyph_i++)
+        {
+            ImFontGlyph glyph;
+            memcpy(&glyph, (const ImFontGlyph*)cache_fonts_glyphs[font_i] + glyph_i, sizeof(glyph));
+            if (!ImFontAtlasCacheValidateGlyph(glyph))
+                return false;
+        }
+    const void* tex_pixels = reader.Read((size_t)tex_size[0] * tex_size[1]);
+    if (tex_pixels == NULL || reader.Data != reader.DataEnd)
+        return false;
+
+    // Restore texture (same as the start of ImFontAtlasBuildWithStbTruetype())
+    TexID = (ImTextureID)NULL;
+    TexIDSDF = (ImTextureID)NULL;
+    ImFontAtlasClearDynamicGlyphs(this);
+    ClearTexData();
+    TexWidth = tex_size[0];
+    TexHeight = tex_size[1];
+    TexUvScale = ImVec2(1.0f / TexWidth, 1.0f / TexHeight);
+    memcpy(&TexUvWhitePixel, uv_white_pixel, sizeof(TexUvWhitePixel));
+    memcpy(TexUvLines, uv_lines, sizeof(TexUvLines));
+    memcpy(TexUvRoundCornerFilled, uv_round_corner_filled, sizeof(TexUvRoundCornerFilled));
+    memcpy(TexUvRoundCornerStroked, uv_round_corner_stroked, sizeof(TexUvRoundCornerStroked));
+    TexPixelsAlpha8 = (unsigned char*)IM_ALLOC((size_t)TexWidth * TexHeight);
+    memcpy(TexPixelsAlpha8, tex_pixels, (size_t)TexWidth * TexHeight);
+    const unsigned short* rect_pos = (const unsigned short*)rects_pos;
+    for (int rect_i = 0; rect_i < CustomRects.Size; rect_i++, rect_pos += 2)
+    {
+        CustomRects[rect_i].X = rect_pos[0];
+        CustomRects[rect_i].Y = rect_pos[1];
+    }
+
+    // Restore fonts (same as ImFontAtlasBuildSetupFont() + AddGlyph() calls + ImFontAtlasBuildFinish())
+    for (int cfg_i = 0; cfg_i < ConfigData.Size; cfg_i++)
+    {
+        ImFontConfig& cfg = ConfigData[cfg_i];
+        const ImFontAtlasCacheFont& cache_font = cache_fonts[Fonts.index_from_ptr(Fonts.find(cfg.DstFont))];
+        if (cache_font.ConfigDataCount > 0)
+            ImFontAtlasBuildSetupFont(this, cfg.DstFont, &cfg, cache_font.Ascent, cache_font.Descent);
+    }
+    for (int font_i = 0; font_i < Fonts.Size; font_i++)
+    {
+        ImFont* font = Fonts[font_i];
+        const ImFontAtlasCacheFont& cache_font = cache_fonts[font_i];
+        if (cache_font.ConfigDataCount == 0)
+            continue;
+        font->Glyphs.resize(cache_font.GlyphsCount);
+        if (cache_font.GlyphsCount > 0)
+            memcpy(font->Glyphs.Data, cache_fonts_glyphs[font_i], sizeof(ImFontGlyph) * cache_font.GlyphsCount);
+        font->EllipsisChar = (ImWchar)cache_font.EllipsisChar;
+        font->MetricsTotalSurface = cache_font.MetricsTotalSurface;
+        font->SDF = (cache_font.SDF != 0);
+        font->BuildLookupTable();
+    }
+
+    // Glyphs rasterized on demand start with empty slots
+    for (int n = 0; n < cache_dynamic_glyphs.Size; n++)
+    {
+        const ImFontAtlasCacheDynamicGlyphs& dg = cache_dynamic_glyphs[n];
+        ImFontAtlasBuildAddDynamicGlyphs(this, dg.ConfigIndex, &cache_dynamic_font_infos[n], dg.GlyphsOffset, dg.GlyphsCount, dg.SlotsCount, dg.SlotsX, dg.SlotsY, dg.SlotWidth, dg.SlotHeight, dg.SlotsPerRow);
+    }
+    return true;
+}
+
+bool    ImFontAtlas::LoadCacheFromDisk(const char* filename)
+{
+    size_t data_size = 0;
+    void* data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
+    if (!data)
+        return false;
+    const bool ret = LoadCacheFromMemory(data, data_size);
+    IM_FREE(data);
+    return ret;
+}
+
 // Retrieve list of range (2 int per range, values are inclusive)
 const ImWchar*   ImFontAtlas::GetGlyphRangesDefault()
 {
@@ -2773,6 +4756,7 @@ ImFont::ImFont()
     ConfigData = NULL;
     ConfigDataCount = 0;
     DirtyLookupTables = false;
+    SDF = false;
     Scale = 1.0f;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
@@ -2791,37 +4775,75 @@ void    ImFont::ClearOutputData()
     Glyphs.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    IndexPages.clear();
+    IndexPagesLookup.clear();
+    IndexPagesAdvanceX.clear();
     FallbackGlyph = NULL;
     ContainerAtlas = NULL;
     DirtyLookupTables = true;
+    SDF = false;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
 }
 
+// Codepoints of the first 4K page are indexed directly by IndexLookup/IndexAdvanceX.
+// Above it, IndexPages maps each 4K page to 4096 entries in IndexPagesLookup/IndexPagesAdvanceX, only allocated for pages marked in
+// Used4kPagesMap. This keeps the index small for fonts with a few glyphs far from the others (e.g. emojis at U+1F600 with ImWchar32).
+// Return the offset of a codepoint in IndexPagesLookup/IndexPagesAdvanceX, or -1 if it isn't in an indexed page.
+static inline int ImFontIndexPagedOffset(const ImFont* font, unsigned int c)
+{
+    const unsigned int page_n = c / 4096;
+    if (page_n >= (unsigned int)font->IndexPages.Size || font->IndexPages.Data[page_n] == -1)
+        return -1;
+    return font->IndexPages.Data[page_n] + (int)(c & 4095);
+}
+
+static void ImFontSetIndex(ImFont* font, unsigned int c, ImWchar glyph_index, float advance_x)
+{
+    if (c < (unsigned int)font->IndexLookup.Size)
+    {
+        font->IndexLookup.Data[c] = glyph_index;
+        font->IndexAdvanceX.Data[c] = advance_x;
+        return;
+    }
+    const int offset = ImFontIndexPagedOffset(font, c);
+    IM_ASSERT(offset != -1);
+    font->IndexPagesLookup.Data[offset] = glyph_index;
+    font->IndexPagesAdvanceX.Data[offset] = advance_x;
+}
+
 void ImFont::BuildLookupTable()
 {
     int max_codepoint = 0;
     for (int i = 0; i != Glyphs.Size; i++)
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
 
-    // Build lookup table
-    IM_ASSERT(Glyphs.Size < 0xFFFF); // -1 is reserved
-    IndexAdvanceX.clear();
-    IndexLookup.clear();
+    // Mark 4K pages as used
+    int max_codepoint_first_page = 0;
     DirtyLookupTables = false;
     memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
-    GrowIndex(max_codepoint + 1);
     for (int i = 0; i < Glyphs.Size; i++)
     {
-        int codepoint = (int)Glyphs[i].Codepoint;
-        IndexAdvanceX[codepoint] = Glyphs[i].AdvanceX;
-        IndexLookup[codepoint] = (ImWchar)i;
-
-        // Mark 4K page as used
-        const int page_n = codepoint / 4096;
+        const int page_n = (int)Glyphs[i].Codepoint / 4096;
         Used4kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
+        if (page_n == 0)
+            max_codepoint_first_page = ImMax(max_codepoint_first_page, (int)Glyphs[i].Codepoint);
     }
 
+    // Build lookup table: the first 4K page up to the highest codepoint in it, then the used pages above it
+    IM_ASSERT(Glyphs.Size < 0xFFFF); // -1 is reserved
+    IndexAdvanceX.clear();
+    IndexLookup.clear();
+    IndexPages.clear();
+    IndexPagesLookup.clear();
+    IndexPagesAdvanceX.clear();
+    GrowIndex(max_codepoint_first_page + 1);
+    for (int page_n = 1; page_n <= max_codepoint / 4096; page_n++)
+        if (Used4kPagesMap[page_n >> 3] & (1 << (page_n & 7)))
+            AddIndexPage(page_n);
+    for (int i = 0; i < Glyphs.Size; i++)
+        ImFontSetIndex(this, Glyphs[i].Codepoint, (ImWchar)i, Glyphs[i].AdvanceX);
+
     // Create a glyph to handle TAB
     // FIXME: Needs proper TAB handling but it needs to be contextualized (or we could arbitrary say that each string starts at "column 0" ?)
     if (FindGlyph((ImWchar)' '))
@@ -2832,8 +4854,7 @@ void ImFont::BuildLookupTable()
         tab_glyph = *FindGlyph((ImWchar)' ');
         tab_glyph.Codepoint = '\t';
         tab_glyph.AdvanceX *= IM_TABSIZE;
-        IndexAdvanceX[(int)tab_glyph.Codepoint] = (float)tab_glyph.AdvanceX;
-        IndexLookup[(int)tab_glyph.Codepoint] = (ImWchar)(Glyphs.Size - 1);
+        ImFontSetIndex(this, tab_glyph.Codepoint, (ImWchar)(Glyphs.Size - 1), tab_glyph.AdvanceX);
     }
 
     // Mark special glyphs as not visible (note that AddGlyph already mark as non-visible glyphs with zero-size polygons)
@@ -2843,9 +4864,12 @@ void ImFont::BuildLookupTable()
     // Setup fall-backs
     FallbackGlyph = FindGlyphNoFallback(FallbackChar);
     FallbackAdvanceX = FallbackGlyph ? FallbackGlyph->AdvanceX : 0.0f;
-    for (int i = 0; i < max_codepoint + 1; i++)
-        if (IndexAdvanceX[i] < 0.0f)
-            IndexAdvanceX[i] = FallbackAdvanceX;
+    for (int i = 0; i < IndexAdvanceX.Size; i++)
+        if (IndexAdvanceX.Data[i] < 0.0f)
+            IndexAdvanceX.Data[i] = FallbackAdvanceX;
+    for (int i = 0; i < IndexPagesAdvanceX.Size; i++)
+        if (IndexPagesAdvanceX.Data[i] < 0.0f)
+            IndexPagesAdvanceX.Data[i] = FallbackAdvanceX;
 }
 
 // API is designed this way to avoid exposing the 4K page size
@@ -2876,12 +4900,39 @@ void ImFont::SetFallbackChar(ImWchar c)
 void ImFont::GrowIndex(int new_size)
 {
     IM_ASSERT(IndexAdvanceX.Size == IndexLookup.Size);
+    IM_ASSERT(new_size <= 4096); // Codepoints above the first 4K page are indexed with AddIndexPage()
     if (new_size <= IndexLookup.Size)
         return;
     IndexAdvanceX.resize(new_size, -1.0f);
     IndexLookup.resize(new_size, (ImWchar)-1);
 }
 
+int ImFont::AddIndexPage(int page_n)
+{
+    IM_ASSERT(IndexPagesAdvanceX.Size == IndexPagesLookup.Size);
+    IM_ASSERT(page_n > 0 && page_n <= IM_UNICODE_CODEPOINT_MAX / 4096);
+    if (page_n >= IndexPages.Size)
+        IndexPages.resize(page_n + 1, -1);
+    if (IndexPages[page_n] != -1)
+        return IndexPages[page_n];
+    const int offset = IndexPagesLookup.Size;
+    IndexPages[page_n] = offset;
+    IndexPagesAdvanceX.resize(offset + 4096, -1.0f);
+    IndexPagesLookup.resize(offset + 4096, (ImWchar)-1);
+    return offset;
+}
+
+float ImFont::GetCharAdvancePaged(ImWchar c) const
+{
+    const int offset = ImFontIndexPagedOffset(this, c);
+    return (offset != -1) ? IndexPagesAdvanceX.Data[offset] : FallbackAdvanceX;
+}
+
+int ImFont::GetIndexMemoryUsage() const
+{
+    return IndexLookup.size_in_bytes() + IndexAdvanceX.size_in_bytes() + IndexPages.size_in_bytes() + IndexPagesLookup.size_in_bytes() + IndexPagesAdvanceX.size_in_bytes();
+}
+
 // x0/y0/x1/y1 are offset from the character upper-left layout position, in pixels. Therefore x0/y0 are often fairly close to zero.
 // Not to be mistaken with texture coordinates, which are held by u0/v0/u1/v1 in normalized format (0.0..1.0 on each texture axis).
 // 'cfg' is not necessarily == 'this->ConfigData' because multiple source fonts+configs can be used to build one target font.
@@ -2911,6 +4962,7 @@ void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, floa
     ImFontGlyph& glyph = Glyphs.back();
     glyph.Codepoint = (unsigned int)codepoint;
     glyph.Visible = (x0 != x1) && (y0 != y1);
+    glyph.Dynamic = 0;
     glyph.X0 = x0;
     glyph.Y0 = y0;
     glyph.X1 = x1;
@@ -2931,23 +4983,40 @@ void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, floa
 void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 {
     IM_ASSERT(IndexLookup.Size > 0);    // Currently this can only be called AFTER the font has been built, aka after calling ImFontAtlas::GetTexDataAs*() function.
-    unsigned int index_size = (unsigned int)IndexLookup.Size;
+    const int dst_offset = (dst < (unsigned int)IndexLookup.Size) ? -1 : ImFontIndexPagedOffset(this, dst);
+    const int src_offset = (src < (unsigned int)IndexLookup.Size) ? -1 : ImFontIndexPagedOffset(this, src);
+    const bool dst_exists = (dst < (unsigned int)IndexLookup.Size) || dst_offset != -1;
+    const bool src_exists = (src < (unsigned int)IndexLookup.Size) || src_offset != -1;
+    const ImWchar dst_lookup = !dst_exists ? (ImWchar)-1 : (dst_offset == -1) ? IndexLookup.Data[dst] : IndexPagesLookup.Data[dst_offset];
 
-    if (dst < index_size && IndexLookup.Data[dst] == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
+    if (dst_exists && dst_lookup == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
         return;
-    if (src >= index_size && dst >= index_size) // both 'dst' and 'src' don't exist -> no-op
+    if (!src_exists && !dst_exists) // both 'dst' and 'src' don't exist -> no-op
         return;
 
-    GrowIndex(dst + 1);
-    IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImWchar)-1;
-    IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
+    const ImWchar src_lookup = !src_exists ? (ImWchar)-1 : (src_offset == -1) ? IndexLookup.Data[src] : IndexPagesLookup.Data[src_offset];
+    const float src_advance_x = !src_exists ? 1.0f : (src_offset == -1) ? IndexAdvanceX.Data[src] : IndexPagesAdvanceX.Data[src_offset];
+    if (dst < 4096)
+        GrowIndex(dst + 1);
+    else
+        AddIndexPage(dst / 4096);
+    ImFontSetIndex(this, dst, src_lookup, src_advance_x);
 }
 
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
 {
-    if (c >= (size_t)IndexLookup.Size)
-        return FallbackGlyph;
-    const ImWchar i = IndexLookup.Data[c];
+    ImWchar i;
+    if (c < (size_t)IndexLookup.Size)
+    {
+        i = IndexLookup.Data[c];
+    }
+    else
+    {
+        const int offset = ImFontIndexPagedOffset(this, c);
+        if (offset == -1)
+            return FallbackGlyph;
+        i = IndexPagesLookup.Data[offset];
+    }
     if (i == (ImWchar)-1)
         return FallbackGlyph;
     return &Glyphs.Data[i];
@@ -2955,9 +5024,18 @@ const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
 
 const ImFontGlyph* ImFont::FindGlyphNoFallback(ImWchar c) const
 {
-    if (c >= (size_t)IndexLookup.Size)
-        return NULL;
-    const ImWchar i = IndexLookup.Data[c];
+    ImWchar i;
+    if (c < (size_t)IndexLookup.Size)
+    {
+        i = IndexLookup.Data[c];
+    }
+    else
+    {
+        const int offset = ImFontIndexPagedOffset(this, c);
+        if (offset == -1)
+            return NULL;
+        i = IndexPagesLookup.Data[offset];
+    }
     if (i == (ImWchar)-1)
         return NULL;
     return &Glyphs.Data[i];
@@ -3017,7 +5095,7 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
             }
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX);
+        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : GetCharAdvancePaged((ImWchar)c));
         if (ImCharIsBlankW(c))
         {
             if (inside_word)
@@ -3134,7 +5212,7 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
                 continue;
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX) * scale;
+        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : GetCharAdvancePaged((ImWchar)c)) * scale;
         if (line_width + char_width >= max_width)
         {
             s = prev_s;
@@ -3161,11 +5239,19 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     const ImFontGlyph* glyph = FindGlyph(c);
     if (!glyph || !glyph->Visible)
         return;
+    if (glyph->Dynamic && !ImFontAtlasUseDynamicGlyph(ContainerAtlas, this, glyph, draw_list))
+        return;
     float scale = (size >= 0.0f) ? (size / FontSize) : 1.0f;
     pos.x = IM_FLOOR(pos.x);
     pos.y = IM_FLOOR(pos.y);
+    const ImTextureID tex_id = GetTexID();
+    const bool push_tex_id = (tex_id != draw_list->_CmdHeader.TextureId); // See RenderText()
+    if (push_tex_id)
+        draw_list->PushTextureID(tex_id);
     draw_list->PrimReserve(6, 4);
     draw_list->PrimRectUV(ImVec2(pos.x + glyph->X0 * scale, pos.y + glyph->Y0 * scale), ImVec2(pos.x + glyph->X1 * scale, pos.y + glyph->Y1 * scale), ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
+    if (push_tex_id)
+        draw_list->PopTextureID();
 }
 
 void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip) const
@@ -3213,6 +5299,13 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     if (s == text_end)
         return;
 
+    // Distance field fonts (ImFontConfig::SDF) are drawn with ImFontAtlas::TexIDSDF for the duration of the text only,
+    // other shapes using the font texture (white pixel, baked lines and corners) keep TexID and the regular shader.
+    const ImTextureID tex_id = GetTexID();
+    const bool push_tex_id = (tex_id != draw_list->_CmdHeader.TextureId);
+    if (push_tex_id)
+        draw_list->PushTextureID(tex_id);
+
     // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
     const int vtx_count_max = (int)(text_end - s) * 4;
     const int idx_count_max = (int)(text_end - s) * 6;
@@ -3292,6 +5385,13 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
             float y2 = y + glyph->Y1 * scale;
             if (x1 <= clip_rect.z && x2 >= clip_rect.x)
             {
+                // Rasterize glyph on demand
+                if (glyph->Dynamic && !ImFontAtlasUseDynamicGlyph(ContainerAtlas, this, glyph, draw_list))
+                {
+                    x += char_width;
+                    continue;
+                }
+
                 // Render a character
                 float u1 = glyph->U0;
                 float v1 = glyph->V0;
@@ -3332,10 +5432,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                 {
                     idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
                     idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
-                    vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
-                    vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
-                    vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
-                    vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                    ImDrawVertWriteRect(vtx_write, ImVec2(x1, y1), ImVec2(x2, y2), ImVec2(u1, v1), ImVec2(u2, v2), col);
                     vtx_write += 4;
                     vtx_current_idx += 4;
                     idx_write += 6;
@@ -3352,6 +5449,8 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     draw_list->_VtxWritePtr = vtx_write;
     draw_list->_IdxWritePtr = idx_write;
     draw_list->_VtxCurrentIdx = vtx_current_idx;
+    if (push_tex_id)
+        draw_list->PopTextureID();
 }
 
 //-----------------------------------------------------------------------------
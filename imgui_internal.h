@@ -74,6 +74,18 @@ Index of this file:
 #pragma GCC diagnostic ignored "-Wclass-memaccess"      // [__GNUC__ >= 8] warning: 'memset/memcpy' clearing/writing an object of type 'xxxx' with no trivial copy-assignment; use assignment or value-initialization instead
 #endif
 
+// Enable SIMD intrinsics if available (SSE2 on x86/x64, NEON on AArch64). Disable with IMGUI_DISABLE_SIMD in imconfig.h.
+// Code paths using them always keep a scalar fallback, and both must produce the same output.
+#ifndef IMGUI_DISABLE_SIMD
+#if defined(__SSE2__) || defined(__x86_64__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define IMGUI_ENABLE_SSE
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
 // Legacy defines
 #ifdef IMGUI_DISABLE_FORMAT_STRING_FUNCTIONS            // Renamed in 1.74
 #error Use IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS
@@ -88,6 +100,7 @@ Index of this file:
 
 struct ImBitVector;                 // Store 1-bit per value
 struct ImRect;                      // An axis-aligned rectangle (2 points)
+struct ImDrawCmdReorderBatch;       // Temporary data to reorder draw commands by texture
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
 struct ImGuiColorMod;               // Stacked color modifier, backup of modified data so we can restore it
@@ -388,8 +401,9 @@ static inline ImVec2 ImMul(const ImVec2& lhs, const ImVec2& rhs)
 
 // Helpers: Geometry
 IMGUI_API ImVec2     ImBezierCalc(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, float t);                                         // Cubic Bezier
+IMGUI_API ImVec2     ImBezierQuadraticCalc(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, float t);                                                   // Quadratic Bezier
 IMGUI_API ImVec2     ImBezierClosestPoint(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, const ImVec2& p, int num_segments);       // For curves with explicit number of segments
-IMGUI_API ImVec2     ImBezierClosestPointCasteljau(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, const ImVec2& p, float tess_tol);// For auto-tessellated curves you can use tess_tol = style.CurveTessellationTol
+IMGUI_API ImVec2     ImBezierClosestPointCasteljau(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, const ImVec2& p, float tess_tol);// For auto-tessellated curves you can use tess_tol = style.CurveTessellationTol (same segments as PathBezierCurveTo())
 IMGUI_API ImVec2     ImLineClosestPoint(const ImVec2& a, const ImVec2& b, const ImVec2& p);
 IMGUI_API bool       ImTriangleContainsPoint(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& p);
 IMGUI_API ImVec2     ImTriangleClosestPoint(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& p);
@@ -537,6 +551,12 @@ struct IMGUI_API ImChunkStream
 #define IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX                     512
 #define IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC(_RAD,_MAXERROR)    ImClamp((int)((IM_PI * 2.0f) / ImAcos(((_RAD) - (_MAXERROR)) / (_RAD))), IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MIN, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX)
 
+// ImDrawList: Helper function to calculate a Bezier curve's segment count given the length of its largest second difference
+// (|p1 - 2*p2 + p3| for cubic curves, a third of it for quadratic curves) and a "maximum error" value. See PathBezierCurveTo().
+// The length is rounded up to the next integer, so that segment counts can be cached per integer length (see ImDrawListSharedData::CurveSegmentCounts).
+#define IM_DRAWLIST_CURVE_AUTO_SEGMENT_MAX                      1024
+#define IM_DRAWLIST_CURVE_AUTO_SEGMENT_CALC(_LEN,_MAXERROR)     ((int)ImClamp(ImCeil(ImSqrt(0.75f * (ImFloorStd(_LEN) + 1.0f) / (_MAXERROR))), 1.0f, (float)IM_DRAWLIST_CURVE_AUTO_SEGMENT_MAX))
+
 // ImDrawList: You may set this to higher values (e.g. 2 or 3) to increase tessellation of fast rounded corners path.
 #ifndef IM_DRAWLIST_ARCFAST_TESSELLATION_MULTIPLIER
 #define IM_DRAWLIST_ARCFAST_TESSELLATION_MULTIPLIER             1
@@ -555,12 +575,35 @@ struct IMGUI_API ImDrawListSharedData
     ImDrawListFlags InitialFlags;               // Initial flags at the beginning of the frame (it is possible to alter flags on a per-drawlist basis afterwards)
 
     // [Internal] Lookup tables
-    ImVec2          ArcFastVtx[12 * IM_DRAWLIST_ARCFAST_TESSELLATION_MULTIPLIER];  // FIXME: Bake rounded corners fill/borders in atlas
-    ImU8            CircleSegmentCounts[64];    // Precomputed segment count for given radius (array index + 1) before we calculate it dynamically (to avoid calculation overhead)
+    ImVec2          ArcFastVtx[12 * IM_DRAWLIST_ARCFAST_TESSELLATION_MULTIPLIER];  // Sample points on the unit circle, for rounded shapes which cannot use baked corners
+    ImU16           CircleSegmentCounts[2048];  // Precomputed segment count for given radius (array index + 1) before we calculate it dynamically (to avoid calculation overhead)
+    ImVec2          CircleSegmentSteps[IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX + 1]; // Rotation (cos, sin) between two points of a circle with a given segment count (array index), to generate circles without trigonometry
+    float           CurveFlattenMaxError;       // Maximum distance (in pixels) between an auto-tessellated curve and its polyline, set by SetCurveTessellationTol() or on first use
+    ImU16           CurveSegmentCounts[256];    // Precomputed segment count for a given curve second difference length (array index, rounded down), see IM_DRAWLIST_CURVE_AUTO_SEGMENT_CALC()
     const ImVec4*   TexUvLines;                 // UV of anti-aliased lines in the atlas
+    const ImVec4*   TexUvRoundCornerFilled;     // UV of anti-aliased filled rounded corners in the atlas, indexed by radius
+    const ImVec4*   TexUvRoundCornerStroked;    // UV of anti-aliased 1 pixel thick rounded corners in the atlas, indexed by radius
 
     ImDrawListSharedData();
     void SetCircleSegmentMaxError(float max_error);
+    void SetCurveTessellationTol(float tol);
+};
+
+// Storage for one ImDrawData snapshot of ImDrawDataSnapshotRing.
+// Draw lists are kept across frames and matched to their source draw list, so that swapped buffers keep a matching capacity.
+struct IMGUI_API ImDrawDataSnapshot
+{
+    ImDrawData                  DrawData;       // Returned by ImDrawDataSnapshotRing::Snap(), DrawData.CmdLists points to CmdLists.Data
+    ImVector<ImDrawList*>       CmdLists;       // Draw lists to render, in order
+    ImVector<ImVec4>            DirtyRects;     // Copy of ImDrawData::DirtyRects, DrawData.DirtyRects points to DirtyRects.Data
+    ImVector<ImDrawList*>       Lists;          // All draw lists owned by this snapshot
+    ImVector<const ImDrawList*> ListsSource;    // Source draw list of Lists[n]
+    ImVector<int>               ListsLastSnap;  // ImDrawDataSnapshotRing::SnapCount when Lists[n] was last used
+    ImGuiStorage                ListsMap;       // Hash of source draw list pointer -> index in Lists[] + 1
+
+    ImDrawDataSnapshot()        { }
+    ~ImDrawDataSnapshot()       { ClearFreeMemory(); }
+    void ClearFreeMemory();
 };
 
 struct ImDrawDataBuilder
@@ -570,6 +613,29 @@ struct ImDrawDataBuilder
     void Clear()            { for (int n = 0; n < IM_ARRAYSIZE(Layers); n++) Layers[n].resize(0); }
     void ClearFreeMemory()  { for (int n = 0; n < IM_ARRAYSIZE(Layers); n++) Layers[n].clear(); }
     IMGUI_API void FlattenIntoSingleLayer();
+    IMGUI_API bool MergeIntoSingleDrawList(ImDrawList* merged_list, bool allow_vtx_offset);
+};
+
+// Output command of ReorderDrawCmds(), gathering commands using the same texture (io.ConfigReorderDrawCmds)
+struct ImDrawCmdReorderBatch
+{
+    ImDrawCmd               Cmd;                // Merged command. ClipRect is the union of clip rectangles of commands when they are all unclipped.
+    ImRect                  Bounds;             // Area touched by the merged commands: commands drawn later which overlap it can't be moved before it
+    bool                    Unclipped;          // All vertices of the merged commands are inside their clip rectangle
+    unsigned int            IdxWrite;           // Write offset in the output index buffer
+};
+
+// State of a draw list output by Render(), compared with the previous frame to find which areas of the display changed (io.ConfigTrackDirtyRects)
+struct ImDrawListDirtyState
+{
+    const ImDrawList*       DrawList;
+    ImU64                   Hash;               // Hash of commands, indices and vertices
+    int                     VtxCount;           // Sizes of the buffers, compared along with the hash
+    int                     IdxCount;
+    int                     CmdCount;
+    ImRect                  Rect;               // Area which may be touched by the draw list: union of command clip rectangles, intersected with the bounding box of vertices
+    bool                    HasUserCallbacks;   // Draw list calls user callbacks, whose output is unknown: always dirty
+    bool                    Matched;            // Temporary: set when matched by a draw list of the next frame with the same hash, rendered in the same order
 };
 
 //-----------------------------------------------------------------------------
@@ -1279,12 +1345,28 @@ struct ImGuiContext
     int                     FocusRequestNextCounterTabStop;     // "
     bool                    FocusTabPressed;                    //
 
+    // Idle detection (io.MaxWaitBeforeNextFrame)
+    float                   MaxWaitBeforeNextFrame;             // Minimum of SetMaxWaitBeforeNextFrame() calls during the frame
+    int                     ActivityFramesLeft;                 // Frames to start without waiting after inputs or other activity, so the UI settles before idling
+
     // Render
     ImDrawData              DrawData;                           // Main ImDrawData instance to pass render information to the user
     ImDrawDataBuilder       DrawDataBuilder;
+    ImVector<ImRect>        DrawDataOccluders;                  // Temporary storage for CullOccludedDrawCmds() (io.ConfigOcclusionCulling)
+    ImVector<ImDrawCmdReorderBatch> DrawDataReorderBatches;     // Temporary storage for ReorderDrawCmds() (io.ConfigReorderDrawCmds)
+    ImVector<int>           DrawDataReorderCmdBatches;          // "
+    ImVector<ImDrawIdx>     DrawDataReorderIdxBuffer;           // "
+    ImVector<ImDrawListDirtyState> DrawDataDirtyStates;         // Draw lists rendered in the last frame (io.ConfigTrackDirtyRects)
+    ImVector<ImDrawListDirtyState> DrawDataDirtyStatesPrev;     // Draw lists rendered in the frame before
+    ImVector<ImVec4>        DrawDataDirtyRects;                 // Output storage for ImDrawData::DirtyRects
+    ImVector<ImRect>        DrawDataDirtyRectsUser;             // Areas passed to MarkDirtyRect() since the last Render()
+    ImRect                  DrawDataDirtyDisplayRect;           // Display rectangle of the last frame, a change invalidates the whole display
+    ImVec2                  DrawDataDirtyFramebufferScale;      // "
     float                   DimBgRatio;                         // 0.0..1.0 animation when fading in a dimming background (for modal window and CTRL+TAB list)
     ImDrawList              BackgroundDrawList;                 // First draw list to be rendered.
     ImDrawList              ForegroundDrawList;                 // Last draw list to be rendered. This is where we the render software mouse cursor (if io.MouseDrawCursor is set) and most debug overlays.
+    ImDrawList              MergedDrawList;                     // Output storage when all draw lists are merged into a single one (ImGuiBackendFlags_RendererMergeDrawLists).
+    ImDrawList              FrozenWindowsDrawList;              // Draw list of frozen windows between Begin() and End(), discarded: submissions never alter their retained draw list (ImGuiWindowFlags_FreezeWhenIdle).
     ImGuiMouseCursor        MouseCursor;
 
     // Drag and Drop
@@ -1370,7 +1452,7 @@ struct ImGuiContext
     int                     WantTextInputNextFrame;
     char                    TempBuffer[1024 * 3 + 1];           // Temporary text buffer
 
-    ImGuiContext(ImFontAtlas* shared_font_atlas) : BackgroundDrawList(&DrawListSharedData), ForegroundDrawList(&DrawListSharedData)
+    ImGuiContext(ImFontAtlas* shared_font_atlas) : BackgroundDrawList(&DrawListSharedData), ForegroundDrawList(&DrawListSharedData), MergedDrawList(&DrawListSharedData), FrozenWindowsDrawList(&DrawListSharedData)
     {
         Initialized = false;
         FontAtlasOwnedByContext = shared_font_atlas ? false : true;
@@ -1455,9 +1537,14 @@ struct ImGuiContext
         FocusRequestNextCounterRegular = FocusRequestNextCounterTabStop = INT_MAX;
         FocusTabPressed = false;
 
+        MaxWaitBeforeNextFrame = FLT_MAX;
+        ActivityFramesLeft = 0;
+
         DimBgRatio = 0.0f;
         BackgroundDrawList._OwnerName = "##Background"; // Give it a name for debugging
         ForegroundDrawList._OwnerName = "##Foreground"; // Give it a name for debugging
+        MergedDrawList._OwnerName = "##Merged"; // Give it a name for debugging
+        FrozenWindowsDrawList._OwnerName = "##FrozenWindows"; // Give it a name for debugging
         MouseCursor = ImGuiMouseCursor_Arrow;
 
         DragDropActive = DragDropWithinSource = DragDropWithinTarget = false;
@@ -1641,6 +1728,8 @@ struct IMGUI_API ImGuiWindow
     bool                    Hidden;                             // Do not display (== HiddenFrames*** > 0)
     bool                    IsFallbackWindow;                   // Set on the "Debug##Default" window.
     bool                    HasCloseButton;                     // Set when the window has a close button (p_open != NULL)
+    bool                    Frozen;                             // Set when Begin() reused the draw list of the previous frame and skipped submission (ImGuiWindowFlags_FreezeWhenIdle)
+    bool                    FreezeAllowed;                      // Set when the draw list was last built while the window was idle, so the next Begin() may reuse it
     signed char             ResizeBorderHeld;                   // Current border being held for resize (-1: none, otherwise 0-3)
     short                   BeginCount;                         // Number of Begin() during the current frame (generally 0 or 1, 1+ if appending via multiple Begin/End pairs)
     short                   BeginOrderWithinParent;             // Order within immediate parent window, if we are a child window. Otherwise 0.
@@ -1683,6 +1772,8 @@ struct IMGUI_API ImGuiWindow
 
     ImDrawList*             DrawList;                           // == &DrawListInst (for backward compatibility reason with code using imgui_internal.h we keep this a pointer)
     ImDrawList              DrawListInst;
+    ImRect                  FreezeRect;                         // Pos/SizeFull at the time the draw list was last built, to detect changes preventing a freeze
+    ImVec2                  FreezeDisplaySize;                  // io.DisplaySize at the time the draw list was last built
     ImGuiWindow*            ParentWindow;                       // If we are a child _or_ popup window, this is pointing to our parent. Otherwise NULL.
     ImGuiWindow*            RootWindow;                         // Point to ourself or first ancestor that is not a child window == Top-level window.
     ImGuiWindow*            RootWindowForTitleBarHighlight;     // Point to ourself or first ancestor which will display TitleBgActive color when this window is active.
@@ -1844,6 +1935,7 @@ namespace ImGui
     IMGUI_API void          SetWindowSize(ImGuiWindow* window, const ImVec2& size, ImGuiCond cond = 0);
     IMGUI_API void          SetWindowCollapsed(ImGuiWindow* window, bool collapsed, ImGuiCond cond = 0);
     IMGUI_API void          SetWindowHitTestHole(ImGuiWindow* window, const ImVec2& pos, const ImVec2& size);
+    IMGUI_API void          InvalidateWindow(ImGuiWindow* window);
 
     // Windows: Display Order and Focus Order
     IMGUI_API void          FocusWindow(ImGuiWindow* window);
@@ -1857,6 +1949,11 @@ namespace ImGui
     inline ImFont*          GetDefaultFont() { ImGuiContext& g = *GImGui; return g.IO.FontDefault ? g.IO.FontDefault : g.IO.Fonts->Fonts[0]; }
     inline ImDrawList*      GetForegroundDrawList(ImGuiWindow* window) { IM_UNUSED(window); ImGuiContext& g = *GImGui; return &g.ForegroundDrawList; } // This seemingly unnecessary wrapper simplifies compatibility between the 'master' and 'docking' branches.
 
+    // Memory
+    // Same as MemAlloc()/MemFree() without updating io.MetricsActiveAllocations of the current context: for code running on other threads (ImFontAtlas::BuildJobsFn).
+    IMGUI_API void*         MemAllocNoMetrics(size_t size);
+    IMGUI_API void          MemFreeNoMetrics(void* ptr);
+
     // Init
     IMGUI_API void          Initialize(ImGuiContext* context);
     IMGUI_API void          Shutdown(ImGuiContext* context);    // Since 1.60 this is a _private_ function. You can call DestroyContext() to destroy the context created by CreateContext().
@@ -2105,6 +2202,31 @@ namespace ImGui
 
 } // namespace ImGui
 
+// Glyphs of a font input using ImFontConfig::DynamicGlyphs, created by ImFontAtlasBuildWithStbTruetype().
+// They are rasterized the first time they are drawn into a grid of slots reserved in the atlas texture. When all slots are used,
+// the least recently used glyph is evicted, but never one used since the last ImGui::NewFrame(): those may be referenced by draw lists.
+struct ImFontDynamicGlyphs
+{
+    ImFont*             DstFont;
+    int                 ConfigIndex;            // Index into ContainerAtlas->ConfigData[]
+    void*               FontInfo;               // stbtt_fontinfo
+    int                 GlyphsOffset;           // Index of the first glyph of this font input in DstFont->Glyphs[]
+    int                 GlyphsCount;
+    ImVector<int>       GlyphsSlot;             // Slot of each glyph, -1 when not rasterized
+    ImVector<int>       SlotsGlyph;             // Glyph (index into GlyphsSlot[]) in each slot, -1 when free
+    ImVector<int>       SlotsLastUsedFrame;     // Value of ContainerAtlas->DynamicGlyphsFrameCount when each slot was last drawn
+    ImVector<const ImDrawList*> SlotsLastDrawList; // Draw list which last drew each slot in that frame, to avoid recording the same glyph repeatedly into ImDrawList::_DynamicGlyphs
+    int                 SlotsUsed;              // Slots [0, SlotsUsed) have been used at least once
+    int                 SlotsX, SlotsY;         // Position of the grid of slots in the texture
+    int                 SlotWidth, SlotHeight;  // Fits most glyphs (including padding and oversampling), larger ones are baked
+    int                 SlotsPerRow;
+    int                 RasterizedCount;        // Statistics
+    int                 EvictedCount;
+    int                 OverflowCount;          // Number of glyphs not drawn because all slots were used in the same frame
+
+    ImFontDynamicGlyphs()   { DstFont = NULL; ConfigIndex = -1; FontInfo = NULL; GlyphsOffset = GlyphsCount = SlotsUsed = SlotsX = SlotsY = SlotWidth = SlotHeight = SlotsPerRow = 0; RasterizedCount = EvictedCount = OverflowCount = 0; }
+};
+
 // ImFontAtlas internals
 IMGUI_API bool              ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasBuildInit(ImFontAtlas* atlas);
@@ -2114,6 +2236,10 @@ IMGUI_API void              ImFontAtlasBuildFinish(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasBuildRender1bppRectFromString(ImFontAtlas* atlas, int atlas_x, int atlas_y, int w, int h, const char* in_str, char in_marker_char, unsigned char in_marker_pixel_value);
 IMGUI_API void              ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void              ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
+IMGUI_API void              ImFontAtlasUpdateNewFrame(ImFontAtlas* atlas);
+IMGUI_API bool              ImFontAtlasUseDynamicGlyph(ImFontAtlas* atlas, const ImFont* font, const ImFontGlyph* glyph, ImDrawList* draw_list);
+IMGUI_API void              ImFontAtlasKeepDynamicGlyphs(ImFontAtlas* atlas, const ImDrawList* draw_list);
+IMGUI_API void              ImFontAtlasClearDynamicGlyphs(ImFontAtlas* atlas);
 
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
@@ -0,0 +1,210 @@
+// dear imgui
+// (imgui_bench_batch.cpp)
+// Benchmark for the batched primitive functions of ImDrawList, against calling the single primitive function in a loop:
+// - "heatmap": a grid of cells, AddRectFilledGrid() and AddRectsFilled() vs AddRectFilled() for each cell.
+// - "scatter": small filled circles, AddCirclesFilled() vs AddCircleFilled() for each point.
+// - "segments": line segments of random directions, AddLines() vs AddLine() for each segment. Thickness 1.0f uses textured lines.
+// - "grid lines": horizontal and vertical segments on pixel boundaries, which AddLine() writes as plain rectangles.
+// Every case uses anti-aliasing and large mesh support (ImDrawListFlags_AllowVtxOffset), as set up by NewFrame().
+// The output of both versions is verified to draw the same triangles (positions within 1/1000 of a pixel, or one step of the compact
+// vertex layout, same UV and colors).
+
+// Build with, e.g:
+//   # g++ -O2 -I../.. imgui_bench_batch.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_demo.cpp
+// Usage:
+//   imgui_bench_batch [heatmap_size] [frames_count]
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+struct BenchData
+{
+    int                 HeatmapSize;
+    ImVector<ImU32>     HeatmapCols;
+    ImVector<ImVec2>    HeatmapMins, HeatmapMaxs;
+    ImVector<ImVec2>    Points;
+    ImVector<ImU32>     PointsCols;
+    ImVector<ImVec2>    Segments;
+    ImVector<ImVec2>    GridLines;
+    ImVector<ImU32>     LinesCols;
+};
+
+static float RandomFloat(float max) { return (float)rand() / (float)RAND_MAX * max; }
+
+static ImU32 RandomColor(bool allow_transparent)
+{
+    ImU32 col = IM_COL32(rand() & 0xFF, rand() & 0xFF, rand() & 0xFF, 255);
+    return (allow_transparent && (rand() % 16) == 0) ? (col & ~IM_COL32_A_MASK) : col;
+}
+
+static void HeatmapCellRect(const BenchData& data, int x, int y, ImVec2* p_min, ImVec2* p_max)
+{
+    // Same expressions as AddRectFilledGrid()
+    const ImVec2 grid_min(10.0f, 10.0f), grid_max(1010.0f, 1010.0f);
+    const float cell_w = (grid_max.x - grid_min.x) / data.HeatmapSize;
+    const float cell_h = (grid_max.y - grid_min.y) / data.HeatmapSize;
+    p_min->x = grid_min.x + cell_w * x;
+    p_min->y = grid_min.y + cell_h * y;
+    p_max->x = (x + 1 == data.HeatmapSize) ? grid_max.x : grid_min.x + cell_w * (x + 1);
+    p_max->y = (y + 1 == data.HeatmapSize) ? grid_max.y : grid_min.y + cell_h * (y + 1);
+}
+
+// Draw one of the benchmarks, either batched or one primitive at a time
+static void DrawBench(ImDrawList* draw_list, const BenchData& data, int bench_n, bool batched)
+{
+    switch (bench_n)
+    {
+    case 0: // Heatmap (grid)
+        if (batched)
+            draw_list->AddRectFilledGrid(ImVec2(10.0f, 10.0f), ImVec2(1010.0f, 1010.0f), data.HeatmapSize, data.HeatmapSize, data.HeatmapCols.Data);
+        else
+            for (int y = 0; y < data.HeatmapSize; y++)
+                for (int x = 0; x < data.HeatmapSize; x++)
+                {
+                    ImVec2 p_min, p_max;
+                    HeatmapCellRect(data, x, y, &p_min, &p_max);
+                    draw_list->AddRectFilled(p_min, p_max, data.HeatmapCols[y * data.HeatmapSize + x]);
+                }
+        break;
+    case 1: // Heatmap (rectangles)
+        if (batched)
+            draw_list->AddRectsFilled(data.HeatmapMins.Data, data.HeatmapMaxs.Data, data.HeatmapCols.Data, data.HeatmapCols.Size);
+        else
+            for (int n = 0; n < data.HeatmapCols.Size; n++)
+                draw_list->AddRectFilled(data.HeatmapMins[n], data.HeatmapMaxs[n], data.HeatmapCols[n]);
+        break;
+    case 2: // Scatter
+        if (batched)
+            draw_list->AddCirclesFilled(data.Points.Data, data.PointsCols.Data, data.Points.Size, 3.0f);
+        else
+            for (int n = 0; n < data.Points.Size; n++)
+                draw_list->AddCircleFilled(data.Points[n], 3.0f, data.PointsCols[n]);
+        break;
+    case 3: // Segments
+    case 4: // Grid lines
+    {
+        const ImVector<ImVec2>& points = (bench_n == 3) ? data.Segments : data.GridLines;
+        if (batched)
+            draw_list->AddLines(points.Data, data.LinesCols.Data, points.Size / 2, 1.0f);
+        else
+            for (int n = 0; n < points.Size / 2; n++)
+                draw_list->AddLine(points[n * 2], points[n * 2 + 1], data.LinesCols[n], 1.0f);
+        break;
+    }
+    }
+}
+
+// Return true when both lists draw the same triangles in the same order
+static bool CompareTriangles(const ImDrawList* a, const ImDrawList* b)
+{
+    ImVector<ImDrawVert> tris[2];
+    const ImDrawList* lists[2] = { a, b };
+    for (int list_n = 0; list_n < 2; list_n++)
+    {
+        const ImDrawList* draw_list = lists[list_n];
+        for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+        {
+            const ImDrawCmd& cmd = draw_list->CmdBuffer[cmd_n];
+            for (unsigned int n = 0; n < cmd.ElemCount; n++)
+                tris[list_n].push_back(draw_list->VtxBuffer[draw_list->IdxBuffer[cmd.IdxOffset + n] + cmd.VtxOffset]);
+        }
+    }
+    if (tris[0].Size != tris[1].Size)
+        return false;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const float pos_tolerance = 1.0f / IM_DRAWVERT_POS16_ONE;
+#else
+    const float pos_tolerance = 0.001f;
+#endif
+    for (int n = 0; n < tris[0].Size; n++)
+    {
+        const ImDrawVert& v0 = tris[0][n];
+        const ImDrawVert& v1 = tris[1][n];
+        if (ImFabs((float)v0.pos.x - (float)v1.pos.x) > pos_tolerance || ImFabs((float)v0.pos.y - (float)v1.pos.y) > pos_tolerance)
+            return false;
+        if ((float)v0.uv.x != (float)v1.uv.x || (float)v0.uv.y != (float)v1.uv.y || v0.col != v1.col)
+            return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    BenchData data;
+    data.HeatmapSize = (argc > 1) ? atoi(argv[1]) : 512;
+    const int frames_count = (argc > 2) ? atoi(argv[2]) : 50;
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+    io.IniFilename = NULL;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    ImGui::NewFrame(); // Setup ImDrawListSharedData (white pixel and lines UV)
+
+    // Generate contents
+    srand(1234);
+    for (int y = 0; y < data.HeatmapSize; y++)
+        for (int x = 0; x < data.HeatmapSize; x++)
+        {
+            ImVec2 p_min, p_max;
+            HeatmapCellRect(data, x, y, &p_min, &p_max);
+            data.HeatmapMins.push_back(p_min);
+            data.HeatmapMaxs.push_back(p_max);
+            data.HeatmapCols.push_back(RandomColor(true));
+        }
+    const int points_count = data.HeatmapSize * data.HeatmapSize / 8;
+    for (int n = 0; n < points_count; n++)
+    {
+        data.Points.push_back(ImVec2(RandomFloat(1900.0f), RandomFloat(1060.0f)));
+        data.PointsCols.push_back(RandomColor(true));
+    }
+    for (int n = 0; n < points_count; n++)
+    {
+        const ImVec2 p(RandomFloat(1900.0f), RandomFloat(1060.0f));
+        data.Segments.push_back(p);
+        data.Segments.push_back(ImVec2(p.x + RandomFloat(40.0f) - 20.0f, p.y + RandomFloat(40.0f) - 20.0f));
+        const float grid_pos = (float)(int)RandomFloat(1000.0f);
+        data.GridLines.push_back((n & 1) ? ImVec2(grid_pos, 10.0f) : ImVec2(10.0f, grid_pos));
+        data.GridLines.push_back((n & 1) ? ImVec2(grid_pos, 1010.0f) : ImVec2(1010.0f, grid_pos));
+        data.LinesCols.push_back(RandomColor(true));
+    }
+
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImDrawList ref_list(ImGui::GetDrawListSharedData());
+    const char* bench_names[] = { "heatmap (grid)", "heatmap (rects)", "scatter", "segments", "grid lines" };
+    const int bench_counts[] = { data.HeatmapCols.Size, data.HeatmapCols.Size, points_count, points_count, points_count };
+    printf("%d frames\n", frames_count);
+    printf("%-16s %8s %9s %6s %14s %14s %8s %s\n", "Benchmark", "Count", "Vertices", "Cmds", "Loop (us)", "Batched (us)", "Speedup", "Output");
+    for (int bench_n = 0; bench_n < IM_ARRAYSIZE(bench_names); bench_n++)
+    {
+        clock_t times[2] = { 0, 0 };
+        for (int batched = 0; batched < 2; batched++)
+        {
+            ImDrawList* list = batched ? &draw_list : &ref_list;
+            for (int frame_n = 0; frame_n < frames_count; frame_n++)
+            {
+                list->_ResetForNewFrame();
+                list->Flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex | ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_AllowVtxOffset;
+                list->PushClipRectFullScreen();
+                list->PushTextureID(io.Fonts->TexID);
+                clock_t t0 = clock();
+                DrawBench(list, data, bench_n, batched != 0);
+                if (frame_n > 0) // First frame sets up storage
+                    times[batched] += clock() - t0;
+            }
+        }
+        const bool equal = CompareTriangles(&draw_list, &ref_list);
+        const double us_per_frame = 1000000.0 / CLOCKS_PER_SEC / (frames_count > 1 ? frames_count - 1 : 1);
+        printf("%-16s %8d %9d %6d %14.1f %14.1f %7.2fx %s\n", bench_names[bench_n], bench_counts[bench_n], draw_list.VtxBuffer.Size, draw_list.CmdBuffer.Size,
+            times[0] * us_per_frame, times[1] * us_per_frame, times[1] > 0 ? (double)times[0] / (double)times[1] : 0.0, equal ? "identical" : "MISMATCH");
+    }
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return 0;
+}
@@ -0,0 +1,164 @@
+// dear imgui
+// (imgui_bench_circles.cpp)
+// Benchmark for circles and arcs, over radii 1..max_radius with the automatic segment count:
+// - AddCircle() and AddCircleFilled(), which use rotations precomputed for every segment count (ImDrawListSharedData::CircleSegmentSteps).
+// - PathArcTo() alone (path points only, no tessellation), over half circles.
+// Each is compared to a reference calling ImCos()/ImSin() for every point, which is also used to verify the output: same indices,
+// same number of vertices and positions within 1/50 of a pixel (or one step of the compact vertex layout).
+
+// Build with, e.g:
+//   # g++ -O2 -I../.. imgui_bench_circles.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_demo.cpp
+// Usage:
+//   imgui_bench_circles [max_radius] [iterations]
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//-----------------------------------------------------------------------------
+// Reference implementations (one ImCos()/ImSin() pair per point)
+//-----------------------------------------------------------------------------
+
+static void RefPathArcTo(ImDrawList* draw_list, const ImVec2& center, float radius, float a_min, float a_max, int num_segments)
+{
+    if (radius == 0.0f)
+    {
+        draw_list->_Path.push_back(center);
+        return;
+    }
+    draw_list->_Path.reserve(draw_list->_Path.Size + (num_segments + 1));
+    for (int i = 0; i <= num_segments; i++)
+    {
+        const float a = a_min + ((float)i / (float)num_segments) * (a_max - a_min);
+        draw_list->_Path.push_back(ImVec2(center.x + ImCos(a) * radius, center.y + ImSin(a) * radius));
+    }
+}
+
+static void RefPathCircle(ImDrawList* draw_list, const ImVec2& center, float radius, int num_segments)
+{
+    if (num_segments == 12)
+        draw_list->PathArcToFast(center, radius, 0, 12 - 1);
+    else
+        RefPathArcTo(draw_list, center, radius, 0.0f, (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments, num_segments - 1);
+}
+
+//-----------------------------------------------------------------------------
+// Benchmarks
+//-----------------------------------------------------------------------------
+
+enum BenchFunc { BenchFunc_AddCircle, BenchFunc_AddCircleFilled, BenchFunc_PathArcTo, BenchFunc_COUNT };
+static const char* BenchFuncNames[BenchFunc_COUNT] = { "AddCircle", "AddCircleFilled", "PathArcTo (path only)" };
+
+static void RunFunc(BenchFunc func, ImDrawList* draw_list, int max_radius, bool reference)
+{
+    for (int radius_n = 1; radius_n <= max_radius; radius_n++)
+    {
+        const float radius = (float)radius_n;
+        const ImVec2 center(2100.0f + (radius_n & 7) * 0.25f, 2100.0f);
+        const ImU32 col = IM_COL32(255, radius_n & 255, 0, 255);
+        const int num_segments = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC(radius, draw_list->_Data->CircleSegmentMaxError);
+        switch (func)
+        {
+        case BenchFunc_AddCircle:
+            if (reference) { RefPathCircle(draw_list, center, radius - 0.5f, num_segments); draw_list->PathStroke(col, true, 1.0f); }
+            else { draw_list->AddCircle(center, radius, col); }
+            break;
+        case BenchFunc_AddCircleFilled:
+            if (reference) { RefPathCircle(draw_list, center, radius, num_segments); draw_list->PathFillConvex(col); }
+            else { draw_list->AddCircleFilled(center, radius, col); }
+            break;
+        case BenchFunc_PathArcTo:
+        {
+            // Keep the path, so the output can be compared
+            if (reference)
+                RefPathArcTo(draw_list, center, radius, 0.1f, 0.1f + IM_PI, num_segments / 2);
+            else
+                draw_list->PathArcTo(center, radius, 0.1f, 0.1f + IM_PI, num_segments / 2);
+            break;
+        }
+        default:
+            break;
+        }
+    }
+}
+
+// Return the largest distance between two positions, or -1.0f if the geometry differs otherwise
+static float CompareOutput(BenchFunc func, const ImDrawList* a, const ImDrawList* b)
+{
+    float max_error = 0.0f;
+    if (func == BenchFunc_PathArcTo)
+    {
+        if (a->_Path.Size != b->_Path.Size)
+            return -1.0f;
+        for (int n = 0; n < a->_Path.Size; n++)
+            max_error = ImMax(max_error, ImMax(ImFabs(a->_Path[n].x - b->_Path[n].x), ImFabs(a->_Path[n].y - b->_Path[n].y)));
+        return max_error;
+    }
+    if (a->VtxBuffer.Size != b->VtxBuffer.Size || a->IdxBuffer.Size != b->IdxBuffer.Size || memcmp(a->IdxBuffer.Data, b->IdxBuffer.Data, (size_t)a->IdxBuffer.Size * sizeof(ImDrawIdx)) != 0)
+        return -1.0f;
+    for (int n = 0; n < a->VtxBuffer.Size; n++)
+    {
+        const ImDrawVert& v0 = a->VtxBuffer[n];
+        const ImDrawVert& v1 = b->VtxBuffer[n];
+        if ((float)v0.uv.x != (float)v1.uv.x || (float)v0.uv.y != (float)v1.uv.y || v0.col != v1.col)
+            return -1.0f;
+        max_error = ImMax(max_error, ImMax(ImFabs((float)v0.pos.x - (float)v1.pos.x), ImFabs((float)v0.pos.y - (float)v1.pos.y)));
+    }
+    return max_error;
+}
+
+int main(int argc, char** argv)
+{
+    const int max_radius = (argc > 1) ? atoi(argv[1]) : 2048;
+    const int iterations = (argc > 2) ? atoi(argv[2]) : 30;
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+    io.IniFilename = NULL;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    ImGui::NewFrame(); // Setup ImDrawListSharedData (white pixel and lines UV)
+
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const float pos_tolerance = 1.0f / IM_DRAWVERT_POS16_ONE;
+#else
+    const float pos_tolerance = 0.02f;
+#endif
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImDrawList ref_list(ImGui::GetDrawListSharedData());
+    printf("Radii 1..%d, best of %d\n", max_radius, iterations);
+    printf("%-24s %9s %12s %12s %8s %10s %s\n", "Function", "Points", "Ref (ms)", "Imgui (ms)", "Speedup", "Max error", "Output");
+    int errors = 0;
+    for (int func = 0; func < BenchFunc_COUNT; func++)
+    {
+        // Best time out of multiple iterations
+        double best_time[2] = { 1e30, 1e30 };
+        for (int it = 0; it < iterations; it++)
+            for (int pass = 0; pass < 2; pass++)
+            {
+                ImDrawList* list = (pass == 0) ? &ref_list : &draw_list;
+                list->_ResetForNewFrame();
+                list->Flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex | ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_AllowVtxOffset;
+                list->PushClipRectFullScreen();
+                list->PushTextureID(io.Fonts->TexID);
+                clock_t t0 = clock();
+                RunFunc((BenchFunc)func, list, max_radius, pass == 0);
+                double t = (double)(clock() - t0) * 1000.0 / CLOCKS_PER_SEC;
+                best_time[pass] = ImMin(best_time[pass], t);
+            }
+        const float max_error = CompareOutput((BenchFunc)func, &ref_list, &draw_list);
+        const bool equal = (max_error >= 0.0f && max_error <= pos_tolerance);
+        errors += equal ? 0 : 1;
+        const int points_count = (func == BenchFunc_PathArcTo) ? draw_list._Path.Size : draw_list.VtxBuffer.Size;
+        printf("%-24s %9d %12.3f %12.3f %7.2fx %10.5f %s\n", BenchFuncNames[func], points_count, best_time[0], best_time[1], best_time[1] > 0.0 ? best_time[0] / best_time[1] : 0.0, max_error, equal ? "identical" : "MISMATCH");
+    }
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,168 @@
+// dear imgui
+// (imgui_bench_deferred.cpp)
+// Benchmark for deferred tessellation (ImDrawListFlags_DeferredTessellation, set by io.ConfigDeferredTessellation), on a synthetic
+// list of lines, borders, circles and curves: compares recording + tessellating shapes right away with recording them and writing
+// them later in _FlushDeferredPrims(). Both outputs are verified to be identical.
+// Also verifies that ImDrawListSplitter::Merge() writes the primitives still pending in the current channel before testing whether
+// commands can be merged across clip rectangles. Returns 1 when any output differs.
+
+// Build with, e.g:
+//   # g++ -O2 -I../.. imgui_bench_deferred.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_demo.cpp
+// Usage:
+//   imgui_bench_deferred [shapes_count] [frames_count]
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static void DrawShapes(ImDrawList* draw_list, int shapes_count, int frame_n)
+{
+    for (int shape_n = 0; shape_n < shapes_count; shape_n++)
+    {
+        const ImVec2 p((float)((shape_n * 37) % 1200) + frame_n * 0.25f, (float)((shape_n * 53) % 700));
+        const ImU32 col = IM_COL32(255, 255, 255, 55 + (shape_n % 200));
+        if (shape_n % 16 == 0)
+            draw_list->PushClipRect(ImVec2(p.x - 40.0f, p.y - 40.0f), ImVec2(p.x + 40.0f, p.y + 40.0f), true);
+        switch (shape_n % 6)
+        {
+        case 0: draw_list->AddLine(p, ImVec2(p.x + 30.0f, p.y + 7.0f), col, 1.0f + (shape_n % 3)); break;
+        case 1: draw_list->AddRect(p, ImVec2(p.x + 40.0f, p.y + 20.0f), col, 4.5f, ImDrawCornerFlags_All, 1.5f); break;
+        case 2: draw_list->AddRectFilled(p, ImVec2(p.x + 40.0f, p.y + 20.0f), col, 6.0f); break;
+        case 3: draw_list->AddCircle(p, 12.0f, col, 0, 2.0f); break;
+        case 4: draw_list->AddCircleFilled(p, 9.0f, col); break;
+        case 5: draw_list->AddBezierCurve(p, ImVec2(p.x + 10.0f, p.y - 20.0f), ImVec2(p.x + 30.0f, p.y + 20.0f), ImVec2(p.x + 40.0f, p.y), col, 1.0f); break;
+        }
+        if (shape_n % 16 == 15)
+            draw_list->PopClipRect();
+    }
+    if (shapes_count % 16 != 0)
+        draw_list->PopClipRect();
+}
+
+static void BeginList(ImDrawList* draw_list, bool deferred)
+{
+    draw_list->_ResetForNewFrame();
+    draw_list->Flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill | (deferred ? ImDrawListFlags_DeferredTessellation : ImDrawListFlags_None);
+    draw_list->PushClipRectFullScreen();
+    draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+}
+
+// Return true when both lists draw the same triangles in the same order
+static bool CompareTriangles(const ImDrawList* a, const ImDrawList* b)
+{
+    ImVector<ImDrawVert> tris[2];
+    const ImDrawList* lists[2] = { a, b };
+    for (int list_n = 0; list_n < 2; list_n++)
+    {
+        const ImDrawList* draw_list = lists[list_n];
+        for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+        {
+            const ImDrawCmd& cmd = draw_list->CmdBuffer[cmd_n];
+            for (unsigned int n = 0; n < cmd.ElemCount; n++)
+                tris[list_n].push_back(draw_list->VtxBuffer[draw_list->IdxBuffer[cmd.IdxOffset + n] + cmd.VtxOffset]);
+        }
+    }
+    return tris[0].Size == tris[1].Size && memcmp(tris[0].Data, tris[1].Data, (size_t)tris[0].Size * sizeof(ImDrawVert)) == 0;
+}
+
+// Return true when both lists have the same commands (clip rectangles and element counts)
+static bool CompareCommands(const ImDrawList* a, const ImDrawList* b)
+{
+    if (a->CmdBuffer.Size != b->CmdBuffer.Size)
+        return false;
+    for (int cmd_n = 0; cmd_n < a->CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd& cmd_a = a->CmdBuffer[cmd_n];
+        const ImDrawCmd& cmd_b = b->CmdBuffer[cmd_n];
+        if (cmd_a.ElemCount != cmd_b.ElemCount || memcmp(&cmd_a.ClipRect, &cmd_b.ClipRect, sizeof(ImVec4)) != 0)
+            return false;
+    }
+    return true;
+}
+
+// Channel 0 is current when calling Merge() and its last command is a shape overflowing its clip rectangle, still pending with
+// ImDrawListFlags_DeferredTessellation. It must not be merged with the first (unclipped) command of channel 1.
+static bool VerifySplitterMerge()
+{
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImDrawList ref_list(ImGui::GetDrawListSharedData());
+    for (int deferred = 0; deferred < 2; deferred++)
+    {
+        ImDrawList* list = deferred ? &draw_list : &ref_list;
+        list->VtxBuffer.resize(1024, ImDrawVert()); // Indices and vertices not written yet would be read as zeroes, inside the clip rectangle of channel 0
+        list->IdxBuffer.resize(1024, (ImDrawIdx)0);
+        list->_ResetForNewFrame();
+        list->Flags = ImDrawListFlags_AntiAliasedFill | (deferred ? ImDrawListFlags_DeferredTessellation : ImDrawListFlags_None);
+        list->PushClipRectFullScreen();
+        list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+
+        ImDrawListSplitter splitter;
+        splitter.Split(list, 2);
+        list->PushClipRect(ImVec2(0.0f, 0.0f), ImVec2(30.0f, 30.0f));
+        list->AddRectFilled(ImVec2(5.0f, 5.0f), ImVec2(10.0f, 10.0f), IM_COL32_WHITE);
+        splitter.SetCurrentChannel(list, 1);
+        list->PushClipRect(ImVec2(40.0f, 0.0f), ImVec2(70.0f, 30.0f));
+        list->AddRectFilled(ImVec2(45.0f, 5.0f), ImVec2(60.0f, 20.0f), IM_COL32_WHITE);
+        list->PopClipRect();
+        splitter.SetCurrentChannel(list, 0);
+        list->AddCircleFilled(ImVec2(20.0f, 15.0f), 15.0f, IM_COL32_WHITE, 24);
+        list->PopClipRect();
+        splitter.Merge(list);
+        list->_FlushDeferredPrims();
+    }
+    return CompareCommands(&draw_list, &ref_list) && CompareTriangles(&draw_list, &ref_list);
+}
+
+int main(int argc, char** argv)
+{
+    const int shapes_count = (argc > 1) ? atoi(argv[1]) : 20000;
+    const int frames_count = (argc > 2) ? atoi(argv[2]) : 100;
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1280.0f, 720.0f);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.IniFilename = NULL;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    ImGui::NewFrame(); // Set up shared draw list data (clip rectangle, curve tessellation tolerance, circle segments)
+
+    const bool merge_equal = VerifySplitterMerge();
+    printf("ImDrawListSplitter::Merge() with pending primitives: %s\n", merge_equal ? "identical" : "MISMATCH");
+
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImDrawList ref_list(ImGui::GetDrawListSharedData());
+    clock_t immediate_time = 0, record_time = 0, flush_time = 0;
+    bool equal = true;
+    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+    {
+        clock_t t0 = clock();
+        BeginList(&ref_list, false);
+        DrawShapes(&ref_list, shapes_count, frame_n);
+        clock_t t1 = clock();
+        BeginList(&draw_list, true);
+        DrawShapes(&draw_list, shapes_count, frame_n);
+        clock_t t2 = clock();
+        draw_list._FlushDeferredPrims();
+        clock_t t3 = clock();
+        if (frame_n > 0) // First frame sets up storage
+        {
+            immediate_time += t1 - t0;
+            record_time += t2 - t1;
+            flush_time += t3 - t2;
+        }
+        equal &= CompareCommands(&draw_list, &ref_list) && CompareTriangles(&draw_list, &ref_list);
+    }
+    const double ms_per_frame = 1000.0 / CLOCKS_PER_SEC / (frames_count > 1 ? frames_count - 1 : 1);
+    printf("%d shapes, %d frames, %d vertices, %d indices\n", shapes_count, frames_count, ref_list.VtxBuffer.Size, ref_list.IdxBuffer.Size);
+    printf("%-14s %-14s %-14s %s\n", "Immediate (ms)", "Record (ms)", "Flush (ms)", "Output");
+    printf("%-14.3f %-14.3f %-14.3f %s\n", immediate_time * ms_per_frame, record_time * ms_per_frame, flush_time * ms_per_frame, equal ? "identical" : "MISMATCH");
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return (merge_equal && equal) ? 0 : 1;
+}
@@ -0,0 +1,131 @@
+// dear imgui
+// (imgui_bench_drawvert.cpp)
+// Benchmark for the vertex layout (ImDrawVert), on typical contents: text, anti-aliased polylines, filled circles and rectangles.
+// For each, measures the time to build the draw list, the time to copy its vertices and indices to another buffer (as uploading them
+// to the GPU or streaming them to a remote renderer does), and the size of the data.
+// Build it twice, with and without IMGUI_USE_COMPACT_DRAWVERT (12 bytes vertices instead of 20), and compare the results. Vertex counts
+// are the same for both layouts, the "Float MB" column gives the size the default 20 bytes layout would use for reference.
+
+// Build with, e.g:
+//   # g++ -O2 -I../.. imgui_bench_drawvert.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_demo.cpp
+//   # g++ -O2 -I../.. -DIMGUI_USE_COMPACT_DRAWVERT -o imgui_bench_drawvert_compact imgui_bench_drawvert.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_demo.cpp
+// Usage:
+//   imgui_bench_drawvert [elements_count] [frames_count]
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static float RandomFloat(float max) { return (float)rand() / (float)RAND_MAX * max; }
+
+struct BenchData
+{
+    ImVector<ImVec2>    Positions;
+    ImVector<ImU32>     Colors;
+    ImVector<ImVec2>    PolylinePoints;
+};
+
+static void DrawBench(ImDrawList* draw_list, const BenchData& data, int bench_n)
+{
+    const int count = data.Positions.Size;
+    switch (bench_n)
+    {
+    case 0: // Text
+        for (int n = 0; n < count; n++)
+            draw_list->AddText(data.Positions[n], data.Colors[n], "The quick brown fox jumps over the lazy dog 0123456789");
+        break;
+    case 1: // Polyline
+        draw_list->AddPolyline(data.PolylinePoints.Data, data.PolylinePoints.Size, IM_COL32(255, 200, 64, 255), false, 1.0f);
+        draw_list->AddPolyline(data.PolylinePoints.Data, data.PolylinePoints.Size, IM_COL32(64, 200, 255, 255), false, 2.5f);
+        break;
+    case 2: // Filled circles
+        for (int n = 0; n < count; n++)
+            draw_list->AddCircleFilled(data.Positions[n], 6.0f, data.Colors[n]);
+        break;
+    case 3: // Rectangles
+        for (int n = 0; n < count; n++)
+            draw_list->AddRectFilled(data.Positions[n], ImVec2(data.Positions[n].x + 40.0f, data.Positions[n].y + 12.0f), data.Colors[n], 3.0f);
+        break;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const int elements_count = (argc > 1) ? atoi(argv[1]) : 5000;
+    const int frames_count = (argc > 2) ? atoi(argv[2]) : 100;
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+    io.IniFilename = NULL;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    ImGui::NewFrame(); // Setup ImDrawListSharedData (white pixel, lines UV and font)
+
+    // Generate contents
+    srand(1234);
+    BenchData data;
+    for (int n = 0; n < elements_count; n++)
+    {
+        data.Positions.push_back(ImVec2((float)(int)RandomFloat(1600.0f), (float)(int)RandomFloat(1060.0f)));
+        data.Colors.push_back(IM_COL32(rand() & 0xFF, rand() & 0xFF, rand() & 0xFF, 255));
+    }
+    ImVec2 p(960.0f, 540.0f);
+    for (int n = 0; n < elements_count * 10; n++)
+    {
+        p = ImVec2(ImClamp(p.x + RandomFloat(8.0f) - 4.0f, 0.0f, 1920.0f), ImClamp(p.y + RandomFloat(8.0f) - 4.0f, 0.0f, 1080.0f));
+        data.PolylinePoints.push_back(p);
+    }
+
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const char* layout_name = "compact";
+#else
+    const char* layout_name = "float";
+#endif
+    printf("%d elements, %d frames, layout: %s, sizeof(ImDrawVert): %d, best time\n", elements_count, frames_count, layout_name, (int)sizeof(ImDrawVert));
+    printf("%-16s %9s %9s %9s %10s %10s %10s\n", "Contents", "Vertices", "MB", "Float MB", "Build (us)", "Copy (us)", "Copy GB/s");
+    const char* bench_names[] = { "text", "polyline AA", "circles filled", "rects rounded" };
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImVector<char> upload_buffer;
+    for (int bench_n = 0; bench_n < IM_ARRAYSIZE(bench_names); bench_n++)
+    {
+        clock_t best_build_time = 0, best_copy_time = 0;
+        size_t bytes = 0, float_layout_bytes = 0;
+        for (int frame_n = 0; frame_n < frames_count; frame_n++)
+        {
+            draw_list._ResetForNewFrame();
+            draw_list.Flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex | ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_AllowVtxOffset;
+            draw_list.PushClipRectFullScreen();
+            draw_list.PushTextureID(io.Fonts->TexID);
+            clock_t t0 = clock();
+            DrawBench(&draw_list, data, bench_n);
+            clock_t t1 = clock();
+
+            const size_t vtx_bytes = (size_t)draw_list.VtxBuffer.Size * sizeof(ImDrawVert);
+            const size_t idx_bytes = (size_t)draw_list.IdxBuffer.Size * sizeof(ImDrawIdx);
+            bytes = vtx_bytes + idx_bytes;
+            float_layout_bytes = (size_t)draw_list.VtxBuffer.Size * 20 + idx_bytes;
+            upload_buffer.resize((int)bytes);
+            clock_t t2 = clock();
+            memcpy(upload_buffer.Data, draw_list.VtxBuffer.Data, vtx_bytes);
+            memcpy(upload_buffer.Data + vtx_bytes, draw_list.IdxBuffer.Data, idx_bytes);
+            clock_t t3 = clock();
+            if (frame_n == 1 || (frame_n > 1 && t1 - t0 < best_build_time)) // First frame sets up storage
+                best_build_time = t1 - t0;
+            if (frame_n == 1 || (frame_n > 1 && t3 - t2 < best_copy_time))
+                best_copy_time = t3 - t2;
+        }
+        const double us = 1000000.0 / CLOCKS_PER_SEC;
+        const double copy_us = best_copy_time * us;
+        printf("%-16s %9d %9.2f %9.2f %10.1f %10.1f %10.2f\n", bench_names[bench_n], draw_list.VtxBuffer.Size, bytes / 1000000.0, float_layout_bytes / 1000000.0,
+            best_build_time * us, copy_us, copy_us > 0.0 ? bytes / copy_us / 1000.0 : 0.0);
+    }
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return 0;
+}
@@ -0,0 +1,140 @@
+// dear imgui
+// (imgui_bench_fontatlas.cpp)
+// Benchmark for the startup cost of building a font atlas with GetGlyphRangesChineseFull(), serially and with
+// ImFontAtlas::BuildJobsFn running the jobs on a few std::thread.
+// Also measures a warm start restoring the serial build with ImFontAtlas::LoadCacheFromMemory() (including hashing the font data for the key).
+// The texture and glyphs of all atlases are verified to be identical.
+// Times are wall-clock times (the best of all builds), so the threaded build only gets faster with several hardware threads.
+// Pass a font with CJK glyphs (e.g. NotoSansCJK, msyh.ttc) to measure rasterization, with the default font most of the
+// requested codepoints are missing and only the glyph lookups are measured.
+
+// Build with, e.g:
+//   # g++ -O2 -pthread -I../.. imgui_bench_fontatlas.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_demo.cpp
+// Usage:
+//   imgui_bench_fontatlas [font_file] [size_pixels] [threads_count] [builds_count]
+
+#include "imgui.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+struct BenchJobSystem
+{
+    int     ThreadsCount;
+};
+
+// Minimal job system: spawn threads for every call, each of them picking jobs until none are left.
+static void BenchRunJobs(void* user_data, int job_count, void (*job_fn)(void* job_data, int job_index), void* job_data)
+{
+    BenchJobSystem* job_system = (BenchJobSystem*)user_data;
+    std::atomic<int> next_job(0);
+    auto worker = [&]()
+    {
+        for (int job_n = next_job++; job_n < job_count; job_n = next_job++)
+            job_fn(job_data, job_n);
+    };
+    std::vector<std::thread> threads;
+    for (int n = 1; n < job_system->ThreadsCount && n < job_count; n++)
+        threads.emplace_back(worker);
+    worker();
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+static void SetupAtlas(ImFontAtlas* atlas, const char* font_file, float size_pixels)
+{
+    atlas->Clear();
+    if (font_file)
+        atlas->AddFontFromFileTTF(font_file, size_pixels, NULL, atlas->GetGlyphRangesChineseFull());
+    else
+    {
+        ImFontConfig font_cfg;
+        font_cfg.SizePixels = size_pixels;
+        font_cfg.GlyphRanges = atlas->GetGlyphRangesChineseFull();
+        atlas->AddFontDefault(&font_cfg);
+    }
+}
+
+// Return true when both atlases have the same texture and glyphs
+static bool CompareAtlases(ImFontAtlas* a, ImFontAtlas* b)
+{
+    if (a->TexWidth != b->TexWidth || a->TexHeight != b->TexHeight || memcmp(a->TexPixelsAlpha8, b->TexPixelsAlpha8, (size_t)(a->TexWidth * a->TexHeight)) != 0)
+        return false;
+    if (a->Fonts.Size != b->Fonts.Size)
+        return false;
+    for (int font_n = 0; font_n < a->Fonts.Size; font_n++)
+    {
+        const ImVector<ImFontGlyph>& glyphs_a = a->Fonts[font_n]->Glyphs;
+        const ImVector<ImFontGlyph>& glyphs_b = b->Fonts[font_n]->Glyphs;
+        if (glyphs_a.Size != glyphs_b.Size || memcmp(glyphs_a.Data, glyphs_b.Data, (size_t)glyphs_a.size_in_bytes()) != 0)
+            return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    const char* font_file = (argc > 1 && strcmp(argv[1], "default") != 0) ? argv[1] : NULL;
+    const float size_pixels = (argc > 2) ? (float)atof(argv[2]) : 18.0f;
+    BenchJobSystem job_system;
+    job_system.ThreadsCount = (argc > 3) ? atoi(argv[3]) : (int)std::thread::hardware_concurrency();
+    if (job_system.ThreadsCount < 1)
+        job_system.ThreadsCount = 1;
+    const int builds_count = (argc > 4) ? atoi(argv[4]) : 5;
+
+    ImFontAtlas atlases[2];
+    double best_ms[2] = { 0.0, 0.0 };
+    for (int threaded = 0; threaded < 2; threaded++)
+    {
+        ImFontAtlas* atlas = &atlases[threaded];
+        atlas->BuildJobsFn = threaded ? BenchRunJobs : NULL;
+        atlas->BuildJobsUserData = &job_system;
+        for (int build_n = 0; build_n < builds_count; build_n++)
+        {
+            SetupAtlas(atlas, font_file, size_pixels);
+            std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+            if (!atlas->Build())
+            {
+                fprintf(stderr, "Failed to build font atlas with '%s'\n", font_file ? font_file : "default font");
+                return 1;
+            }
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+            if (build_n == 0 || ms < best_ms[threaded])
+                best_ms[threaded] = ms;
+        }
+    }
+
+    // Warm start: restore the serial build from a cache, into an atlas set up the same way
+    ImVector<unsigned char> cache_data;
+    atlases[0].SaveCacheToMemory(&cache_data);
+    ImFontAtlas cached_atlas;
+    double cache_best_ms = 0.0;
+    for (int build_n = 0; build_n < builds_count; build_n++)
+    {
+        SetupAtlas(&cached_atlas, font_file, size_pixels);
+        std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+        if (!cached_atlas.LoadCacheFromMemory(cache_data.Data, (size_t)cache_data.Size))
+        {
+            fprintf(stderr, "Failed to load font atlas cache\n");
+            return 1;
+        }
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        if (build_n == 0 || ms < cache_best_ms)
+            cache_best_ms = ms;
+    }
+
+    const bool equal = CompareAtlases(&atlases[0], &atlases[1]) && CompareAtlases(&atlases[0], &cached_atlas);
+    printf("Font: %s, %.1f px, GetGlyphRangesChineseFull(), %d glyphs, %dx%d texture\n", font_file ? font_file : "default", size_pixels, atlases[0].Fonts[0]->Glyphs.Size, atlases[0].TexWidth, atlases[0].TexHeight);
+    printf("%-24s %10s\n", "Build", "Best (ms)");
+    printf("%-24s %10.2f\n", "Serial", best_ms[0]);
+    char threaded_name[32];
+    snprintf(threaded_name, IM_ARRAYSIZE(threaded_name), "BuildJobsFn, %d threads", job_system.ThreadsCount);
+    printf("%-24s %10.2f (%.2fx)\n", threaded_name, best_ms[1], best_ms[1] > 0.0 ? best_ms[0] / best_ms[1] : 0.0);
+    printf("%-24s %10.2f (%.2fx, %d KB)\n", "LoadCacheFromMemory", cache_best_ms, cache_best_ms > 0.0 ? best_ms[0] / cache_best_ms : 0.0, cache_data.Size / 1024);
+    printf("Output: %s\n", equal ? "identical" : "MISMATCH");
+    return equal ? 0 : 1;
+}
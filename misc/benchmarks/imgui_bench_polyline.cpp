@@ -0,0 +1,109 @@
+// dear imgui
+// (imgui_bench_polyline.cpp)
+// Benchmark for anti-aliased ImDrawList::AddPolyline(), on telemetry-like random walks, in points per second:
+// - "textured": thickness 1.0f and 3.0f with ImDrawListFlags_AntiAliasedLinesUseTex, using the baked lines of the font atlas.
+// - "geometry": thickness 1.0f without textured lines, and thickness 2.5f (fractional thicknesses never use the texture).
+// Each case is drawn open and closed.
+// The SIMD code paths are selected at compile time (see IMGUI_ENABLE_SSE/IMGUI_ENABLE_NEON in imgui_internal.h), define IMGUI_DISABLE_SIMD
+// to measure the scalar code. Both builds write bit-identical vertices and indices: compare the hashes printed in the last column.
+
+// Build with, e.g:
+//   # g++ -O2 -I../.. imgui_bench_polyline.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_demo.cpp
+//   # g++ -O2 -I../.. -DIMGUI_DISABLE_SIMD -o imgui_bench_polyline_scalar imgui_bench_polyline.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_demo.cpp
+// Usage:
+//   imgui_bench_polyline [points_per_polyline] [polylines_count] [frames_count]
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static float RandomFloat(float max) { return (float)rand() / (float)RAND_MAX * max; }
+
+// FNV-1a hash of the vertex and index buffers
+static ImU64 HashDrawList(const ImDrawList* draw_list)
+{
+    ImU64 hash = 14695981039346656037ULL;
+    const unsigned char* buffers[2] = { (const unsigned char*)draw_list->VtxBuffer.Data, (const unsigned char*)draw_list->IdxBuffer.Data };
+    const size_t sizes[2] = { (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert), (size_t)draw_list->IdxBuffer.Size * sizeof(ImDrawIdx) };
+    for (int buffer_n = 0; buffer_n < 2; buffer_n++)
+        for (size_t n = 0; n < sizes[buffer_n]; n++)
+            hash = (hash ^ buffers[buffer_n][n]) * 1099511628211ULL;
+    return hash;
+}
+
+int main(int argc, char** argv)
+{
+    const int points_per_polyline = (argc > 1) ? atoi(argv[1]) : 10000;
+    const int polylines_count = (argc > 2) ? atoi(argv[2]) : 4;
+    const int frames_count = (argc > 3) ? atoi(argv[3]) : 50;
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+    io.IniFilename = NULL;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    ImGui::NewFrame(); // Setup ImDrawListSharedData (white pixel and lines UV)
+
+    // Random walks over the display, with a few sharp turns and repeated points
+    srand(1234);
+    ImVector<ImVec2> points;
+    points.resize(points_per_polyline * polylines_count);
+    for (int line_n = 0; line_n < polylines_count; line_n++)
+    {
+        ImVec2 p(RandomFloat(1920.0f), RandomFloat(1080.0f));
+        for (int n = 0; n < points_per_polyline; n++)
+        {
+            if ((rand() % 64) != 0)
+                p = ImVec2(ImClamp(p.x + RandomFloat(8.0f) - 4.0f, 0.0f, 1920.0f), ImClamp(p.y + RandomFloat(8.0f) - 4.0f, 0.0f, 1080.0f));
+            points[line_n * points_per_polyline + n] = p;
+        }
+    }
+
+#if defined(IMGUI_ENABLE_SSE)
+    const char* simd_name = "SSE2";
+#elif defined(IMGUI_ENABLE_NEON)
+    const char* simd_name = "NEON";
+#else
+    const char* simd_name = "none";
+#endif
+    printf("%d polylines of %d points, %d frames, SIMD: %s, sizeof(ImDrawVert): %d\n", polylines_count, points_per_polyline, frames_count, simd_name, (int)sizeof(ImDrawVert));
+    printf("%-22s %7s %9s %10s %10s %10s %s\n", "Case", "Closed", "Vertices", "Time (us)", "Mpoints/s", "MB/s", "Hash");
+
+    struct BenchCase { const char* Name; float Thickness; bool UseTex; };
+    const BenchCase cases[] = { { "textured, 1.0", 1.0f, true }, { "textured, 3.0", 3.0f, true }, { "geometry, 1.0", 1.0f, false }, { "geometry, 2.5", 2.5f, false } };
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    for (int case_n = 0; case_n < IM_ARRAYSIZE(cases); case_n++)
+        for (int closed = 0; closed < 2; closed++)
+        {
+            const BenchCase& bench_case = cases[case_n];
+            clock_t best_time = 0;
+            for (int frame_n = 0; frame_n < frames_count; frame_n++)
+            {
+                draw_list._ResetForNewFrame();
+                draw_list.Flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill | ImDrawListFlags_AllowVtxOffset;
+                if (bench_case.UseTex)
+                    draw_list.Flags |= ImDrawListFlags_AntiAliasedLinesUseTex;
+                draw_list.PushClipRectFullScreen();
+                draw_list.PushTextureID(io.Fonts->TexID);
+                clock_t t0 = clock();
+                for (int line_n = 0; line_n < polylines_count; line_n++)
+                    draw_list.AddPolyline(&points[line_n * points_per_polyline], points_per_polyline, IM_COL32(255, 200, 64, 255), closed != 0, bench_case.Thickness);
+                clock_t t = clock() - t0;
+                if (frame_n == 1 || (frame_n > 1 && t < best_time)) // First frame sets up storage
+                    best_time = t;
+            }
+            const double us = (double)best_time * 1000000.0 / CLOCKS_PER_SEC;
+            const double points_total = (double)points_per_polyline * polylines_count;
+            const double bytes_total = (double)draw_list.VtxBuffer.Size * sizeof(ImDrawVert) + (double)draw_list.IdxBuffer.Size * sizeof(ImDrawIdx);
+            printf("%-22s %7s %9d %10.1f %10.1f %10.1f %016llx\n", bench_case.Name, closed ? "yes" : "no", draw_list.VtxBuffer.Size, us,
+                us > 0.0 ? points_total / us : 0.0, us > 0.0 ? bytes_total / us : 0.0, (unsigned long long)HashDrawList(&draw_list));
+        }
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return 0;
+}
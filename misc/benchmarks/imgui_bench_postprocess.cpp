@@ -0,0 +1,244 @@
+// dear imgui
+// (imgui_bench_postprocess.cpp)
+// Benchmark for the vertex post-processing helpers, on large synthetic draw lists:
+//   ImDrawData::DeIndexAllBuffers(), ImDrawData::ScaleClipRects(), ImGui::ShadeVertsLinearColorGradientKeepAlpha(), ImGui::ShadeVertsLinearUV().
+// Each helper is compared to a plain scalar reference implementation, which is also used to verify the output.
+// The SSE2 code paths are selected at compile time (see IMGUI_ENABLE_SSE in imgui_internal.h), define IMGUI_DISABLE_SIMD to measure the scalar code.
+// Other targets (including NEON) use the scalar code.
+
+// Build with, e.g:
+//   # g++ -O2 -I../.. imgui_bench_postprocess.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_demo.cpp
+// Usage:
+//   imgui_bench_postprocess [lists_count] [vertices_per_list]
+
+#include "imgui.h"
+#define IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+//-----------------------------------------------------------------------------
+// Scalar reference implementations
+//-----------------------------------------------------------------------------
+
+static void RefDeIndexAllBuffers(ImDrawData* draw_data)
+{
+    ImVector<ImDrawVert> new_vtx_buffer;
+    for (int i = 0; i < draw_data->CmdListsCount; i++)
+    {
+        ImDrawList* cmd_list = draw_data->CmdLists[i];
+        new_vtx_buffer.resize(cmd_list->IdxBuffer.Size);
+        for (int j = 0; j < cmd_list->IdxBuffer.Size; j++)
+            new_vtx_buffer.Data[j] = cmd_list->VtxBuffer.Data[cmd_list->IdxBuffer.Data[j]];
+        cmd_list->VtxBuffer.swap(new_vtx_buffer);
+        cmd_list->IdxBuffer.resize(0);
+    }
+}
+
+static void RefScaleClipRects(ImDrawData* draw_data, const ImVec2& fb_scale)
+{
+    for (int i = 0; i < draw_data->CmdListsCount; i++)
+        for (int cmd_i = 0; cmd_i < draw_data->CmdLists[i]->CmdBuffer.Size; cmd_i++)
+        {
+            ImDrawCmd* cmd = &draw_data->CmdLists[i]->CmdBuffer.Data[cmd_i];
+            cmd->ClipRect = ImVec4(cmd->ClipRect.x * fb_scale.x, cmd->ClipRect.y * fb_scale.y, cmd->ClipRect.z * fb_scale.x, cmd->ClipRect.w * fb_scale.y);
+        }
+}
+
+static void RefShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1)
+{
+    ImVec2 gradient_extent = gradient_p1 - gradient_p0;
+    float gradient_inv_length2 = 1.0f / ImLengthSqr(gradient_extent);
+    const int col0_r = (int)(col0 >> IM_COL32_R_SHIFT) & 0xFF;
+    const int col0_g = (int)(col0 >> IM_COL32_G_SHIFT) & 0xFF;
+    const int col0_b = (int)(col0 >> IM_COL32_B_SHIFT) & 0xFF;
+    const int col_delta_r = ((int)(col1 >> IM_COL32_R_SHIFT) & 0xFF) - col0_r;
+    const int col_delta_g = ((int)(col1 >> IM_COL32_G_SHIFT) & 0xFF) - col0_g;
+    const int col_delta_b = ((int)(col1 >> IM_COL32_B_SHIFT) & 0xFF) - col0_b;
+    for (ImDrawVert* vert = draw_list->VtxBuffer.Data + vert_start_idx; vert < draw_list->VtxBuffer.Data + vert_end_idx; vert++)
+    {
+        float d = ImDot(vert->pos - gradient_p0, gradient_extent);
+        float t = ImClamp(d * gradient_inv_length2, 0.0f, 1.0f);
+        int r = (int)(col0_r + col_delta_r * t);
+        int g = (int)(col0_g + col_delta_g * t);
+        int b = (int)(col0_b + col_delta_b * t);
+        vert->col = (r << IM_COL32_R_SHIFT) | (g << IM_COL32_G_SHIFT) | (b << IM_COL32_B_SHIFT) | (vert->col & IM_COL32_A_MASK);
+    }
+}
+
+static void RefShadeVertsLinearUV(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, bool clamp)
+{
+    const ImVec2 size = b - a;
+    const ImVec2 uv_size = uv_b - uv_a;
+    const ImVec2 scale = ImVec2(size.x != 0.0f ? (uv_size.x / size.x) : 0.0f, size.y != 0.0f ? (uv_size.y / size.y) : 0.0f);
+    const ImVec2 min = ImMin(uv_a, uv_b);
+    const ImVec2 max = ImMax(uv_a, uv_b);
+    for (ImDrawVert* vertex = draw_list->VtxBuffer.Data + vert_start_idx; vertex < draw_list->VtxBuffer.Data + vert_end_idx; ++vertex)
+        vertex->uv = clamp ? ImClamp(uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale), min, max) : uv_a + ImMul(ImVec2(vertex->pos.x, vertex->pos.y) - a, scale);
+}
+
+//-----------------------------------------------------------------------------
+// Synthetic data
+//-----------------------------------------------------------------------------
+
+struct BenchData
+{
+    ImVector<ImDrawList*>   Lists;
+    ImDrawData              DrawData;
+
+    void Init(int lists_count, int vtx_per_list)
+    {
+        srand(1234);
+        for (int list_n = 0; list_n < lists_count; list_n++)
+        {
+            ImDrawList* draw_list = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+            draw_list->_ResetForNewFrame();
+            draw_list->PushClipRectFullScreen();
+            for (int n = 0; n < vtx_per_list / 4; n++)
+            {
+                // Random quads over a 4K display, one clip rectangle per 64 quads
+                if (n % 64 == 63)
+                {
+                    draw_list->PopClipRect();
+                    draw_list->PushClipRect(ImVec2((float)(rand() % 3840), (float)(rand() % 2160)), ImVec2(3840, 2160));
+                }
+                ImVec2 p((float)(rand() % 3840) + 0.5f, (float)(rand() % 2160) + 0.25f);
+                draw_list->PrimReserve(6, 4);
+                draw_list->PrimRectUV(p, p + ImVec2(12, 14), ImVec2(0.1f, 0.2f), ImVec2(0.3f, 0.4f), IM_COL32(rand() & 255, rand() & 255, rand() & 255, rand() & 255));
+            }
+            draw_list->PopClipRect();
+            Lists.push_back(draw_list);
+        }
+        DrawData.Valid = true;
+        DrawData.CmdLists = Lists.Data;
+        DrawData.CmdListsCount = Lists.Size;
+    }
+    void CopyFrom(const BenchData& src)
+    {
+        for (int n = 0; n < Lists.Size; n++)
+        {
+            ImDrawList* dst_list = Lists[n];
+            const ImDrawList* src_list = src.Lists[n];
+            dst_list->CmdBuffer.resize(src_list->CmdBuffer.Size);
+            dst_list->IdxBuffer.resize(src_list->IdxBuffer.Size);
+            dst_list->VtxBuffer.resize(src_list->VtxBuffer.Size);
+            memcpy(dst_list->CmdBuffer.Data, src_list->CmdBuffer.Data, (size_t)src_list->CmdBuffer.Size * sizeof(ImDrawCmd));
+            memcpy(dst_list->IdxBuffer.Data, src_list->IdxBuffer.Data, (size_t)src_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+            memcpy(dst_list->VtxBuffer.Data, src_list->VtxBuffer.Data, (size_t)src_list->VtxBuffer.Size * sizeof(ImDrawVert));
+        }
+    }
+    void Init(const BenchData& src)
+    {
+        for (int n = 0; n < src.Lists.Size; n++)
+            Lists.push_back(IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData()));
+        DrawData.Valid = true;
+        DrawData.CmdLists = Lists.Data;
+        DrawData.CmdListsCount = Lists.Size;
+        CopyFrom(src);
+    }
+    bool Equal(const BenchData& other) const
+    {
+        for (int n = 0; n < Lists.Size; n++)
+        {
+            const ImDrawList* a = Lists[n];
+            const ImDrawList* b = other.Lists[n];
+            if (a->CmdBuffer.Size != b->CmdBuffer.Size || a->IdxBuffer.Size != b->IdxBuffer.Size || a->VtxBuffer.Size != b->VtxBuffer.Size)
+                return false;
+            for (int cmd_n = 0; cmd_n < a->CmdBuffer.Size; cmd_n++)
+                if (memcmp(&a->CmdBuffer[cmd_n].ClipRect, &b->CmdBuffer[cmd_n].ClipRect, sizeof(ImVec4)) != 0)
+                    return false;
+            if (memcmp(a->IdxBuffer.Data, b->IdxBuffer.Data, (size_t)a->IdxBuffer.Size * sizeof(ImDrawIdx)) != 0 || memcmp(a->VtxBuffer.Data, b->VtxBuffer.Data, (size_t)a->VtxBuffer.Size * sizeof(ImDrawVert)) != 0)
+                return false;
+        }
+        return true;
+    }
+    void Shutdown()
+    {
+        for (int n = 0; n < Lists.Size; n++)
+            IM_DELETE(Lists[n]);
+        Lists.clear();
+    }
+};
+
+enum BenchFunc { BenchFunc_DeIndex, BenchFunc_ScaleClipRects, BenchFunc_ShadeGradient, BenchFunc_ShadeUV, BenchFunc_ShadeUVClamp, BenchFunc_COUNT };
+static const char* BenchFuncNames[BenchFunc_COUNT] = { "DeIndexAllBuffers", "ScaleClipRects", "ShadeVertsLinearColorGradientKeepAlpha", "ShadeVertsLinearUV", "ShadeVertsLinearUV (clamp)" };
+
+static void RunFunc(BenchFunc func, BenchData* data, bool reference)
+{
+    for (int n = 0; n < data->Lists.Size; n++)
+    {
+        ImDrawList* draw_list = data->Lists[n];
+        const int vtx_count = draw_list->VtxBuffer.Size;
+        switch (func)
+        {
+        case BenchFunc_DeIndex:
+            if (n == 0)
+                reference ? RefDeIndexAllBuffers(&data->DrawData) : data->DrawData.DeIndexAllBuffers();
+            break;
+        case BenchFunc_ScaleClipRects:
+            if (n == 0)
+                reference ? RefScaleClipRects(&data->DrawData, ImVec2(1.5f, 1.25f)) : data->DrawData.ScaleClipRects(ImVec2(1.5f, 1.25f));
+            break;
+        case BenchFunc_ShadeGradient:
+            (reference ? RefShadeVertsLinearColorGradientKeepAlpha : ImGui::ShadeVertsLinearColorGradientKeepAlpha)(draw_list, 0, vtx_count, ImVec2(100, 200), ImVec2(3000, 1500), IM_COL32(255, 0, 32, 255), IM_COL32(16, 200, 255, 128));
+            break;
+        case BenchFunc_ShadeUV:
+        case BenchFunc_ShadeUVClamp:
+            (reference ? RefShadeVertsLinearUV : ImGui::ShadeVertsLinearUV)(draw_list, 0, vtx_count, ImVec2(200, 100), ImVec2(3000, 1800), ImVec2(0.25f, 0.125f), ImVec2(0.75f, 0.5f), func == BenchFunc_ShadeUVClamp);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const int lists_count = (argc > 1) ? atoi(argv[1]) : 100;
+    const int vtx_per_list = (argc > 2) ? atoi(argv[2]) : 10000;
+    const int iterations = 20;
+
+    ImGui::CreateContext();
+    BenchData source, ref, test;
+    source.Init(lists_count, vtx_per_list);
+    ref.Init(source);
+    test.Init(source);
+    int total_vtx = 0;
+    for (int n = 0; n < source.Lists.Size; n++)
+        total_vtx += source.Lists[n]->VtxBuffer.Size;
+#if defined(IMGUI_ENABLE_SSE)
+    const char* simd_name = "SSE2";
+#else
+    const char* simd_name = "none";
+#endif
+    printf("%d draw lists, %d vertices, SIMD: %s\n", lists_count, total_vtx, simd_name);
+    printf("%-40s %12s %12s %8s %s\n", "Function", "Ref (ms)", "Imgui (ms)", "Speedup", "Output");
+
+    int errors = 0;
+    for (int func = 0; func < BenchFunc_COUNT; func++)
+    {
+        // Best time out of multiple iterations, restoring the input every time (not measured)
+        double best_time[2] = { 1e30, 1e30 };
+        for (int it = 0; it < iterations; it++)
+            for (int pass = 0; pass < 2; pass++)
+            {
+                BenchData* data = (pass == 0) ? &ref : &test;
+                data->CopyFrom(source);
+                clock_t t0 = clock();
+                RunFunc((BenchFunc)func, data, pass == 0);
+                double t = (double)(clock() - t0) * 1000.0 / CLOCKS_PER_SEC;
+                best_time[pass] = ImMin(best_time[pass], t);
+            }
+        const bool equal = ref.Equal(test);
+        errors += equal ? 0 : 1;
+        printf("%-40s %12.3f %12.3f %7.2fx %s\n", BenchFuncNames[func], best_time[0], best_time[1], best_time[1] > 0.0 ? best_time[0] / best_time[1] : 0.0, equal ? "identical" : "MISMATCH");
+    }
+
+    source.Shutdown();
+    ref.Shutdown();
+    test.Shutdown();
+    ImGui::DestroyContext();
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,127 @@
+// dear imgui
+// (imgui_bench_rects.cpp)
+// Benchmark for the pixel-aligned paths of ImDrawList::AddRect(), AddLine() and AddRectFilled(), on table/grid borders:
+// a grid of bordered cells (AddRect() with thickness 1.0f, as RenderFrameBorder() does), one header row per 16 rows filled with
+// AddRectFilled() with a rounding but no rounded corners (as table headers and tabs do), and horizontal/vertical separators (AddLine()).
+// Every coordinate is an integer, as widgets use, so the strokes cover whole pixels and AddRect()/AddLine()/AddRectFilled() write
+// their quads directly. They are compared to the generic path they skip (PathRect()/PathLineTo() + PathStroke()/PathFillConvex()),
+// with anti-aliased textured lines, anti-aliased geometry lines (ImDrawListFlags_AntiAliasedLinesUseTex off) and no anti-aliasing.
+
+// Build with, e.g:
+//   # g++ -O2 -I../.. imgui_bench_rects.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_demo.cpp
+// Usage:
+//   imgui_bench_rects [grid_size] [frames_count]
+
+#include "imgui.h"
+#define IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Draw the grid, either with the public functions or with the generic path they skip (same as they do for non pixel-aligned coordinates)
+static void DrawGrid(ImDrawList* draw_list, int grid_size, bool generic_path)
+{
+    const float cell_w = 24.0f, cell_h = 16.0f;
+    const ImU32 border_col = IM_COL32(110, 110, 128, 128);
+    const ImU32 header_col = IM_COL32(48, 48, 51, 255);
+    const ImU32 separator_col = IM_COL32(79, 79, 89, 255);
+    const bool aa_lines = (draw_list->Flags & ImDrawListFlags_AntiAliasedLines) != 0;
+    for (int y = 0; y < grid_size; y++)
+    {
+        const float y0 = 8.0f + y * cell_h;
+        if ((y % 16) == 0)
+        {
+            const ImVec2 p_min(8.0f, y0), p_max(8.0f + grid_size * cell_w, y0 + cell_h);
+            if (generic_path) { draw_list->PathRect(p_min, p_max, 4.0f, 0); draw_list->PathFillConvex(header_col); }
+            else { draw_list->AddRectFilled(p_min, p_max, header_col, 4.0f, 0); }
+        }
+        for (int x = 0; x < grid_size; x++)
+        {
+            const ImVec2 p_min(8.0f + x * cell_w, y0), p_max(8.0f + (x + 1) * cell_w, y0 + cell_h);
+            if (generic_path)
+            {
+                draw_list->PathRect(p_min + ImVec2(0.50f, 0.50f), aa_lines ? p_max - ImVec2(0.50f, 0.50f) : p_max - ImVec2(0.49f, 0.49f), 0.0f, ImDrawCornerFlags_All);
+                draw_list->PathStroke(border_col, true, 1.0f);
+            }
+            else
+            {
+                draw_list->AddRect(p_min, p_max, border_col, 0.0f, ImDrawCornerFlags_All, 1.0f);
+            }
+        }
+    }
+
+    // Column and row separators
+    const ImVec2 grid_max(8.0f + grid_size * cell_w, 8.0f + grid_size * cell_h);
+    for (int n = 0; n <= grid_size; n += 4)
+    {
+        const ImVec2 lines[2][2] = { { ImVec2(8.0f + n * cell_w, 8.0f), ImVec2(8.0f + n * cell_w, grid_max.y) }, { ImVec2(8.0f, 8.0f + n * cell_h), ImVec2(grid_max.x, 8.0f + n * cell_h) } };
+        for (int line_n = 0; line_n < 2; line_n++)
+        {
+            if (generic_path)
+            {
+                draw_list->PathLineTo(lines[line_n][0] + ImVec2(0.5f, 0.5f));
+                draw_list->PathLineTo(lines[line_n][1] + ImVec2(0.5f, 0.5f));
+                draw_list->PathStroke(separator_col, false, 1.0f);
+            }
+            else
+            {
+                draw_list->AddLine(lines[line_n][0], lines[line_n][1], separator_col, 1.0f);
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const int grid_size = (argc > 1) ? atoi(argv[1]) : 64;
+    const int frames_count = (argc > 2) ? atoi(argv[2]) : 100;
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(1920.0f, 1080.0f);
+    io.IniFilename = NULL;
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    ImGui::NewFrame(); // Setup ImDrawListSharedData (white pixel and lines UV)
+
+    struct BenchCase { const char* Name; ImDrawListFlags Flags; };
+    const BenchCase cases[] =
+    {
+        { "AA textured lines", ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex | ImDrawListFlags_AntiAliasedFill },
+        { "AA geometry lines", ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill },
+        { "no AA", ImDrawListFlags_None },
+    };
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    printf("%dx%d grid of bordered cells, %d frames, best time\n", grid_size, grid_size, frames_count);
+    printf("%-20s %10s %10s %10s %10s %10s %10s %8s\n", "Case", "Path vtx", "Path idx", "Fast vtx", "Fast idx", "Path (us)", "Fast (us)", "Speedup");
+    for (int case_n = 0; case_n < IM_ARRAYSIZE(cases); case_n++)
+    {
+        clock_t best_times[2] = { 0, 0 };
+        int vtx_counts[2] = { 0, 0 };
+        int idx_counts[2] = { 0, 0 };
+        for (int fast = 0; fast < 2; fast++)
+            for (int frame_n = 0; frame_n < frames_count; frame_n++)
+            {
+                draw_list._ResetForNewFrame();
+                draw_list.Flags = cases[case_n].Flags | ImDrawListFlags_AllowVtxOffset;
+                draw_list.PushClipRectFullScreen();
+                draw_list.PushTextureID(io.Fonts->TexID);
+                clock_t t0 = clock();
+                DrawGrid(&draw_list, grid_size, fast == 0);
+                clock_t t = clock() - t0;
+                if (frame_n == 1 || (frame_n > 1 && t < best_times[fast])) // First frame sets up storage
+                    best_times[fast] = t;
+                vtx_counts[fast] = draw_list.VtxBuffer.Size;
+                idx_counts[fast] = draw_list.IdxBuffer.Size;
+            }
+        const double us = 1000000.0 / CLOCKS_PER_SEC;
+        printf("%-20s %10d %10d %10d %10d %10.1f %10.1f %7.2fx\n", cases[case_n].Name, vtx_counts[0], idx_counts[0], vtx_counts[1], idx_counts[1],
+            best_times[0] * us, best_times[1] * us, best_times[1] > 0 ? (double)best_times[0] / (double)best_times[1] : 0.0);
+    }
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+    return 0;
+}
@@ -0,0 +1,128 @@
+// dear imgui
+// (imgui_bench_splitter.cpp)
+// Benchmark for ImDrawListSplitter, on a synthetic Columns-like layout: cells are drawn row by row, each column in its own channel.
+// Measures the time spent in Merge() and in the whole Split() + drawing + Merge() sequence, for 2, 8 and 64 channels:
+// - "steady": every frame draws the same contents, which is the common case for most of the UI.
+// - "varying": the number of quads in each cell changes every frame.
+// - "shared tex": all channels use the same texture, so the commands at the boundary of two channels are tested to be merged across their
+//   clip rectangles (they can, as cells are not clipped). SetCurrentChannel() tests them, Merge() reuses the results.
+//   "own tex": each channel uses its own texture, nothing to test.
+// The merged output is verified against the same cells drawn in channel order without a splitter.
+// Merge() with primitives pending for deferred tessellation is verified by imgui_bench_deferred.cpp.
+
+// Build with, e.g:
+//   # g++ -O2 -I../.. imgui_bench_splitter.cpp ../../imgui.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp ../../imgui_demo.cpp
+// Usage:
+//   imgui_bench_splitter [cells_count] [frames_count]
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdint.h>     // intptr_t
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static int CellQuadsCount(int cell_n, int frame_n, bool varying)
+{
+    return varying ? 1 + (cell_n * 7 + frame_n * 13) % 11 : 6;
+}
+
+static void DrawCell(ImDrawList* draw_list, int channels_count, int cell_n, int frame_n, bool varying, bool own_texture)
+{
+    const int column_n = cell_n % channels_count;
+    const int row_n = cell_n / channels_count;
+    const float column_x = column_n * 30.0f;
+    const int quads_count = CellQuadsCount(cell_n, frame_n, varying);
+    draw_list->PushClipRect(ImVec2(column_x, 0.0f), ImVec2(column_x + 30.0f, 4096.0f));
+    draw_list->PushTextureID(own_texture ? (ImTextureID)(intptr_t)(1 + column_n) : (ImTextureID)NULL);
+    draw_list->PrimReserve(quads_count * 6, quads_count * 4);
+    for (int quad_n = 0; quad_n < quads_count; quad_n++)
+    {
+        const ImVec2 p(column_x + (quad_n % 6) * 4.0f, row_n * 0.5f);
+        draw_list->PrimRectUV(p, ImVec2(p.x + 3.0f, p.y + 8.0f), ImVec2(0.0f, 0.0f), ImVec2(1.0f, 1.0f), IM_COL32(255, 255, 255, 55 + column_n));
+    }
+    draw_list->PopTextureID();
+    draw_list->PopClipRect();
+}
+
+// Return true when both lists draw the same triangles in the same order
+static bool CompareTriangles(const ImDrawList* a, const ImDrawList* b)
+{
+    ImVector<ImDrawVert> tris[2];
+    const ImDrawList* lists[2] = { a, b };
+    for (int list_n = 0; list_n < 2; list_n++)
+    {
+        const ImDrawList* draw_list = lists[list_n];
+        for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+        {
+            const ImDrawCmd& cmd = draw_list->CmdBuffer[cmd_n];
+            for (unsigned int n = 0; n < cmd.ElemCount; n++)
+                tris[list_n].push_back(draw_list->VtxBuffer[draw_list->IdxBuffer[cmd.IdxOffset + n] + cmd.VtxOffset]);
+        }
+    }
+    return tris[0].Size == tris[1].Size && memcmp(tris[0].Data, tris[1].Data, (size_t)tris[0].Size * sizeof(ImDrawVert)) == 0;
+}
+
+int main(int argc, char** argv)
+{
+    const int cells_count = (argc > 1) ? atoi(argv[1]) : 2048;
+    const int frames_count = (argc > 2) ? atoi(argv[2]) : 200;
+
+    ImGui::CreateContext();
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    ImDrawList ref_list(ImGui::GetDrawListSharedData());
+
+    printf("%d cells, %d frames\n", cells_count, frames_count);
+    printf("%-10s %-8s %-11s %8s %6s %12s %12s %s\n", "Channels", "Frames", "Textures", "Indices", "Cmds", "Merge (us)", "Total (us)", "Output");
+    const int channels_counts[] = { 2, 8, 64 };
+    for (int own_texture = 0; own_texture < 2; own_texture++)
+        for (int varying = 0; varying < 2; varying++)
+            for (int bench_n = 0; bench_n < IM_ARRAYSIZE(channels_counts); bench_n++)
+            {
+                const int channels_count = channels_counts[bench_n];
+                ImDrawListSplitter splitter;
+                clock_t merge_time = 0, total_time = 0;
+                bool equal = true;
+                for (int frame_n = 0; frame_n < frames_count; frame_n++)
+                {
+                    draw_list._ResetForNewFrame();
+                    draw_list.PushClipRectFullScreen();
+                    draw_list.PushTextureID(ImGui::GetIO().Fonts->TexID);
+
+                    clock_t t0 = clock();
+                    splitter.Split(&draw_list, channels_count);
+                    for (int cell_n = 0; cell_n < cells_count; cell_n++)
+                    {
+                        splitter.SetCurrentChannel(&draw_list, cell_n % channels_count);
+                        DrawCell(&draw_list, channels_count, cell_n, frame_n, varying != 0, own_texture != 0);
+                    }
+                    clock_t t1 = clock();
+                    splitter.Merge(&draw_list);
+                    clock_t t2 = clock();
+                    if (frame_n > 0) // First frame sets up storage
+                    {
+                        merge_time += t2 - t1;
+                        total_time += t2 - t0;
+                    }
+
+                    // Verify a few frames
+                    if (frame_n < 4)
+                    {
+                        ref_list._ResetForNewFrame();
+                        ref_list.PushClipRectFullScreen();
+                        ref_list.PushTextureID(ImGui::GetIO().Fonts->TexID);
+                        for (int channel_n = 0; channel_n < channels_count; channel_n++)
+                            for (int cell_n = channel_n; cell_n < cells_count; cell_n += channels_count)
+                                DrawCell(&ref_list, channels_count, cell_n, frame_n, varying != 0, own_texture != 0);
+                        equal &= CompareTriangles(&draw_list, &ref_list);
+                    }
+                }
+                const double us_per_frame = 1000000.0 / CLOCKS_PER_SEC / (frames_count > 1 ? frames_count - 1 : 1);
+                printf("%-10d %-8s %-11s %8d %6d %12.2f %12.2f %s\n", channels_count, varying ? "varying" : "steady", own_texture ? "own tex" : "shared tex", draw_list.IdxBuffer.Size, draw_list.CmdBuffer.Size,
+                    merge_time * us_per_frame, total_time * us_per_frame, equal ? "identical" : "MISMATCH");
+            }
+
+    ImGui::DestroyContext();
+    return 0;
+}
@@ -0,0 +1,629 @@
+// dear imgui: compact binary streaming of ImDrawData, e.g. to view an application UI from a remote machine
+// Get latest version at https://github.com/ocornut/imgui/tree/master/misc/drawstream
+
+// Stream format (one message per frame, all integers are LEB128 variable length unless noted):
+//   u8[3]   'I' 'D' version
+//   u8      flags (IM_DRAWSTREAM_FLAGS_RESET: frame doesn't refer to any previous frame)
+//   varint  frame index
+//   f32[6]  DisplayPos, DisplaySize, FramebufferScale (little-endian)
+//   varint  draw list count, then for each draw list:
+//     varint  list id
+//     u8      0: unchanged since last frame, 1: changed, followed by 3 ranges (commands, indices, vertices):
+//       varint  new buffer size, common prefix count, common suffix count, then (size - prefix - suffix) encoded elements
+// Commands: u8 flags (fields differing from previous command), [f32[4] ClipRect], [varint TextureId], [varint VtxOffset], [varint IdxOffset], varint ElemCount
+// Indices: zigzag delta against previous index
+// Vertices: zigzag delta of quantized pos.x, pos.y, uv.x, uv.y against previous vertex, then col XOR previous col
+// Delta predictors restart at zero at the beginning of each range, so the reader never needs to re-quantize data it stored.
+
+#include "imgui_drawstream.h"
+#include "imgui_internal.h"     // ImMin, ImFloor
+
+#define IM_DRAWSTREAM_VERSION           1
+#define IM_DRAWSTREAM_FLAGS_RESET       (1 << 0)
+#define IM_DRAWSTREAM_POS_SCALE         4.0f        // Quantize positions to 1/4th of a pixel
+#define IM_DRAWSTREAM_UV_SCALE          65536.0f
+#define IM_DRAWSTREAM_QUANTIZE_MAX      536870912.0f    // 2^29: deltas between two quantized values always fit in an int
+
+enum ImDrawStreamCmdFlags_
+{
+    ImDrawStreamCmdFlags_ClipRect           = 1 << 0,
+    ImDrawStreamCmdFlags_TextureId          = 1 << 1,
+    ImDrawStreamCmdFlags_VtxOffset          = 1 << 2,
+    ImDrawStreamCmdFlags_IdxOffset          = 1 << 3,   // IdxOffset doesn't follow previous command
+    ImDrawStreamCmdFlags_ResetRenderState   = 1 << 4
+};
+
+//-----------------------------------------------------------------------------
+// Helpers
+//-----------------------------------------------------------------------------
+
+// Clamp in float before converting: out of range (and NaN) float to int conversions are undefined.
+static inline int ImDrawStream_Quantize(float v, float scale)
+{
+    float f = ImFloor(v * scale + 0.5f);
+    if (!(f >= -IM_DRAWSTREAM_QUANTIZE_MAX))
+        f = -IM_DRAWSTREAM_QUANTIZE_MAX;
+    else if (f > IM_DRAWSTREAM_QUANTIZE_MAX)
+        f = IM_DRAWSTREAM_QUANTIZE_MAX;
+    return (int)f;
+}
+
+static inline ImU32 ImDrawStream_ZigZag(int v)                      { return ((ImU32)v << 1) ^ (ImU32)(v >> 31); }
+static inline int   ImDrawStream_UnZigZag(ImU32 v)                  { return (int)(v >> 1) ^ -(int)(v & 1); }
+static inline int   ImDrawStream_AddDelta(int prev, ImU32 zigzag)   { return (int)((ImU32)prev + (ImU32)ImDrawStream_UnZigZag(zigzag)); } // Wrap around on corrupted data instead of overflowing
+
+static ImU64 ImDrawStream_TextureIdToU64(ImTextureID tex_id)
+{
+    ImU64 v = 0;
+    memcpy(&v, &tex_id, ImMin(sizeof(tex_id), sizeof(v)));
+    return v;
+}
+
+static ImTextureID ImDrawStream_TextureIdFromU64(ImU64 v)
+{
+    ImTextureID tex_id;
+    memset(&tex_id, 0, sizeof(tex_id));
+    memcpy(&tex_id, &v, ImMin(sizeof(tex_id), sizeof(v)));
+    return tex_id;
+}
+
+static bool ImDrawStream_CmdEqual(const ImDrawCmd& a, const ImDrawCmd& b)
+{
+    return a.ClipRect.x == b.ClipRect.x && a.ClipRect.y == b.ClipRect.y && a.ClipRect.z == b.ClipRect.z && a.ClipRect.w == b.ClipRect.w
+        && memcmp(&a.TextureId, &b.TextureId, sizeof(a.TextureId)) == 0 && a.VtxOffset == b.VtxOffset && a.IdxOffset == b.IdxOffset
+        && a.ElemCount == b.ElemCount && a.UserCallback == b.UserCallback && a.UserCallbackData == b.UserCallbackData;
+}
+
+// Compare fields rather than bytes: a custom IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT may have uninitialized extra fields.
+static bool ImDrawStream_VtxEqual(const ImDrawVert& a, const ImDrawVert& b)
+{
+    return a.pos.x == b.pos.x && a.pos.y == b.pos.y && a.uv.x == b.uv.x && a.uv.y == b.uv.y && a.col == b.col;
+}
+
+static bool ImDrawStream_IdxEqual(const ImDrawIdx& a, const ImDrawIdx& b)
+{
+    return a == b;
+}
+
+// Find the common prefix and suffix of two buffers (prefix + suffix <= min sizes)
+template<typename T>
+static void ImDrawStream_FindCommonRange(const ImVector<T>& old_buf, const ImVector<T>& new_buf, bool (*equal_func)(const T&, const T&), int* out_prefix, int* out_suffix)
+{
+    const int min_size = ImMin(old_buf.Size, new_buf.Size);
+    int prefix = 0;
+    while (prefix < min_size && equal_func(old_buf.Data[prefix], new_buf.Data[prefix]))
+        prefix++;
+    int suffix = 0;
+    while (suffix < min_size - prefix && equal_func(old_buf.Data[old_buf.Size - 1 - suffix], new_buf.Data[new_buf.Size - 1 - suffix]))
+        suffix++;
+    *out_prefix = prefix;
+    *out_suffix = suffix;
+}
+
+// Copy while preserving capacity (ImVector<>::operator= frees the destination buffer)
+template<typename T>
+static void ImDrawStream_CopyBuffer(ImVector<T>* dst, const ImVector<T>& src)
+{
+    dst->resize(src.Size);
+    if (src.Size > 0)
+        memcpy(dst->Data, src.Data, (size_t)src.Size * sizeof(T));
+}
+
+// Resize a buffer keeping its first 'prefix' and last 'suffix' elements in place relative to each end
+template<typename T>
+static void ImDrawStream_ResizeKeepEnds(ImVector<T>* buf, int new_size, int suffix)
+{
+    const int old_size = buf->Size;
+    if (new_size > old_size)
+        buf->resize(new_size);
+    if (suffix > 0 && new_size != old_size)
+        memmove(buf->Data + new_size - suffix, buf->Data + old_size - suffix, (size_t)suffix * sizeof(T));
+    if (new_size < old_size)
+        buf->resize(new_size);
+}
+
+//-----------------------------------------------------------------------------
+// Writing
+//-----------------------------------------------------------------------------
+
+static inline void ImDrawStream_WriteU8(ImVector<unsigned char>* buf, unsigned char v)
+{
+    buf->push_back(v);
+}
+
+static void ImDrawStream_WriteVarint(ImVector<unsigned char>* buf, ImU64 v)
+{
+    while (v >= 0x80)
+    {
+        buf->push_back((unsigned char)(v | 0x80));
+        v >>= 7;
+    }
+    buf->push_back((unsigned char)v);
+}
+
+static void ImDrawStream_WriteFloat(ImVector<unsigned char>* buf, float f)
+{
+    ImU32 v;
+    memcpy(&v, &f, sizeof(v));
+    for (int n = 0; n < 4; n++)
+        buf->push_back((unsigned char)(v >> (n * 8)));
+}
+
+static void ImDrawStream_WriteCmds(ImVector<unsigned char>* buf, const ImDrawCmd* cmds, int count)
+{
+    ImDrawCmd prev;
+    for (int n = 0; n < count; n++)
+    {
+        const ImDrawCmd& cmd = cmds[n];
+        const bool reset_render_state = (cmd.UserCallback == ImDrawCallback_ResetRenderState);
+        const unsigned int elem_count = (cmd.UserCallback != NULL) ? 0 : cmd.ElemCount; // Other callbacks can't be sent
+        unsigned char flags = 0;
+        if (cmd.ClipRect.x != prev.ClipRect.x || cmd.ClipRect.y != prev.ClipRect.y || cmd.ClipRect.z != prev.ClipRect.z || cmd.ClipRect.w != prev.ClipRect.w)
+            flags |= ImDrawStreamCmdFlags_ClipRect;
+        if (memcmp(&cmd.TextureId, &prev.TextureId, sizeof(cmd.TextureId)) != 0)
+            flags |= ImDrawStreamCmdFlags_TextureId;
+        if (cmd.VtxOffset != prev.VtxOffset)
+            flags |= ImDrawStreamCmdFlags_VtxOffset;
+        if (cmd.IdxOffset != prev.IdxOffset + prev.ElemCount)
+            flags |= ImDrawStreamCmdFlags_IdxOffset;
+        if (reset_render_state)
+            flags |= ImDrawStreamCmdFlags_ResetRenderState;
+        ImDrawStream_WriteU8(buf, flags);
+        if (flags & ImDrawStreamCmdFlags_ClipRect)
+        {
+            ImDrawStream_WriteFloat(buf, cmd.ClipRect.x);
+            ImDrawStream_WriteFloat(buf, cmd.ClipRect.y);
+            ImDrawStream_WriteFloat(buf, cmd.ClipRect.z);
+            ImDrawStream_WriteFloat(buf, cmd.ClipRect.w);
+        }
+        if (flags & ImDrawStreamCmdFlags_TextureId)
+            ImDrawStream_WriteVarint(buf, ImDrawStream_TextureIdToU64(cmd.TextureId));
+        if (flags & ImDrawStreamCmdFlags_VtxOffset)
+            ImDrawStream_WriteVarint(buf, cmd.VtxOffset);
+        if (flags & ImDrawStreamCmdFlags_IdxOffset)
+            ImDrawStream_WriteVarint(buf, cmd.IdxOffset);
+        ImDrawStream_WriteVarint(buf, elem_count);
+
+        // Predict from what the reader will see
+        prev = cmd;
+        prev.ElemCount = elem_count;
+    }
+}
+
+static void ImDrawStream_WriteIdx(ImVector<unsigned char>* buf, const ImDrawIdx* idx, int count)
+{
+    int prev = 0;
+    for (int n = 0; n < count; n++)
+    {
+        ImDrawStream_WriteVarint(buf, ImDrawStream_ZigZag((int)idx[n] - prev));
+        prev = (int)idx[n];
+    }
+}
+
+static void ImDrawStream_WriteVtx(ImVector<unsigned char>* buf, const ImDrawVert* vtx, int count)
+{
+    int prev_px = 0, prev_py = 0, prev_u = 0, prev_v = 0;
+    ImU32 prev_col = 0;
+    for (int n = 0; n < count; n++)
+    {
+        const ImDrawVert& v = vtx[n];
+        const int px = ImDrawStream_Quantize(v.pos.x, IM_DRAWSTREAM_POS_SCALE);
+        const int py = ImDrawStream_Quantize(v.pos.y, IM_DRAWSTREAM_POS_SCALE);
+        const int u = ImDrawStream_Quantize(v.uv.x, IM_DRAWSTREAM_UV_SCALE);
+        const int uv_v = ImDrawStream_Quantize(v.uv.y, IM_DRAWSTREAM_UV_SCALE);
+        ImDrawStream_WriteVarint(buf, ImDrawStream_ZigZag(px - prev_px));
+        ImDrawStream_WriteVarint(buf, ImDrawStream_ZigZag(py - prev_py));
+        ImDrawStream_WriteVarint(buf, ImDrawStream_ZigZag(u - prev_u));
+        ImDrawStream_WriteVarint(buf, ImDrawStream_ZigZag(uv_v - prev_v));
+        ImDrawStream_WriteVarint(buf, v.col ^ prev_col);
+        prev_px = px; prev_py = py; prev_u = u; prev_v = uv_v;
+        prev_col = v.col;
+    }
+}
+
+// Write range header and return first element to send
+template<typename T>
+static int ImDrawStream_WriteRangeHeader(ImVector<unsigned char>* buf, const ImVector<T>& old_buf, const ImVector<T>& new_buf, bool (*equal_func)(const T&, const T&), int* out_count)
+{
+    int prefix, suffix;
+    ImDrawStream_FindCommonRange(old_buf, new_buf, equal_func, &prefix, &suffix);
+    ImDrawStream_WriteVarint(buf, (ImU32)new_buf.Size);
+    ImDrawStream_WriteVarint(buf, (ImU32)prefix);
+    ImDrawStream_WriteVarint(buf, (ImU32)suffix);
+    *out_count = new_buf.Size - prefix - suffix;
+    return prefix;
+}
+
+ImDrawDataStreamWriter::ImDrawDataStreamWriter()
+{
+    FrameCount = 0;
+    NextId = 1;
+    ResetPending = true;
+    LastFrameRawSize = 0;
+}
+
+ImDrawDataStreamWriter::~ImDrawDataStreamWriter()
+{
+    ClearFreeMemory();
+}
+
+void ImDrawDataStreamWriter::Reset()
+{
+    ResetPending = true;
+}
+
+void ImDrawDataStreamWriter::ClearFreeMemory()
+{
+    for (int n = 0; n < Lists.Size; n++)
+        IM_DELETE(Lists[n].DrawList);
+    Lists.clear();
+    ResetPending = true;
+}
+
+void ImDrawDataStreamWriter::Encode(const ImDrawData* draw_data, ImVector<unsigned char>* out_buf)
+{
+    IM_ASSERT(draw_data != NULL && draw_data->Valid);
+    ImVector<unsigned char>* buf = out_buf;
+    buf->resize(0);
+
+    FrameCount++;
+    const bool reset = ResetPending;
+    if (reset)
+    {
+        for (int n = 0; n < Lists.Size; n++)
+            IM_DELETE(Lists[n].DrawList);
+        Lists.resize(0);
+        ResetPending = false;
+    }
+
+    ImDrawStream_WriteU8(buf, 'I');
+    ImDrawStream_WriteU8(buf, 'D');
+    ImDrawStream_WriteU8(buf, IM_DRAWSTREAM_VERSION);
+    ImDrawStream_WriteU8(buf, reset ? IM_DRAWSTREAM_FLAGS_RESET : 0);
+    ImDrawStream_WriteVarint(buf, (ImU32)FrameCount);
+    ImDrawStream_WriteFloat(buf, draw_data->DisplayPos.x);
+    ImDrawStream_WriteFloat(buf, draw_data->DisplayPos.y);
+    ImDrawStream_WriteFloat(buf, draw_data->DisplaySize.x);
+    ImDrawStream_WriteFloat(buf, draw_data->DisplaySize.y);
+    ImDrawStream_WriteFloat(buf, draw_data->FramebufferScale.x);
+    ImDrawStream_WriteFloat(buf, draw_data->FramebufferScale.y);
+    ImDrawStream_WriteVarint(buf, (ImU32)draw_data->CmdListsCount);
+
+    LastFrameRawSize = 0;
+    for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
+    {
+        const ImDrawList* src = draw_data->CmdLists[list_n];
+        LastFrameRawSize += (size_t)src->CmdBuffer.Size * sizeof(ImDrawCmd) + (size_t)src->IdxBuffer.Size * sizeof(ImDrawIdx) + (size_t)src->VtxBuffer.Size * sizeof(ImDrawVert);
+
+        // Find history (linear search: there are rarely more than a few dozens of draw lists)
+        ImDrawDataStreamList* list = NULL;
+        for (int n = 0; n < Lists.Size && list == NULL; n++)
+            if (Lists[n].Source == src)
+                list = &Lists[n];
+        if (list == NULL)
+        {
+            ImDrawDataStreamList new_list;
+            new_list.Id = NextId++;
+            new_list.Source = src;
+            new_list.DrawList = IM_NEW(ImDrawList)(NULL);
+            new_list.LastFrame = 0;
+            Lists.push_back(new_list);
+            list = &Lists.back();
+        }
+        IM_ASSERT(list->LastFrame != FrameCount && "Same ImDrawList submitted twice in a frame!");
+        list->LastFrame = FrameCount;
+        ImDrawStream_WriteVarint(buf, list->Id);
+
+        ImDrawList* dst = list->DrawList;
+        int cmd_prefix, cmd_suffix, idx_prefix, idx_suffix, vtx_prefix, vtx_suffix;
+        ImDrawStream_FindCommonRange(dst->CmdBuffer, src->CmdBuffer, ImDrawStream_CmdEqual, &cmd_prefix, &cmd_suffix);
+        ImDrawStream_FindCommonRange(dst->IdxBuffer, src->IdxBuffer, ImDrawStream_IdxEqual, &idx_prefix, &idx_suffix);
+        ImDrawStream_FindCommonRange(dst->VtxBuffer, src->VtxBuffer, ImDrawStream_VtxEqual, &vtx_prefix, &vtx_suffix);
+        const bool unchanged = (dst->CmdBuffer.Size == src->CmdBuffer.Size && cmd_prefix == src->CmdBuffer.Size)
+            && (dst->IdxBuffer.Size == src->IdxBuffer.Size && idx_prefix == src->IdxBuffer.Size)
+            && (dst->VtxBuffer.Size == src->VtxBuffer.Size && vtx_prefix == src->VtxBuffer.Size);
+        if (unchanged)
+        {
+            ImDrawStream_WriteU8(buf, 0);
+            continue;
+        }
+        ImDrawStream_WriteU8(buf, 1);
+
+        int count;
+        int first = ImDrawStream_WriteRangeHeader(buf, dst->CmdBuffer, src->CmdBuffer, ImDrawStream_CmdEqual, &count);
+        ImDrawStream_WriteCmds(buf, src->CmdBuffer.Data + first, count);
+        first = ImDrawStream_WriteRangeHeader(buf, dst->IdxBuffer, src->IdxBuffer, ImDrawStream_IdxEqual, &count);
+        ImDrawStream_WriteIdx(buf, src->IdxBuffer.Data + first, count);
+        first = ImDrawStream_WriteRangeHeader(buf, dst->VtxBuffer, src->VtxBuffer, ImDrawStream_VtxEqual, &count);
+        ImDrawStream_WriteVtx(buf, src->VtxBuffer.Data + first, count);
+
+        ImDrawStream_CopyBuffer(&dst->CmdBuffer, src->CmdBuffer);
+        ImDrawStream_CopyBuffer(&dst->IdxBuffer, src->IdxBuffer);
+        ImDrawStream_CopyBuffer(&dst->VtxBuffer, src->VtxBuffer);
+    }
+
+    // Discard history of lists which weren't part of this frame (the reader does the same)
+    for (int n = 0; n < Lists.Size; n++)
+        if (Lists[n].LastFrame != FrameCount)
+        {
+            IM_DELETE(Lists[n].DrawList);
+            Lists.erase(Lists.Data + n);
+            n--;
+        }
+}
+
+//-----------------------------------------------------------------------------
+// Reading
+//-----------------------------------------------------------------------------
+
+// Bounds checked reader: once an error occurred, all reads return 0.
+struct ImDrawStreamReadContext
+{
+    const unsigned char*    Ptr;
+    const unsigned char*    End;
+    bool                    Error;
+
+    ImDrawStreamReadContext(const void* data, size_t size) { Ptr = (const unsigned char*)data; End = Ptr + size; Error = false; }
+    size_t  Remaining() const { return (size_t)(End - Ptr); }
+    unsigned char ReadU8()
+    {
+        if (Ptr >= End) { Error = true; return 0; }
+        return *Ptr++;
+    }
+    ImU64 ReadVarint()
+    {
+        ImU64 v = 0;
+        for (int shift = 0; shift < 64; shift += 7)
+        {
+            if (Ptr >= End) { Error = true; return 0; }
+            const unsigned char c = *Ptr++;
+            v |= (ImU64)(c & 0x7F) << shift;
+            if (!(c & 0x80))
+                return v;
+        }
+        Error = true;
+        return 0;
+    }
+    ImU32 ReadVarint32()
+    {
+        ImU64 v = ReadVarint();
+        if (v > 0xFFFFFFFF) { Error = true; return 0; }
+        return (ImU32)v;
+    }
+    float ReadFloat()
+    {
+        ImU32 v = 0;
+        for (int n = 0; n < 4; n++)
+            v |= (ImU32)ReadU8() << (n * 8);
+        float f;
+        memcpy(&f, &v, sizeof(f));
+        return f;
+    }
+};
+
+static void ImDrawStream_ReadCmds(ImDrawStreamReadContext* ctx, ImDrawCmd* cmds, int count)
+{
+    ImDrawCmd prev;
+    for (int n = 0; n < count && !ctx->Error; n++)
+    {
+        ImDrawCmd cmd = prev;
+        cmd.UserCallback = NULL;
+        cmd.UserCallbackData = NULL;
+        cmd.IdxOffset = prev.IdxOffset + prev.ElemCount;
+        const unsigned char flags = ctx->ReadU8();
+        if (flags & ImDrawStreamCmdFlags_ClipRect)
+        {
+            cmd.ClipRect.x = ctx->ReadFloat();
+            cmd.ClipRect.y = ctx->ReadFloat();
+            cmd.ClipRect.z = ctx->ReadFloat();
+            cmd.ClipRect.w = ctx->ReadFloat();
+        }
+        if (flags & ImDrawStreamCmdFlags_TextureId)
+            cmd.TextureId = ImDrawStream_TextureIdFromU64(ctx->ReadVarint());
+        if (flags & ImDrawStreamCmdFlags_VtxOffset)
+            cmd.VtxOffset = ctx->ReadVarint32();
+        if (flags & ImDrawStreamCmdFlags_IdxOffset)
+            cmd.IdxOffset = ctx->ReadVarint32();
+        if (flags & ImDrawStreamCmdFlags_ResetRenderState)
+            cmd.UserCallback = ImDrawCallback_ResetRenderState;
+        cmd.ElemCount = ctx->ReadVarint32();
+        cmds[n] = cmd;
+        prev = cmd;
+    }
+}
+
+static void ImDrawStream_ReadIdx(ImDrawStreamReadContext* ctx, ImDrawIdx* idx, int count)
+{
+    int prev = 0;
+    for (int n = 0; n < count && !ctx->Error; n++)
+    {
+        prev = ImDrawStream_AddDelta(prev, ctx->ReadVarint32());
+        idx[n] = (ImDrawIdx)prev;
+    }
+}
+
+static void ImDrawStream_ReadVtx(ImDrawStreamReadContext* ctx, ImDrawVert* vtx, int count)
+{
+    int px = 0, py = 0, u = 0, v = 0;
+    ImU32 col = 0;
+    for (int n = 0; n < count && !ctx->Error; n++)
+    {
+        px = ImDrawStream_AddDelta(px, ctx->ReadVarint32());
+        py = ImDrawStream_AddDelta(py, ctx->ReadVarint32());
+        u = ImDrawStream_AddDelta(u, ctx->ReadVarint32());
+        v = ImDrawStream_AddDelta(v, ctx->ReadVarint32());
+        col ^= ctx->ReadVarint32();
+        vtx[n].pos = ImVec2(px * (1.0f / IM_DRAWSTREAM_POS_SCALE), py * (1.0f / IM_DRAWSTREAM_POS_SCALE));
+        vtx[n].uv = ImVec2(u * (1.0f / IM_DRAWSTREAM_UV_SCALE), v * (1.0f / IM_DRAWSTREAM_UV_SCALE));
+        vtx[n].col = col;
+    }
+}
+
+// Read range header, resize buffer and return first element to decode.
+// 'min_elem_size' is the smallest encoded size of an element, used to reject bogus sizes before allocating.
+template<typename T>
+static int ImDrawStream_ReadRangeHeader(ImDrawStreamReadContext* ctx, ImVector<T>* buf, size_t min_elem_size, int* out_count)
+{
+    const ImU32 new_size = ctx->ReadVarint32();
+    const ImU32 prefix = ctx->ReadVarint32();
+    const ImU32 suffix = ctx->ReadVarint32();
+    const ImU32 old_size = (ImU32)buf->Size;
+    if (ctx->Error || prefix > old_size || suffix > old_size - prefix || prefix + suffix > new_size || (size_t)(new_size - prefix - suffix) * min_elem_size > ctx->Remaining())
+    {
+        ctx->Error = true;
+        *out_count = 0;
+        return 0;
+    }
+    ImDrawStream_ResizeKeepEnds(buf, (int)new_size, (int)suffix);
+    *out_count = (int)(new_size - prefix - suffix);
+    return (int)prefix;
+}
+
+// Check that every command only refers to received indices, and those indices to received vertices, so a corrupted
+// or malicious stream can't make the renderer read out of bounds.
+static bool ImDrawStream_ValidateDrawList(const ImDrawList* draw_list)
+{
+    const ImU32 idx_count = (ImU32)draw_list->IdxBuffer.Size;
+    const ImU32 vtx_count = (ImU32)draw_list->VtxBuffer.Size;
+    for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd& cmd = draw_list->CmdBuffer.Data[cmd_n];
+        if (cmd.IdxOffset > idx_count || cmd.ElemCount > idx_count - cmd.IdxOffset || cmd.VtxOffset > vtx_count)
+            return false;
+        const ImU32 vtx_count_from_offset = vtx_count - cmd.VtxOffset;
+        const ImDrawIdx* idx = draw_list->IdxBuffer.Data + cmd.IdxOffset;
+        for (ImU32 n = 0; n < cmd.ElemCount; n++)
+            if ((ImU32)idx[n] >= vtx_count_from_offset)
+                return false;
+    }
+    return true;
+}
+
+ImDrawDataStreamReader::ImDrawDataStreamReader()
+{
+    FrameCount = -1;
+}
+
+ImDrawDataStreamReader::~ImDrawDataStreamReader()
+{
+    ClearFreeMemory();
+}
+
+void ImDrawDataStreamReader::ClearFreeMemory()
+{
+    for (int n = 0; n < Lists.Size; n++)
+        IM_DELETE(Lists[n].DrawList);
+    Lists.clear();
+    CmdLists.clear();
+    DrawData.Clear();
+    FrameCount = -1;
+}
+
+bool ImDrawDataStreamReader::Decode(const void* data, size_t data_size)
+{
+    DrawData.Clear();
+    CmdLists.resize(0);
+
+    ImDrawStreamReadContext ctx(data, data_size);
+    if (ctx.ReadU8() != 'I' || ctx.ReadU8() != 'D' || ctx.ReadU8() != IM_DRAWSTREAM_VERSION)
+        return false;
+    const unsigned char flags = ctx.ReadU8();
+    const int frame = (int)ctx.ReadVarint32();
+    if (ctx.Error)
+        return false;
+    if (flags & IM_DRAWSTREAM_FLAGS_RESET)
+    {
+        for (int n = 0; n < Lists.Size; n++)
+            IM_DELETE(Lists[n].DrawList);
+        Lists.resize(0);
+    }
+    else if (FrameCount < 0 || frame != FrameCount + 1)
+    {
+        // Missed a frame: wait for the writer to be reset.
+        FrameCount = -1;
+        return false;
+    }
+    FrameCount = frame;
+
+    DrawData.DisplayPos.x = ctx.ReadFloat();
+    DrawData.DisplayPos.y = ctx.ReadFloat();
+    DrawData.DisplaySize.x = ctx.ReadFloat();
+    DrawData.DisplaySize.y = ctx.ReadFloat();
+    DrawData.FramebufferScale.x = ctx.ReadFloat();
+    DrawData.FramebufferScale.y = ctx.ReadFloat();
+    const ImU32 lists_count = ctx.ReadVarint32();
+    if (lists_count > ctx.Remaining() / 2) // Each list takes at least 2 bytes
+        ctx.Error = true;
+
+    for (ImU32 list_n = 0; list_n < lists_count && !ctx.Error; list_n++)
+    {
+        const ImU32 id = ctx.ReadVarint32();
+        const unsigned char op = ctx.ReadU8();
+        if (ctx.Error || op > 1)
+            break;
+
+        ImDrawDataStreamList* list = NULL;
+        for (int n = 0; n < Lists.Size && list == NULL; n++)
+            if (Lists[n].Id == id)
+                list = &Lists[n];
+        if (list == NULL)
+        {
+            ImDrawDataStreamList new_list;
+            new_list.Id = id;
+            new_list.Source = NULL;
+            new_list.DrawList = IM_NEW(ImDrawList)(NULL);
+            new_list.LastFrame = 0;
+            Lists.push_back(new_list);
+            list = &Lists.back();
+        }
+        if (list->LastFrame == FrameCount)
+        {
+            ctx.Error = true;
+            break;
+        }
+        list->LastFrame = FrameCount;
+        CmdLists.push_back(list->DrawList);
+        if (op == 0)
+            continue;
+
+        ImDrawList* dst = list->DrawList;
+        int count;
+        int first = ImDrawStream_ReadRangeHeader(&ctx, &dst->CmdBuffer, 2, &count);
+        ImDrawStream_ReadCmds(&ctx, dst->CmdBuffer.Data + first, count);
+        first = ImDrawStream_ReadRangeHeader(&ctx, &dst->IdxBuffer, 1, &count);
+        ImDrawStream_ReadIdx(&ctx, dst->IdxBuffer.Data + first, count);
+        first = ImDrawStream_ReadRangeHeader(&ctx, &dst->VtxBuffer, 5, &count);
+        ImDrawStream_ReadVtx(&ctx, dst->VtxBuffer.Data + first, count);
+        if (!ctx.Error && !ImDrawStream_ValidateDrawList(dst))
+            ctx.Error = true;
+    }
+
+    // Discard history of lists which weren't part of this frame (the writer does the same)
+    for (int n = 0; n < Lists.Size; n++)
+        if (Lists[n].LastFrame != FrameCount)
+        {
+            IM_DELETE(Lists[n].DrawList);
+            Lists.erase(Lists.Data + n);
+            n--;
+        }
+
+    if (ctx.Error || CmdLists.Size != (int)lists_count)
+    {
+        CmdLists.resize(0);
+        FrameCount = -1;
+        return false;
+    }
+
+    DrawData.Valid = true;
+    DrawData.CmdLists = CmdLists.Data;
+    DrawData.CmdListsCount = CmdLists.Size;
+    DirtyRect = ImVec4(DrawData.DisplayPos.x, DrawData.DisplayPos.y, DrawData.DisplayPos.x + DrawData.DisplaySize.x, DrawData.DisplayPos.y + DrawData.DisplaySize.y);
+    DrawData.DirtyRects = &DirtyRect;
+    DrawData.DirtyRectsCount = 1;
+    for (int n = 0; n < CmdLists.Size; n++)
+    {
+        DrawData.TotalVtxCount += CmdLists[n]->VtxBuffer.Size;
+        DrawData.TotalIdxCount += CmdLists[n]->IdxBuffer.Size;
+    }
+    return true;
+}
@@ -0,0 +1,70 @@
+// dear imgui: compact binary streaming of ImDrawData, e.g. to view an application UI from a remote machine
+// Get latest version at https://github.com/ocornut/imgui/tree/master/misc/drawstream
+
+// The writer encodes each ImDrawList as a delta against what it sent the previous frame:
+// - Unchanged draw lists are sent as a single byte.
+// - Changed draw lists only send the range of commands, indices and vertices between their common prefix and common suffix.
+// - Vertices are quantized (positions to 1/4th of a pixel, UV to 1/65536th) and delta encoded with variable length integers.
+// The reader applies the stream to its own copy of the draw lists and exposes the result as a regular ImDrawData.
+//
+// Both sides need to see every frame in order (e.g. over TCP). When a reader (re)connects, call ImDrawDataStreamWriter::Reset()
+// so the next frame is self-contained. Both sides need to use the same ImDrawIdx type.
+//
+// Texture identifiers are sent as their raw value (up to 64-bit) and UserCallback other than ImDrawCallback_ResetRenderState can't be
+// sent: those commands are received with ElemCount == 0. If your remote viewer uses different textures (e.g. its own copy of the font
+// atlas), remap ImDrawCmd::TextureId in the received ImDrawData before rendering it.
+//
+// Usage:
+//   // Sender
+//   static ImDrawDataStreamWriter writer;
+//   static ImVector<unsigned char> buf;
+//   ImGui::Render();
+//   writer.Encode(ImGui::GetDrawData(), &buf);
+//   send(socket, buf.Data, buf.Size);
+//
+//   // Receiver
+//   static ImDrawDataStreamReader reader;
+//   if (reader.Decode(msg_data, msg_size))
+//       ImGui_ImplXXXX_RenderDrawData(&reader.DrawData);
+
+#pragma once
+
+#include "imgui.h"      // IMGUI_API, ImDrawData, ImDrawList
+
+// Per draw list history, kept identically by the writer and the reader.
+struct ImDrawDataStreamList
+{
+    ImU32               Id;             // Identifier in the stream, assigned by the writer
+    const ImDrawList*   Source;         // Writer only: draw list being encoded
+    ImDrawList*         DrawList;       // Writer: copy of the last contents sent. Reader: last contents received, referenced by ImDrawDataStreamReader::DrawData.
+    int                 LastFrame;      // Last frame the list was part of. History of lists which are not part of a frame is discarded.
+};
+
+struct ImDrawDataStreamWriter
+{
+    ImVector<ImDrawDataStreamList>  Lists;
+    int                             FrameCount;
+    ImU32                           NextId;
+    bool                            ResetPending;   // Set by Reset(): next frame doesn't refer to any previous frame
+    size_t                          LastFrameRawSize;   // Size of the data that would have been sent without encoding (commands, indices, vertices)
+
+    IMGUI_API ImDrawDataStreamWriter();
+    IMGUI_API ~ImDrawDataStreamWriter();
+    IMGUI_API void  Encode(const ImDrawData* draw_data, ImVector<unsigned char>* out_buf);  // Replace contents of out_buf with the encoded frame
+    IMGUI_API void  Reset();                                                                // Call when the reader starts over (e.g. new connection)
+    IMGUI_API void  ClearFreeMemory();
+};
+
+struct ImDrawDataStreamReader
+{
+    ImDrawData                      DrawData;       // Valid after a successful Decode(), until the next call to Decode()
+    ImVector<ImDrawDataStreamList>  Lists;
+    ImVector<ImDrawList*>           CmdLists;
+    ImVec4                          DirtyRect;      // Dirty rectangles aren't streamed: DrawData.DirtyRects points to this rectangle covering the whole display
+    int                             FrameCount;
+
+    IMGUI_API ImDrawDataStreamReader();
+    IMGUI_API ~ImDrawDataStreamReader();
+    IMGUI_API bool  Decode(const void* data, size_t data_size);    // Return false on malformed data or if a frame is missing: the next frame written after a call to writer.Reset() will decode again.
+    IMGUI_API void  ClearFreeMemory();
+};
@@ -0,0 +1,179 @@
+// dear imgui
+// (imgui_drawstream_loopback.cpp)
+// Test harness for imgui_drawstream: run the demo headless, encode every frame with ImDrawDataStreamWriter,
+// decode it with ImDrawDataStreamReader, verify the received ImDrawData against the original and report bytes per frame.
+// Also checks that the reader rejects streams referring to indices or vertices out of bounds.
+
+// Build with, e.g:
+//   # g++ -I../.. imgui_drawstream_loopback.cpp imgui_drawstream.cpp ../../imgui.cpp ../../imgui_demo.cpp ../../imgui_draw.cpp ../../imgui_widgets.cpp
+// Usage:
+//   imgui_drawstream_loopback [frame_count]
+
+#include "imgui.h"
+#include "imgui_drawstream.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+static bool CompareDrawData(const ImDrawData* a, const ImDrawData* b)
+{
+    if (a->CmdListsCount != b->CmdListsCount || a->TotalVtxCount != b->TotalVtxCount || a->TotalIdxCount != b->TotalIdxCount)
+        return false;
+    if (a->DisplayPos.x != b->DisplayPos.x || a->DisplayPos.y != b->DisplayPos.y || a->DisplaySize.x != b->DisplaySize.x || a->DisplaySize.y != b->DisplaySize.y)
+        return false;
+    for (int list_n = 0; list_n < a->CmdListsCount; list_n++)
+    {
+        const ImDrawList* la = a->CmdLists[list_n];
+        const ImDrawList* lb = b->CmdLists[list_n];
+        if (la->CmdBuffer.Size != lb->CmdBuffer.Size || la->IdxBuffer.Size != lb->IdxBuffer.Size || la->VtxBuffer.Size != lb->VtxBuffer.Size)
+            return false;
+        for (int n = 0; n < la->CmdBuffer.Size; n++)
+        {
+            const ImDrawCmd& ca = la->CmdBuffer[n];
+            const ImDrawCmd& cb = lb->CmdBuffer[n];
+            const unsigned int elem_count = (ca.UserCallback != NULL) ? 0 : ca.ElemCount;
+            if (memcmp(&ca.ClipRect, &cb.ClipRect, sizeof(ca.ClipRect)) != 0 || ca.TextureId != cb.TextureId || ca.VtxOffset != cb.VtxOffset || ca.IdxOffset != cb.IdxOffset || elem_count != cb.ElemCount)
+                return false;
+            if ((ca.UserCallback == ImDrawCallback_ResetRenderState) != (cb.UserCallback == ImDrawCallback_ResetRenderState))
+                return false;
+        }
+        if (memcmp(la->IdxBuffer.Data, lb->IdxBuffer.Data, (size_t)la->IdxBuffer.Size * sizeof(ImDrawIdx)) != 0)
+            return false;
+        for (int n = 0; n < la->VtxBuffer.Size; n++)
+        {
+            const ImDrawVert& va = la->VtxBuffer[n];
+            const ImDrawVert& vb = lb->VtxBuffer[n];
+            if (fabsf(va.pos.x - vb.pos.x) > 0.126f || fabsf(va.pos.y - vb.pos.y) > 0.126f)
+                return false;
+            if (fabsf(va.uv.x - vb.uv.x) > 1.0f / 65536.0f || fabsf(va.uv.y - vb.uv.y) > 1.0f / 65536.0f || va.col != vb.col)
+                return false;
+        }
+    }
+    return true;
+}
+
+// Encode a single quad with one field altered, return whether the reader accepted it
+static bool DecodeAlteredQuad(int alteration)
+{
+    ImDrawList draw_list(NULL);
+    draw_list.CmdBuffer.push_back(ImDrawCmd());
+    draw_list.CmdBuffer[0].ClipRect = ImVec4(0, 0, 100, 100);
+    draw_list.CmdBuffer[0].ElemCount = 6;
+    const ImDrawIdx indices[6] = { 0, 1, 2, 0, 2, 3 };
+    for (int n = 0; n < 6; n++)
+        draw_list.IdxBuffer.push_back(indices[n]);
+    for (int n = 0; n < 4; n++)
+    {
+        ImDrawVert v;
+        v.pos = ImVec2((n == 1 || n == 2) ? 10.0f : 0.0f, (n >= 2) ? 10.0f : 0.0f);
+        v.uv = ImVec2(0.0f, 0.0f);
+        v.col = IM_COL32_WHITE;
+        draw_list.VtxBuffer.push_back(v);
+    }
+    switch (alteration)
+    {
+    case 1: draw_list.CmdBuffer[0].ElemCount = 9; break;            // Indices out of bounds
+    case 2: draw_list.CmdBuffer[0].IdxOffset = 3; break;            // Indices out of bounds
+    case 3: draw_list.CmdBuffer[0].VtxOffset = 1; break;            // Vertex 3 + 1 out of bounds
+    case 4: draw_list.CmdBuffer[0].VtxOffset = 100; break;          // Vertex offset out of bounds
+    case 5: draw_list.IdxBuffer[5] = 4; break;                      // Vertex out of bounds
+    case 6: draw_list.VtxBuffer[0].pos = ImVec2(1e30f, -INFINITY); break;  // Clamped when quantized, still valid
+    }
+
+    ImDrawList* lists[1] = { &draw_list };
+    ImDrawData draw_data;
+    draw_data.Valid = true;
+    draw_data.CmdLists = lists;
+    draw_data.CmdListsCount = 1;
+    draw_data.DisplaySize = ImVec2(100, 100);
+    draw_data.TotalIdxCount = draw_list.IdxBuffer.Size;
+    draw_data.TotalVtxCount = draw_list.VtxBuffer.Size;
+
+    ImDrawDataStreamWriter writer;
+    ImDrawDataStreamReader reader;
+    ImVector<unsigned char> buf;
+    writer.Encode(&draw_data, &buf);
+    return reader.Decode(buf.Data, (size_t)buf.Size);
+}
+
+int main(int argc, char** argv)
+{
+    const int frame_count = (argc > 1) ? atoi(argv[1]) : 600;
+
+    IMGUI_CHECKVERSION();
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+
+    // Build atlas
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    ImDrawDataStreamWriter writer;
+    ImDrawDataStreamReader reader;
+    ImVector<unsigned char> buf;
+    size_t total_raw = 0, total_sent = 0, max_sent = 0, first_frame_sent = 0;
+    int errors = 0;
+    for (int n = 0; n < frame_count; n++)
+    {
+        io.DisplaySize = ImVec2(1920, 1080);
+        io.DeltaTime = 1.0f / 60.0f;
+
+        // Move the mouse back and forth over the demo window, so hovering changes a few items every frame
+        io.MousePos = ImVec2(100.0f + 250.0f * (0.5f + 0.5f * sinf(n * 0.02f)), 100.0f + (float)(n % 300));
+        ImGui::NewFrame();
+
+        static float f = 0.0f;
+        ImGui::Text("Hello, world!");
+        ImGui::SliderFloat("float", &f, 0.0f, 1.0f);
+        ImGui::Text("Frame %d", n);
+        ImGui::ShowDemoWindow(NULL);
+        ImGui::ShowMetricsWindow(NULL);
+
+        ImGui::Render();
+        ImDrawData* draw_data = ImGui::GetDrawData();
+
+        // Simulate a new connection half way
+        if (n == frame_count / 2)
+            writer.Reset();
+
+        writer.Encode(draw_data, &buf);
+        if (!reader.Decode(buf.Data, (size_t)buf.Size) || !CompareDrawData(draw_data, &reader.DrawData))
+        {
+            printf("Frame %d: mismatch!\n", n);
+            errors++;
+        }
+        if (n == 0)
+            first_frame_sent = (size_t)buf.Size;
+        else
+        {
+            total_raw += writer.LastFrameRawSize;
+            total_sent += (size_t)buf.Size;
+            max_sent = (size_t)buf.Size > max_sent ? (size_t)buf.Size : max_sent;
+        }
+    }
+
+    for (int alteration = 0; alteration <= 6; alteration++)
+    {
+        const bool expect_valid = (alteration == 0 || alteration == 6);
+        if (DecodeAlteredQuad(alteration) != expect_valid)
+        {
+            printf("Altered stream %d: %s!\n", alteration, expect_valid ? "rejected" : "accepted");
+            errors++;
+        }
+    }
+
+    const int measured_frames = frame_count - 1;
+    printf("Frames: %d, errors: %d\n", frame_count, errors);
+    printf("First frame: %d bytes\n", (int)first_frame_sent);
+    if (measured_frames > 0)
+    {
+        printf("Raw ImDrawData: %d bytes/frame on average\n", (int)(total_raw / measured_frames));
+        printf("Stream: %d bytes/frame on average, %d bytes max (%.1f%% of raw)\n", (int)(total_sent / measured_frames), (int)max_sent, total_raw ? 100.0 * total_sent / total_raw : 0.0);
+    }
+
+    ImGui::DestroyContext();
+    return errors ? 1 : 0;
+}
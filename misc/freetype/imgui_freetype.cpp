@@ -328,9 +328,11 @@ bool ImFontAtlasBuildWithFreeType(FT_Library ft_library, ImFontAtlas* atlas, uns
 
     // Clear atlas
     atlas->TexID = (ImTextureID)NULL;
+    atlas->TexIDSDF = (ImTextureID)NULL;
     atlas->TexWidth = atlas->TexHeight = 0;
     atlas->TexUvScale = ImVec2(0.0f, 0.0f);
     atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
+    ImFontAtlasClearDynamicGlyphs(atlas);
     atlas->ClearTexData();
 
     // Temporary storage for building